@@ -24,6 +24,7 @@
 	#endif
 
 	#define ARENA_DEBUG
+	#define ARENA_TELEMETRY
 	#define HBL2_ENABLE_ASSERTS
 #elif RELEASE
 	#define HBL2_PROFILE(...) HBL2::ProfilerScope profiler = HBL2::ProfilerScope(__VA_ARGS__);
@@ -41,6 +42,7 @@
 	#endif
 
 	#define ARENA_DEBUG
+	#define ARENA_TELEMETRY
 	#define HBL2_ENABLE_ASSERTS
 #else
 	#define HBL2_PROFILE(...)
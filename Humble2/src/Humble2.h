@@ -4,6 +4,8 @@
 #include "Core/Application.h"
 #include "Core/Events.h"
 #include "Utilities/JobSystem.h"
+#include "Utilities/Tracer.h"
+#include "Utilities/MemoryTelemetry.h"
 
 #include "Scene/ISystem.h"
 #include "Scene/Scene.h"
@@ -47,6 +47,7 @@ namespace HBL2
 		AssetType Type = AssetType::None;
 		std::filesystem::path FilePath;
 		uint32_t FileFormatVersion = 1;
+		uint64_t LastUsedFrame = 0; // AssetManager frame of the last GetAsset, used to pick eviction candidates when a memory budget is exceeded.
 		bool Loaded = false;
 	};
 }
\ No newline at end of file
@@ -1,8 +1,12 @@
 #include "AssetManager.h"
 
 #include "Project/Project.h"
+#include "Resources/ResourceManager.h"
 #include "Utilities/ShaderUtilities.h"
 #include "Utilities/MeshUtilities.h"
+#include "Utilities/Allocators/ScratchArena.h"
+
+#include <algorithm>
 
 namespace HBL2
 {
@@ -14,10 +18,23 @@ namespace HBL2
 
 		m_AssetPool.Initialize(m_Spec.Assets);
 
+		const uint32_t assetMapCapacity = std::bit_ceil(std::max(m_Spec.Assets * 2, HashMap<UUID, Handle<Asset>>::GroupWidth));
+		const uint32_t bindingMapCapacity = assetMapCapacity * (uint32_t)decltype(Material::Textures)::Capacity;
+
 		uint64_t bytes = ArenaLayout::Create()
-			.Add<std::pair<UUID, Handle<Asset>>>(2 * m_Spec.Assets)
-			.Add<std::pair<std::filesystem::path, UUID>>(2 * m_Spec.Assets)
-			.Add<Handle<Asset>>(2 * m_Spec.Assets)
+			.AddRaw(assetMapCapacity, 16)                                 // m_RegisteredAssetMap control bytes
+			.Add<std::pair<UUID, Handle<Asset>>>(assetMapCapacity)        // m_RegisteredAssetMap
+			.AddRaw(assetMapCapacity, 16)                                 // m_AssetPathIds control bytes
+			.Add<std::pair<std::string, uint32_t>>(assetMapCapacity)      // m_AssetPathIds
+			.Add<UUID>(m_Spec.Assets)                                     // m_AssetPathIdToUUID
+			.Add<uint32_t>(m_Spec.Assets)                                 // m_FreeAssetPathIds
+			.Add<Handle<Asset>>(2 * m_Spec.Assets)                        // m_RegisteredAssets
+			.AddRaw(assetMapCapacity, 16)                                 // m_ResourceOwners control bytes
+			.Add<std::pair<uint64_t, UUID>>(assetMapCapacity)             // m_ResourceOwners
+			.AddRaw(assetMapCapacity, 16)                                 // m_TextureDependentCounts control bytes
+			.Add<std::pair<uint32_t, uint32_t>>(assetMapCapacity)         // m_TextureDependentCounts
+			.AddRaw(bindingMapCapacity, 16)                               // m_TextureDependents control bytes
+			.Add<std::pair<uint64_t, UUID>>(bindingMapCapacity)           // m_TextureDependents
 			.Total();
 
 		constexpr size_t resourceTaskByteSize = sizeof(ResourceTask<Texture>);
@@ -33,13 +50,33 @@ namespace HBL2
 
 		m_ResourceTaskPoolArena.Initialize(&Allocator::Arena, resourceTasksByteSize, resourceTaskByteSize, m_Reservation, resourceTaskByteAlignment);
 
-        m_RegisteredAssetMap = MakeHMap<UUID, Handle<Asset>>(m_PoolArena, m_Spec.Assets);
-		m_RegisteredAssetPathToUUIDMap = MakeHMap<std::filesystem::path, UUID>(m_PoolArena, m_Spec.Assets);
+		m_RegisteredAssetMap = HashMap<UUID, Handle<Asset>>(&m_PoolArena, assetMapCapacity);
+		m_AssetPathIds = HashMap<std::string, uint32_t>(&m_PoolArena, assetMapCapacity);
+		m_AssetPathIdToUUID = MakeDArray<UUID>(m_PoolArena, m_Spec.Assets);
+		m_FreeAssetPathIds = MakeDArray<uint32_t>(m_PoolArena, m_Spec.Assets);
 		m_RegisteredAssets = MakeDArray<Handle<Asset>>(m_PoolArena, m_Spec.Assets);
+		m_ResourceOwners = HashMap<uint64_t, UUID>(&m_PoolArena, assetMapCapacity);
+		m_TextureDependentCounts = HashMap<uint32_t, uint32_t>(&m_PoolArena, assetMapCapacity);
+		m_TextureDependents = HashMap<uint64_t, UUID>(&m_PoolArena, bindingMapCapacity);
+
+		if (ResourceManager::Instance != nullptr)
+		{
+			ResourceManager::Instance->AddBudgetCallback([this](ResourceBudgetCategory category, const ResourceBudgetUsage&)
+			{
+				EvictAssets(category);
+			});
+
+			ResourceManager::Instance->AddResidencyCallback([this](ResidencyKind kind, uint32_t packedHandle)
+			{
+				return EvictResident(kind, packedHandle);
+			});
+		}
 	}
 
 	void AssetManager::Dispatch()
 	{
+		m_CurrentFrame.fetch_add(1, std::memory_order_relaxed);
+
 		StaticFunction<void(void), 128> fn;
 		while (m_MainThreadCallbacks.try_dequeue(fn))
 		{
@@ -76,6 +113,8 @@ namespace HBL2
 		Asset* asset = GetAssetMetadata(handle);
 		m_RegisteredAssetMap[asset->UUID] = handle;
 
+		TrackLoadedAsset(asset);
+
 		return handle;
 	}
 
@@ -95,6 +134,303 @@ namespace HBL2
 		JobSystem::Get().Wait(ctx);
 	}
 
+	void AssetManager::EvictAssets(ResourceBudgetCategory category)
+	{
+		AssetType type = AssetType::None;
+
+		switch (category)
+		{
+		case ResourceBudgetCategory::Textures:
+			type = AssetType::Texture;
+			break;
+		case ResourceBudgetCategory::Meshes:
+			type = AssetType::Mesh;
+			break;
+		default:
+			break;
+		}
+
+		// Plain buffers are owned by systems, not assets, there is nothing to evict. Shaders and sounds are held through material
+		// and component handles that never refresh LastUsedFrame, so it can not tell whether they are still in use.
+		if (type == AssetType::None)
+		{
+			return;
+		}
+
+		struct Candidate
+		{
+			uint64_t LastUsedFrame;
+			Handle<Asset> AssetHandle;
+		};
+
+		ScratchArena scratch(Allocator::FrameArenaMT);
+		Candidate* candidates = (Candidate*)scratch.Alloc(sizeof(Candidate) * std::max<size_t>(m_RegisteredAssets.size(), 1), alignof(Candidate));
+		uint32_t candidateCount = 0;
+
+		const uint64_t currentFrame = m_CurrentFrame.load(std::memory_order_relaxed);
+
+		// Textures are fetched once when a material loads and then used through its bind group every frame, so their
+		// LastUsedFrame says nothing about whether they are drawn. Every texture bound by a loaded material is pinned.
+		uint32_t* pinned = nullptr;
+		uint32_t pinnedCount = 0;
+
+		if (type == AssetType::Texture)
+		{
+			pinned = (uint32_t*)scratch.Alloc(sizeof(uint32_t) * std::max<size_t>(m_RegisteredAssets.size(), 1) * decltype(Material::Textures)::Capacity, alignof(uint32_t));
+
+			for (Handle<Asset> handle : m_RegisteredAssets)
+			{
+				Asset* asset = GetAssetMetadata(handle);
+
+				if (asset == nullptr || asset->Type != AssetType::Material || !asset->Loaded)
+				{
+					continue;
+				}
+
+				const Material* material = ResourceManager::Instance->GetMaterial(Handle<Material>::UnPack(asset->Indentifier));
+
+				if (material == nullptr)
+				{
+					continue;
+				}
+
+				for (Handle<Texture> texture : material->Textures)
+				{
+					pinned[pinnedCount++] = texture.Pack();
+				}
+			}
+
+			std::sort(pinned, pinned + pinnedCount);
+		}
+
+		for (Handle<Asset> handle : m_RegisteredAssets)
+		{
+			Asset* asset = GetAssetMetadata(handle);
+
+			// Memory only assets (built-ins, generated resources) can not be reloaded from disk.
+			if (asset == nullptr || asset->Type != type || !asset->Loaded || asset->FilePath.empty())
+			{
+				continue;
+			}
+
+			if (type == AssetType::Texture && std::binary_search(pinned, pinned + pinnedCount, asset->Indentifier))
+			{
+				continue;
+			}
+
+			const uint64_t lastUsedFrame = std::atomic_ref<uint64_t>(asset->LastUsedFrame).load(std::memory_order_relaxed);
+			if (lastUsedFrame + EvictionGraceFrames > currentFrame)
+			{
+				continue;
+			}
+
+			candidates[candidateCount++] = { lastUsedFrame, handle };
+		}
+
+		std::sort(candidates, candidates + candidateCount, [](const Candidate& a, const Candidate& b) { return a.LastUsedFrame < b.LastUsedFrame; });
+
+		uint32_t evicted = 0;
+
+		for (uint32_t i = 0; i < candidateCount; ++i)
+		{
+			if (!ResourceManager::Instance->GetBudgetUsage(category).OverBudget())
+			{
+				break;
+			}
+
+			UnloadAsset(candidates[i].AssetHandle);
+			evicted++;
+		}
+
+		HBL2_CORE_INFO("Evicted {} least recently used {} assets to meet their memory budget.", evicted, ResourceManager::GetBudgetCategoryName(category));
+	}
+
+	bool AssetManager::EvictResident(ResidencyKind kind, uint32_t packedHandle)
+	{
+		const AssetType type = (kind == ResidencyKind::Texture ? AssetType::Texture : AssetType::Mesh);
+
+		ScratchArena scratch(Allocator::FrameArenaMT);
+		UUID* dependents = nullptr;
+		uint32_t dependentCount = 0;
+		UUID ownerUUID = 0;
+
+		{
+			std::lock_guard<std::mutex> lock(m_ResourceOwnersMutex);
+
+			auto owner = m_ResourceOwners.find(ResourceKey(type, packedHandle));
+			if (owner != m_ResourceOwners.end())
+			{
+				ownerUUID = owner->second;
+			}
+
+			// Copy the dependents out, unloading them below updates the lookups.
+			auto count = m_TextureDependentCounts.find(packedHandle);
+			if (kind == ResidencyKind::Texture && count != m_TextureDependentCounts.end())
+			{
+				dependentCount = count->second;
+				dependents = (UUID*)scratch.Alloc(sizeof(UUID) * dependentCount, alignof(UUID));
+
+				for (uint32_t i = 0; i < dependentCount; ++i)
+				{
+					dependents[i] = m_TextureDependents[DependentKey(packedHandle, i)];
+				}
+			}
+		}
+
+		// Memory only assets (built-ins, generated resources) can not be reloaded from disk.
+		const Handle<Asset> ownerHandle = (ownerUUID != 0 ? GetHandleFromUUID(ownerUUID) : Handle<Asset>());
+		const Asset* owner = GetAssetMetadata(ownerHandle);
+		if (owner == nullptr || owner->FilePath.empty() || !owner->Loaded || owner->Indentifier != packedHandle)
+		{
+			return false;
+		}
+
+		Handle<Asset>* dependentHandles = (Handle<Asset>*)scratch.Alloc(sizeof(Handle<Asset>) * std::max(dependentCount, 1u), alignof(Handle<Asset>));
+
+		for (uint32_t i = 0; i < dependentCount; ++i)
+		{
+			dependentHandles[i] = GetHandleFromUUID(dependents[i]);
+			const Asset* asset = GetAssetMetadata(dependentHandles[i]);
+
+			// The material could not be rebuilt and would keep binding the deleted texture.
+			if (asset == nullptr || asset->FilePath.empty())
+			{
+				return false;
+			}
+		}
+
+		for (uint32_t i = 0; i < dependentCount; ++i)
+		{
+			UnloadAsset(dependentHandles[i]);
+		}
+
+		UnloadAsset(ownerHandle);
+
+		return true;
+	}
+
+	void AssetManager::TrackLoadedAsset(const Asset* asset)
+	{
+		if (asset == nullptr || !asset->Loaded)
+		{
+			return;
+		}
+
+		if (asset->Type == AssetType::Texture || asset->Type == AssetType::Mesh)
+		{
+			std::lock_guard<std::mutex> lock(m_ResourceOwnersMutex);
+			m_ResourceOwners[ResourceKey(asset->Type, asset->Indentifier)] = asset->UUID;
+			return;
+		}
+
+		if (asset->Type != AssetType::Material)
+		{
+			return;
+		}
+
+		const Material* material = ResourceManager::Instance->GetMaterial(Handle<Material>::UnPack(asset->Indentifier));
+		if (material == nullptr)
+		{
+			return;
+		}
+
+		std::lock_guard<std::mutex> lock(m_ResourceOwnersMutex);
+
+		for (Handle<Texture> texture : material->Textures)
+		{
+			if (!texture.IsValid())
+			{
+				continue;
+			}
+
+			const uint32_t packedTexture = texture.Pack();
+			uint32_t& count = m_TextureDependentCounts[packedTexture];
+
+			bool linked = false;
+			for (uint32_t i = 0; i < count && !linked; ++i)
+			{
+				linked = (m_TextureDependents[DependentKey(packedTexture, i)] == asset->UUID);
+			}
+
+			if (!linked)
+			{
+				m_TextureDependents[DependentKey(packedTexture, count)] = asset->UUID;
+				count++;
+			}
+		}
+	}
+
+	void AssetManager::UntrackLoadedAsset(const Asset* asset)
+	{
+		if (asset == nullptr || !asset->Loaded)
+		{
+			return;
+		}
+
+		if (asset->Type == AssetType::Texture || asset->Type == AssetType::Mesh)
+		{
+			std::lock_guard<std::mutex> lock(m_ResourceOwnersMutex);
+
+			// Only drop the entry if it is still ours, a reload may have handed the resource to another asset.
+			auto owner = m_ResourceOwners.find(ResourceKey(asset->Type, asset->Indentifier));
+			if (owner != m_ResourceOwners.end() && owner->second == asset->UUID)
+			{
+				m_ResourceOwners.erase(owner);
+			}
+
+			return;
+		}
+
+		if (asset->Type != AssetType::Material)
+		{
+			return;
+		}
+
+		const Material* material = ResourceManager::Instance->GetMaterial(Handle<Material>::UnPack(asset->Indentifier));
+		if (material == nullptr)
+		{
+			return;
+		}
+
+		std::lock_guard<std::mutex> lock(m_ResourceOwnersMutex);
+
+		for (Handle<Texture> texture : material->Textures)
+		{
+			const uint32_t packedTexture = texture.Pack();
+
+			auto count = m_TextureDependentCounts.find(packedTexture);
+			if (!texture.IsValid() || count == m_TextureDependentCounts.end())
+			{
+				continue;
+			}
+
+			const uint32_t last = count->second - 1;
+
+			for (uint32_t i = 0; i <= last; ++i)
+			{
+				if (m_TextureDependents[DependentKey(packedTexture, i)] != asset->UUID)
+				{
+					continue;
+				}
+
+				// Keep the dependents of the texture dense, move the last one into the freed index.
+				m_TextureDependents[DependentKey(packedTexture, i)] = m_TextureDependents[DependentKey(packedTexture, last)];
+				m_TextureDependents.remove(DependentKey(packedTexture, last));
+
+				if (last == 0)
+				{
+					m_TextureDependentCounts.erase(count);
+				}
+				else
+				{
+					count->second = last;
+				}
+
+				break;
+			}
+		}
+	}
+
 	Handle<Asset> AssetManager::GetHandleFromUUID(UUID assetUUID)
 	{
 		Handle<Asset> assetHandle;
@@ -107,4 +443,81 @@ namespace HBL2
 
 		return assetHandle;
 	}
+
+	uint32_t AssetManager::InternAssetPath(const std::filesystem::path& assetPath)
+	{
+		const std::string key = assetPath.generic_string();
+
+		auto it = m_AssetPathIds.find(key);
+		if (it != m_AssetPathIds.end())
+		{
+			return it->second;
+		}
+
+		uint32_t pathId = InvalidAssetPathId;
+
+		if (!m_FreeAssetPathIds.empty())
+		{
+			pathId = m_FreeAssetPathIds.back();
+			m_FreeAssetPathIds.pop_back();
+		}
+		else
+		{
+			// Every interned path belongs to a registered asset, so ids never outnumber the asset pool the arrays are sized for.
+			HBL2_CORE_ASSERT(m_AssetPathIdToUUID.size() < m_Spec.Assets, "AssetManager: more asset paths than assets, an asset path was not deregistered.");
+
+			pathId = (uint32_t)m_AssetPathIdToUUID.size();
+			m_AssetPathIdToUUID.push_back(0);
+		}
+
+		m_AssetPathIds.insert(key, pathId);
+
+		return pathId;
+	}
+
+	uint32_t AssetManager::FindAssetPathId(const std::filesystem::path& assetPath) const
+	{
+		auto it = m_AssetPathIds.find(assetPath.generic_string());
+		if (it != m_AssetPathIds.end())
+		{
+			return it->second;
+		}
+
+		return InvalidAssetPathId;
+	}
+
+	void AssetManager::RegisterAssetPath(const std::filesystem::path& assetPath, UUID assetUUID)
+	{
+		m_AssetPathIdToUUID[InternAssetPath(assetPath)] = assetUUID;
+	}
+
+	void AssetManager::DeregisterAssetPath(const std::filesystem::path& assetPath, UUID assetUUID)
+	{
+		const std::string key = assetPath.generic_string();
+
+		auto it = m_AssetPathIds.find(key);
+		if (it == m_AssetPathIds.end())
+		{
+			return;
+		}
+
+		const uint32_t pathId = it->second;
+
+		// A newer asset registered at the same path keeps it.
+		if (m_AssetPathIdToUUID[pathId] != assetUUID)
+		{
+			return;
+		}
+
+		m_AssetPathIdToUUID[pathId] = 0;
+		m_AssetPathIds.remove(key);
+		m_FreeAssetPathIds.push_back(pathId);
+	}
+
+	void AssetManager::ClearAssetPaths()
+	{
+		m_AssetPathIds.clear();
+		m_AssetPathIdToUUID.clear();
+		m_FreeAssetPathIds.clear();
+	}
 }
@@ -3,6 +3,7 @@
 #include "Asset.h"
 #include "Resources/Handle.h"
 #include "Resources/Pool.h"
+#include "Resources/ResourceBudget.h"
 
 #include "Renderer/Device.h"
 
@@ -11,10 +12,13 @@
 #include "Utilities/JobSystem.h"
 #include "Utilities/Allocators/PoolArena.h"
 #include "Utilities/Collections/Collections.h"
+#include "Utilities/Collections/HashMap.h"
 #include "Utilities/Collections/StaticFunction.h"
 
 #include <moodycamel/concurrentqueue.h>
 
+#include <mutex>
+
 namespace HBL2
 {
 	class Window;
@@ -87,6 +91,8 @@ namespace HBL2
 			}
 
 			Asset* asset = GetAssetMetadata(handle);
+			std::atomic_ref<uint64_t>(asset->LastUsedFrame).store(m_CurrentFrame.load(std::memory_order_relaxed), std::memory_order_relaxed);
+
 			if (asset->Loaded)
 			{
 				return Handle<T>::UnPack(asset->Indentifier);
@@ -195,6 +201,37 @@ namespace HBL2
 		virtual uint32_t LoadAsset(Handle<Asset> handle) = 0;
 		virtual void UnloadAsset(Handle<Asset> handle) = 0;
 
+		// Unloads the least recently used file backed assets of the category until it is back under budget, only textures and meshes are evicted.
+		// Assets requested within the last EvictionGraceFrames frames are never evicted, they are likely still referenced by the frame in flight.
+		// Textures bound by a loaded material are never evicted either, the material bind group keeps using them without going through GetAsset.
+		// NOTE: Evicted assets reload on their next GetAsset. Resource handles cached anywhere else become stale,
+		//       so only set budgets for categories whose consumers fetch through the AssetManager.
+		void EvictAssets(ResourceBudgetCategory category);
+
+		// Residency eviction callback, unloads the file backed asset that owns the texture or mesh. The materials that bind an evicted
+		// texture are unloaded with it, so both reload on the next GetAsset of the material. Returns false if any of them is memory only.
+		// Owner and materials are found through reverse lookups kept at load and unload, not by scanning the registered assets.
+		bool EvictResident(ResidencyKind kind, uint32_t packedHandle);
+
+		// Keep the reverse lookups EvictResident uses in sync, call TrackLoadedAsset once an asset is loaded and UntrackLoadedAsset
+		// before it is unloaded (while its resource still exists). Safe to call from loading jobs.
+		void TrackLoadedAsset(const Asset* asset);
+		void UntrackLoadedAsset(const Asset* asset);
+
+		static uint64_t ResourceKey(AssetType type, uint32_t packedHandle) { return ((uint64_t)type << 32) | packedHandle; }
+		static uint64_t DependentKey(uint32_t packedTexture, uint32_t index) { return ((uint64_t)packedTexture << 32) | index; }
+
+		static constexpr uint64_t EvictionGraceFrames = 8;
+		static constexpr uint32_t InvalidAssetPathId = UINT32_MAX;
+
+		// Asset paths are interned to dense ids, so the path to UUID lookup is a single string hash of the
+		// normalized (generic) path plus an array index, instead of hashing std::filesystem::path component by component.
+		uint32_t InternAssetPath(const std::filesystem::path& assetPath);
+		uint32_t FindAssetPathId(const std::filesystem::path& assetPath) const;
+		void RegisterAssetPath(const std::filesystem::path& assetPath, UUID assetUUID);
+		void DeregisterAssetPath(const std::filesystem::path& assetPath, UUID assetUUID);
+		void ClearAssetPaths();
+
 		AssetManagerSpecification m_Spec;
 
 		Pool<Asset, Asset> m_AssetPool;
@@ -205,10 +242,19 @@ namespace HBL2
 
 		JobContext m_ResourceJobCtx;
 
-        HMap<UUID, Handle<Asset>> m_RegisteredAssetMap = MakeEmptyHMap<UUID, Handle<Asset>>();
-		HMap<std::filesystem::path, UUID> m_RegisteredAssetPathToUUIDMap = MakeEmptyHMap<std::filesystem::path, UUID>();
+		HashMap<UUID, Handle<Asset>> m_RegisteredAssetMap;
+		HashMap<std::string, uint32_t> m_AssetPathIds;
+		DArray<UUID> m_AssetPathIdToUUID = MakeEmptyDArray<UUID>(); // Indexed by interned path id, 0 when no asset is registered at that path.
+		DArray<uint32_t> m_FreeAssetPathIds = MakeEmptyDArray<uint32_t>(); // Ids of deregistered paths, reused by the next interned path.
 		DArray<Handle<Asset>> m_RegisteredAssets = MakeEmptyDArray<Handle<Asset>>();
 
+		// Reverse lookups from loaded resources to the assets that use them, guarded by m_ResourceOwnersMutex.
+		std::mutex m_ResourceOwnersMutex;
+		HashMap<uint64_t, UUID> m_ResourceOwners;             // (asset type, packed texture or mesh handle) -> owning asset.
+		HashMap<uint32_t, uint32_t> m_TextureDependentCounts; // Packed texture handle -> number of loaded materials binding it.
+		HashMap<uint64_t, UUID> m_TextureDependents;          // (packed texture handle, i) -> i-th loaded material binding it.
+
 		moodycamel::ConcurrentQueue<StaticFunction<void(void), 128>> m_MainThreadCallbacks;
+		std::atomic<uint64_t> m_CurrentFrame = 0;
 	};
 }
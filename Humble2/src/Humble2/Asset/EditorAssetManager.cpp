@@ -28,11 +28,14 @@ namespace HBL2
 			return 0;
 		}
 
+		HBL2_TRACE_ZONE(asset->DebugName);
+
 		switch (asset->Type)
 		{
 		case AssetType::Texture:
 			asset->Indentifier = ImportTexture(asset).Pack();
 			asset->Loaded = (asset->Indentifier != 0);
+			TrackLoadedAsset(asset);
 			return asset->Indentifier;
 		case AssetType::Shader:
 			asset->Indentifier = ImportShader(asset).Pack();
@@ -41,10 +44,12 @@ namespace HBL2
 		case AssetType::Material:
 			asset->Indentifier = ImportMaterial(asset).Pack();
 			asset->Loaded = (asset->Indentifier != 0);
+			TrackLoadedAsset(asset);
 			return asset->Indentifier;
 		case AssetType::Mesh:
 			asset->Indentifier = ImportMesh(asset).Pack();
 			asset->Loaded = (asset->Indentifier != 0);
+			TrackLoadedAsset(asset);
 			return asset->Indentifier;
 		case AssetType::Scene:
 			asset->Indentifier = ImportScene(asset).Pack();
@@ -82,12 +87,16 @@ namespace HBL2
 			asset->Loaded = (asset->Indentifier != 0);
 			return asset->Indentifier;
 		case AssetType::Material:
+			UntrackLoadedAsset(asset);
 			asset->Indentifier = ReimportMaterial(asset).Pack();
 			asset->Loaded = (asset->Indentifier != 0);
+			TrackLoadedAsset(asset);
 			return asset->Indentifier;
 		case AssetType::Mesh:
+			UntrackLoadedAsset(asset);
 			asset->Indentifier = ReimportMesh(asset).Pack();
 			asset->Loaded = (asset->Indentifier != 0);
+			TrackLoadedAsset(asset);
 			return asset->Indentifier;
 		case AssetType::Prefab:
 			asset->Indentifier = ReimportPrefab(asset).Pack();
@@ -177,8 +186,8 @@ namespace HBL2
 
 		if (destroyResult)
 		{
-			m_RegisteredAssetMap.erase(asset->UUID);
-			m_RegisteredAssetPathToUUIDMap.erase(asset->FilePath);
+			m_RegisteredAssetMap.remove(asset->UUID);
+			DeregisterAssetPath(asset->FilePath, asset->UUID);
 
 			auto assetIterator = std::find(m_RegisteredAssets.begin(), m_RegisteredAssets.end(), handle);
 
@@ -308,7 +317,7 @@ namespace HBL2
 
 		// Clear asset handle caches.
 		m_RegisteredAssets.clear();
-		m_RegisteredAssetPathToUUIDMap.clear();
+		ClearAssetPaths();
 		m_RegisteredAssetMap.clear();
 
 		// Reregister built in shader assets.
@@ -316,7 +325,7 @@ namespace HBL2
 		{
 			m_RegisteredAssets.push_back(shaderAssetHandle);
 			Asset* asset = GetAssetMetadata(shaderAssetHandle);
-			m_RegisteredAssetPathToUUIDMap[asset->FilePath] = asset->UUID;
+			RegisterAssetPath(asset->FilePath, asset->UUID);
 			m_RegisteredAssetMap[asset->UUID] = shaderAssetHandle;
 		}
 
@@ -325,7 +334,7 @@ namespace HBL2
 		{
 			m_RegisteredAssets.push_back(ShaderUtilities::Get().LitMaterialAsset);
 			Asset* asset = GetAssetMetadata(ShaderUtilities::Get().LitMaterialAsset);
-			m_RegisteredAssetPathToUUIDMap[asset->FilePath] = asset->UUID;
+			RegisterAssetPath(asset->FilePath, asset->UUID);
 			m_RegisteredAssetMap[asset->UUID] = ShaderUtilities::Get().LitMaterialAsset;
 		}
 
@@ -334,7 +343,7 @@ namespace HBL2
 		{
 			m_RegisteredAssets.push_back(ShaderUtilities::Get().UnlitMaterialAsset);
 			Asset* asset = GetAssetMetadata(ShaderUtilities::Get().UnlitMaterialAsset);
-			m_RegisteredAssetPathToUUIDMap[asset->FilePath] = asset->UUID;
+			RegisterAssetPath(asset->FilePath, asset->UUID);
 			m_RegisteredAssetMap[asset->UUID] = ShaderUtilities::Get().UnlitMaterialAsset;
 		}
 	}
@@ -385,7 +394,7 @@ namespace HBL2
 		}
 
 		m_RegisteredAssets.push_back(handle);
-		m_RegisteredAssetPathToUUIDMap[asset->FilePath] = asset->UUID;
+		RegisterAssetPath(asset->FilePath, asset->UUID);
 		m_RegisteredAssetMap[asset->UUID] = handle;
 
 		return handle;
@@ -470,10 +479,10 @@ namespace HBL2
 	{
 		UUID assetUUID = 0;
 
-		auto it = m_RegisteredAssetPathToUUIDMap.find(assetPath);
-		if (it != m_RegisteredAssetPathToUUIDMap.end())
+		const uint32_t pathId = FindAssetPathId(assetPath);
+		if (pathId != InvalidAssetPathId)
 		{
-			assetUUID = it->second;
+			assetUUID = m_AssetPathIdToUUID[pathId];
 		}
 
 		return assetUUID;
@@ -1425,6 +1434,7 @@ namespace HBL2
 			auto shaderReflectionData = ShaderUtilities::Get().Reflect(shaderPath.string());
 
 			Handle<BindGroup> materialBindGroup;
+			StaticDArray<Handle<Texture>, 8> materialTextures;
 
 			for (const auto& descriptorSet : shaderReflectionData.descriptorSets)
 			{
@@ -1601,6 +1611,11 @@ namespace HBL2
                     .textures = { textureBindings.data(), textureBindings.size() },
                     .buffers = { bufferBindings.data(), bufferBindings.size() },
 				});
+
+				for (const auto& textureBinding : textureBindings)
+				{
+					materialTextures.push_back(textureBinding.texture);
+				}
 			}
 
 			const auto& builtInShaderAssets = ShaderUtilities::Get().GetBuiltInShaderAssets();
@@ -1628,7 +1643,10 @@ namespace HBL2
 			auto drawBindings = ResourceManager::Instance->CreateBindGroup({
 				.debugName = strdup(std::format("{}-bind-group", materialName).c_str()),
 				.layout = Renderer::Instance->GetDynamicBindingsLayout(),
-				.buffers = { { .buffer = Renderer::Instance->TempUniformRingBuffer->GetBuffer(), .range = dynamicUniformBufferRange }, }
+				.buffers = {
+					{ .buffer = Renderer::Instance->TempUniformRingBuffer->GetBuffer(), .range = dynamicUniformBufferRange },
+					{ .buffer = Renderer::Instance->TempInstanceRingBuffer->GetBuffer(), .range = Renderer::Instance->TempInstanceRingBuffer->GetBufferSize() },
+				}
 			});
 
 			auto material = ResourceManager::Instance->CreateMaterial({
@@ -1636,10 +1654,12 @@ namespace HBL2
 				.shader = shaderHandle,
 				.drawBindGroup = drawBindings,
 				.materialBindGroup = materialBindGroup,
+				.textures = { materialTextures.data(), materialTextures.size() },
 			});
 
 			Material* mat = ResourceManager::Instance->GetMaterial(material);
 			mat->VariantHash = variantDesc;
+			mat->Instancing = (type != 0 && shaderReflectionData.hasInstanceBuffer());
 
 			stream.close();
 			return material;			
@@ -2299,6 +2319,7 @@ namespace HBL2
 			auto shaderReflectionData = ShaderUtilities::Get().Reflect(shaderPath.string());
 
 			Handle<BindGroup> materialBindGroup;
+			StaticDArray<Handle<Texture>, 8> materialTextures;
 
 			for (const auto& descriptorSet : shaderReflectionData.descriptorSets)
 			{
@@ -2457,6 +2478,11 @@ namespace HBL2
                     .textures = { textureBindings.data(), textureBindings.size() },
                     .buffers = { bufferBindings.data(), bufferBindings.size() },
 				});
+
+				for (const auto& textureBinding : textureBindings)
+				{
+					materialTextures.push_back(textureBinding.texture);
+				}
 			}
 
 			// Delete old bind group.
@@ -2467,7 +2493,10 @@ namespace HBL2
 				.shader = shaderHandle,
 				.drawBindGroup = mat->DrawBindGroup,
 				.materialBindGroup = materialBindGroup,
+				.textures = { materialTextures.data(), materialTextures.size() },
 			});
+
+			mat->Instancing = (type != 0 && shaderReflectionData.hasInstanceBuffer());
 		}
 
 		ioStream.close();
@@ -3262,6 +3291,8 @@ namespace HBL2
 			return;
 		}
 
+		UntrackLoadedAsset(asset);
+
 		ResourceManager::Instance->DeleteTexture(textureAssetHandle);
 
 		asset->Loaded = false;
@@ -3306,6 +3337,8 @@ namespace HBL2
 			return;
 		}
 
+		UntrackLoadedAsset(asset);
+
 		Mesh* mesh = ResourceManager::Instance->GetMesh(meshAssetHandle);
 
 		if (mesh != nullptr)
@@ -3343,6 +3376,8 @@ namespace HBL2
 			return;
 		}
 
+		UntrackLoadedAsset(asset);
+
 		Material* material = ResourceManager::Instance->GetMaterial(materialAssetHandle);
 
 		if (material != nullptr)
@@ -19,13 +19,16 @@
 	#include "Platform/Metal/MetalDevice.h"
 #endif
 
+#define BEGIN_APP_TRACE(tag) const uint64_t tag##Trace = Tracer::IsEnabled() ? Tracer::Now() : 0
+#define END_APP_TRACE(tag) if (tag##Trace != 0) { Tracer::RecordZone(#tag, tag##Trace, Tracer::Now()); }
+
 #ifdef DIST
-	#define BEGIN_APP_PROFILE(tag)
-	#define END_APP_PROFILE(tag, time)
+	#define BEGIN_APP_PROFILE(tag) BEGIN_APP_TRACE(tag)
+	#define END_APP_PROFILE(tag, time) END_APP_TRACE(tag)
 	#define SWAP_AND_RESET_PROFILED_TIMERS()
 #else
-	#define BEGIN_APP_PROFILE(tag) Timer tag
-	#define END_APP_PROFILE(tag, time) time = tag.ElapsedMillis()
+	#define BEGIN_APP_PROFILE(tag) BEGIN_APP_TRACE(tag); Timer tag
+	#define END_APP_PROFILE(tag, time) time = tag.ElapsedMillis(); END_APP_TRACE(tag)
 	#define SWAP_AND_RESET_PROFILED_TIMERS() (m_PreviousStats = m_CurrentStats, m_CurrentStats.Reset())
 #endif
 
@@ -97,6 +100,7 @@ namespace HBL2
 
 		EventDispatcher::Initialize();
 		JobSystem::Initialize({ projectSettings.MaxWorkerMemory });
+		Tracer::Initialize({});
 		MeshUtilities::Initialize();
 		PrefabUtilities::Initialize();
 		ShaderUtilities::Initialize();
@@ -172,23 +176,11 @@ namespace HBL2
 	{
 		m_RenderThread = std::thread(renderLoop);
 
-#ifdef HBL2_PLATFORM_WINDOWS
-        auto handle = m_RenderThread.native_handle();
-        
 		// Put render thread on to dedicated core.
-		DWORD_PTR affinityMask = 1ull << 1;
-		DWORD_PTR affinity_result = SetThreadAffinityMask(handle, affinityMask);
-		assert(affinity_result > 0);
-
-		// Set priority to normal.
-		BOOL priority_result = SetThreadPriority(handle, THREAD_PRIORITY_NORMAL);
-		assert(priority_result != 0);
+		JobSystem::SetThreadAffinity(m_RenderThread, JobSystem::Get().GetCoreForSlot(1));
 
 		// Give a name to render thread for easier debugging.
-		std::wstring wthreadname = L"HBL2::RenderThread";
-		HRESULT hr = SetThreadDescription(handle, wthreadname.c_str());
-		assert(SUCCEEDED(hr));
-#endif
+		JobSystem::SetThreadName(m_RenderThread, "HBL2::Render");
 	}
 
 	void Application::WaitForRenderThreadInitialization()
@@ -224,6 +216,8 @@ namespace HBL2
 	{
 		m_Frames++;
 
+		MemoryTelemetry::Update(Time::DeltaTime);
+
 		if (Window::Instance->GetTime() - m_Timer > 1.0)
 		{
 			Window::Instance->SetTitle(std::format("{} [{}] FPS ({})", m_Specification.Name, m_Frames, g_GfxAPI));
@@ -289,6 +283,8 @@ namespace HBL2
 			{
 				SKIP_RT_FRAME_IF_NEEDED();
 
+				HBL2_TRACE_FRAME("RenderFrame");
+
 				BEGIN_APP_PROFILE(renderThread);
 
 				BEGIN_APP_PROFILE(renderThreadWait);
@@ -326,6 +322,8 @@ namespace HBL2
 
 		Window::Instance->DispatchMainLoop([this]()
 		{
+			HBL2_TRACE_FRAME("GameFrame");
+
 			BEGIN_APP_PROFILE(gameThread);
 
 			BeginFrame();
@@ -344,6 +342,8 @@ namespace HBL2
 
 			BEGIN_APP_PROFILE(appUpdate);
 			AssetManager::Instance->Dispatch();
+			ResourceManager::Instance->DispatchBudgetCallbacks();
+			ResourceManager::Instance->UpdateResidency();
 			m_Specification.Context->OnUpdate(Time::DeltaTime);
 			m_Specification.Context->OnFixedUpdate();
 			END_APP_PROFILE(appUpdate, m_CurrentStats.AppUpdateTime);
@@ -415,7 +415,11 @@ namespace HBL2
 		MeshUtilities::Shutdown();
 		PrefabUtilities::Shutdown();
 		EventDispatcher::Shutdown();
+
+		// Stop recording and join the workers before the tracer buffers are freed.
+		Tracer::SetEnabled(false);
 		JobSystem::Shutdown();
+		Tracer::Shutdown();
 
 		Log::Shutdown();
         PlatformManager::Instance->Shutdown();
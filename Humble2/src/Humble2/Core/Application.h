@@ -21,6 +21,7 @@
 #include "Scene/SceneManager.h"
 
 #include "Utilities/JobSystem.h"
+#include "Utilities/MemoryTelemetry.h"
 #include "Utilities/Random.h"
 #include "Utilities/MeshUtilities.h"
 #include "Utilities/ShaderUtilities.h"
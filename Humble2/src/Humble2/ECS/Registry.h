@@ -29,6 +29,8 @@ namespace HBL2
             m_MaxEntities = maxEntities;
             m_MaxComponents = maxComponents;
 
+            const uint32_t typeMapCapacity = TypeResolver::MapCapacity(m_MaxComponents);
+
             uint64_t bytes = ArenaLayout::Create()
                 // Bytes for EntityManager memory.
                 .Add<bool>(maxEntities)                     // m_Used
@@ -39,7 +41,8 @@ namespace HBL2
                 .Add<void*>(m_MaxComponents)                // m_ConcreteStorages
                 .AddRaw(m_MaxComponents * 512_B * 32, 1)    // Reserve space for allocating the storages (in the EnsureArray method).
                 // Bytes for type resolver.
-                .Add<std::type_index>(m_MaxComponents)      // TypeResolver::m_TypeMap
+                .AddRaw(typeMapCapacity, 16)                // TypeResolver::m_TypeMap control bytes
+                .Add<std::pair<std::type_index, uint32_t>>(typeMapCapacity) // TypeResolver::m_TypeMap
                 .Add<uint32_t>(m_MaxComponents)             // TypeResolver::m_FreeList
                 .Add<uint32_t>(m_MaxComponents)             // TypeResolver::m_Next
                 .Total();
@@ -67,7 +70,7 @@ namespace HBL2
                     .Total();
             }
 
-            m_Reservation = Allocator::Arena.Reserve("RegistryPool", bytes);
+            m_Reservation = Allocator::Arena.Reserve("RegistryPool", bytes, true);
             m_Arena.Initialize(&Allocator::Arena, registryArenaBytes, m_Reservation);
 
             m_TypeResolver.Initialize(&m_Arena, m_MaxComponents);
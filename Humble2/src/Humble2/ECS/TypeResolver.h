@@ -1,9 +1,11 @@
 #pragma once
 
 #include "Utilities/Collections/Collections.h"
+#include "Utilities/Collections/HashMap.h"
 
 #include <cstdint>
 #include <typeindex>
+#include <algorithm>
 
 namespace HBL2
 {
@@ -14,7 +16,7 @@ namespace HBL2
 
 		void Initialize(Arena* arena, uint32_t maxComponents)
 		{
-			m_TypeMap = MakeHMap<std::type_index, uint32_t>(*arena, maxComponents);
+			m_TypeMap = HashMap<std::type_index, uint32_t>(arena, MapCapacity(maxComponents));
 			m_FreeList = MakeDArray<uint32_t>(*arena, maxComponents);
 		}
 
@@ -71,7 +73,7 @@ namespace HBL2
 				if (key.name() == typeName)
 				{
 					m_FreeList.push_back(value);
-					m_TypeMap.erase(key);
+					m_TypeMap.remove(key);
 					return;
 				}
 			}
@@ -79,8 +81,14 @@ namespace HBL2
 
 		uint32_t Count() const { return m_Next.load(); }
 
+		/// Slot count of the type map for maxComponents types, used by the owner to size the arena.
+		static uint32_t MapCapacity(uint32_t maxComponents)
+		{
+			return std::bit_ceil(std::max(maxComponents * 2, HashMap<std::type_index, uint32_t>::GroupWidth));
+		}
+
 	private:
-		HMap<std::type_index, uint32_t> m_TypeMap = MakeEmptyHMap<std::type_index, uint32_t>();
+		HashMap<std::type_index, uint32_t> m_TypeMap;
 		DArray<uint32_t> m_FreeList = MakeEmptyDArray<uint32_t>();
 		std::atomic<uint32_t> m_Next = 0;
 	};
@@ -29,6 +29,74 @@ namespace HBL2
 		return b2BodyType::b2_staticBody;
 	}
 
+	// One Box2D worker per JobSystem worker plus the main and render thread, Box2D supports at most 64.
+	static uint32_t GetBox2DWorkerCount()
+	{
+		return std::min(JobSystem::Get().GetThreadCount() + 2, 64u);
+	}
+
+	// Box2D expects a stable worker index in [0, workerCount) per executing thread.
+	// The thread that calls b2World_Step (the main thread) maps to 0, JobSystem workers [0, N) to [1, N] and the render thread to N + 1.
+	static uint32_t GetBox2DWorkerIndex()
+	{
+		const uint32_t threadCount = JobSystem::Get().GetThreadCount();
+		const uint32_t workerIndex = JobSystem::Get().GetWorkerIndex();
+
+		uint32_t box2DWorkerIndex = 0;
+
+		if (workerIndex == threadCount)
+		{
+			box2DWorkerIndex = 0;
+		}
+		else if (workerIndex == threadCount + 1)
+		{
+			box2DWorkerIndex = threadCount + 1;
+		}
+		else
+		{
+			// Threads outside the JobSystem have no worker index and would share the per worker context of another thread.
+			HBL2_CORE_ASSERT(workerIndex < threadCount, "Box2D task executed on a thread that is not part of the JobSystem.");
+			box2DWorkerIndex = workerIndex + 1;
+		}
+
+		HBL2_CORE_ASSERT(box2DWorkerIndex < GetBox2DWorkerCount(), "Box2D worker index out of range, there are more JobSystem threads than Box2D workers.");
+
+		return box2DWorkerIndex;
+	}
+
+	void* Box2DPhysicsEngine::EnqueueTask(b2TaskCallback* task, int itemCount, int minRange, void* taskContext, void* userContext)
+	{
+		Box2DPhysicsEngine* engine = (Box2DPhysicsEngine*)userContext;
+
+		// Run the task inline when we are out of task slots, returning null tells Box2D there is nothing to wait for.
+		if (engine->m_TaskCount == s_MaxTasks)
+		{
+			task(0, itemCount, 0, taskContext);
+			return nullptr;
+		}
+
+		JobContext& ctx = engine->m_TaskContexts[engine->m_TaskCount++];
+
+		const uint32_t workerCount = JobSystem::Get().GetThreadCount() + 1;
+		const uint32_t rangeSize = std::max((uint32_t)minRange, ((uint32_t)itemCount + workerCount - 1) / workerCount);
+		const uint32_t rangeCount = ((uint32_t)itemCount + rangeSize - 1) / rangeSize;
+
+		JobSystem::Get().Dispatch(ctx, rangeCount, 1, [=](JobDispatchArgs args)
+		{
+			const int startIndex = (int)(args.jobIndex * rangeSize);
+			const int endIndex = std::min(startIndex + (int)rangeSize, itemCount);
+
+			task(startIndex, endIndex, GetBox2DWorkerIndex(), taskContext);
+		});
+
+		return &ctx;
+	}
+
+	void Box2DPhysicsEngine::FinishTask(void* userTask, void* userContext)
+	{
+		JobSystem::Get().Wait(*(JobContext*)userTask);
+	}
+
 	void Box2DPhysicsEngine::Initialize(Scene* ctx, const PhysicsEngine2DSpecification& spec)
 	{
 		m_Context = ctx;
@@ -37,6 +105,12 @@ namespace HBL2
 		worldDef.gravity = { spec.GravityForce.x, spec.GravityForce.y };
 		worldDef.restitutionThreshold = 0.5f;
 
+		// Solve islands and the constraint graph in parallel on the JobSystem.
+		worldDef.workerCount = (int)GetBox2DWorkerCount();
+		worldDef.enqueueTask = EnqueueTask;
+		worldDef.finishTask = FinishTask;
+		worldDef.userTaskContext = this;
+
 		m_PhysicsWorld = b2CreateWorld(&worldDef);
 
 		m_DebugDraw = b2DefaultDebugDraw();
@@ -105,6 +179,7 @@ namespace HBL2
 
 		// Progress the simulation.
 		b2World_Step(m_PhysicsWorld, Time::FixedTimeStep, m_SubStepCount);
+		m_TaskCount = 0;
 
 		// Update the transform of rigidbodies. Consider using b2World_GetBodyEvents.
 		m_Context->Filter<Component::Rigidbody2D, Component::Transform>()
@@ -2,6 +2,8 @@
 
 #include "PhysicsEngine2D.h"
 
+#include "Utilities/JobSystem.h"
+
 #include <box2d/box2d.h>
 
 namespace HBL2
@@ -44,11 +46,19 @@ namespace HBL2
 		Physics::ID CreateRigidbody(Entity entity, Component::Rigidbody2D& rb2d, Component::Transform& transform);
 		Physics::ID CreateBoxCollider(Entity entity, Component::BoxCollider2D& bc2d, Component::Rigidbody2D& rb2d, Component::Transform& transform);
 
+		static void* EnqueueTask(b2TaskCallback* task, int itemCount, int minRange, void* taskContext, void* userContext);
+		static void FinishTask(void* userTask, void* userContext);
+
 	private:
 		b2WorldId m_PhysicsWorld = {};
 		int m_SubStepCount = 4;
 		float m_GravityForce = -9.81f;
 
+		// Box2D tasks scheduled on the JobSystem during a single b2World_Step.
+		static constexpr uint32_t s_MaxTasks = 64;
+		JobContext m_TaskContexts[s_MaxTasks];
+		uint32_t m_TaskCount = 0;
+
 		std::vector<std::function<void(Physics::CollisionEnterEvent*)>> m_CollisionEnterEvents;
 		std::vector<std::function<void(Physics::CollisionExitEvent*)>> m_CollisionExitEvents;
 		std::vector<std::function<void(Physics::CollisionHitEvent*)>> m_CollisionHitEvents;
@@ -0,0 +1,78 @@
+#include "JoltJobSystem.h"
+
+namespace HBL2
+{
+	JoltJobSystem::JoltJobSystem(uint32_t maxJobs, uint32_t maxBarriers)
+		: JPH::JobSystemWithBarrier(maxBarriers)
+	{
+		m_Jobs.Init(maxJobs, maxJobs);
+	}
+
+	JoltJobSystem::~JoltJobSystem()
+	{
+		// Make sure no queued job references the free list anymore.
+		HBL2::JobSystem::Get().Wait(m_JobContext);
+	}
+
+	int JoltJobSystem::GetMaxConcurrency() const
+	{
+		// NOTE: The '+1' is for the thread calling PhysicsSystem::Update, which helps while waiting on barriers.
+		return (int)HBL2::JobSystem::Get().GetThreadCount() + 1;
+	}
+
+	JPH::JobSystem::JobHandle JoltJobSystem::CreateJob(const char* inName, JPH::ColorArg inColor, const JobFunction& inJobFunction, JPH::uint32 inNumDependencies)
+	{
+		uint32_t index;
+
+		for (;;)
+		{
+			index = m_Jobs.ConstructObject(inName, inColor, this, inJobFunction, inNumDependencies);
+			if (index != AvailableJobs::cInvalidObjectIndex)
+			{
+				break;
+			}
+
+			HBL2_CORE_ASSERT(false, "JoltJobSystem: No jobs available!");
+			std::this_thread::yield();
+		}
+
+		Job* job = &m_Jobs.Get(index);
+
+		// Hold a handle before queueing, so the job can not be freed before we return it.
+		JobHandle handle(job);
+
+		if (inNumDependencies == 0)
+		{
+			QueueJob(job);
+		}
+
+		return handle;
+	}
+
+	void JoltJobSystem::QueueJob(Job* inJob)
+	{
+		// The reference is released by the worker once the job has been executed.
+		inJob->AddRef();
+
+		HBL2::JobSystem::Get().Execute(m_JobContext, [inJob]()
+		{
+			HBL2_TRACE_ZONE("PhysicsJob");
+
+			inJob->Execute();
+			inJob->Release();
+		});
+	}
+
+	void JoltJobSystem::QueueJobs(Job** inJobs, JPH::uint inNumJobs)
+	{
+		for (JPH::uint i = 0; i < inNumJobs; ++i)
+		{
+			QueueJob(inJobs[i]);
+		}
+	}
+
+	void JoltJobSystem::FreeJob(Job* inJob)
+	{
+		m_Jobs.DestructObject(inJob);
+	}
+}
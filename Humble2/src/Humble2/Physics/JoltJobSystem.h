@@ -0,0 +1,38 @@
+#pragma once
+
+#include "Base.h"
+#include "Utilities/JobSystem.h"
+
+#include <Jolt/Jolt.h>
+#include <Jolt/Core/JobSystemWithBarrier.h>
+#include <Jolt/Core/FixedSizeFreeList.h>
+
+namespace HBL2
+{
+	/**
+	 * @brief Jolt job system adapter that schedules physics jobs on the HBL2::JobSystem workers.
+	 *
+	 * Barriers are handled by JPH::JobSystemWithBarrier, so the thread calling PhysicsSystem::Update
+	 * will also help executing jobs while waiting, just like with the JPH::JobSystemThreadPool.
+	 */
+	class JoltJobSystem final : public JPH::JobSystemWithBarrier
+	{
+	public:
+		JoltJobSystem(uint32_t maxJobs, uint32_t maxBarriers);
+		virtual ~JoltJobSystem() override;
+
+		virtual int GetMaxConcurrency() const override;
+		virtual JobHandle CreateJob(const char* inName, JPH::ColorArg inColor, const JobFunction& inJobFunction, JPH::uint32 inNumDependencies = 0) override;
+
+	protected:
+		virtual void QueueJob(Job* inJob) override;
+		virtual void QueueJobs(Job** inJobs, JPH::uint inNumJobs) override;
+		virtual void FreeJob(Job* inJob) override;
+
+	private:
+		using AvailableJobs = JPH::FixedSizeFreeList<Job>;
+
+		AvailableJobs m_Jobs;
+		HBL2::JobContext m_JobContext;
+	};
+}
@@ -132,7 +132,16 @@ namespace HBL2
 		JPH::RegisterTypes();
 
 		m_TempAllocator = new JPH::TempAllocatorImpl(MB(spec.MaxScratchMemory));
-		m_JobSystem = new JPH::JobSystemThreadPool(JPH::cMaxPhysicsJobs, JPH::cMaxPhysicsBarriers, -1);
+
+		// NOTE: Running on the engine job system avoids oversubscribing the cores already owned by its workers.
+		if (spec.UseEngineJobSystem)
+		{
+			m_JobSystem = new JoltJobSystem(JPH::cMaxPhysicsJobs, JPH::cMaxPhysicsBarriers);
+		}
+		else
+		{
+			m_JobSystem = new JPH::JobSystemThreadPool(JPH::cMaxPhysicsJobs, JPH::cMaxPhysicsBarriers, -1);
+		}
 
 		const uint32_t cNumBodyMutexes = 0;
 
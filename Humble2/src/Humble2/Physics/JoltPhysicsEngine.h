@@ -3,6 +3,7 @@
 #include "PhysicsEngine3D.h"
 
 #include "Scene/Scene.h"
+#include "JoltJobSystem.h"
 
 // Jolt includes
 #include <Jolt/Jolt.h>
@@ -164,7 +165,7 @@ namespace HBL2
 
 	private:
 		JPH::TempAllocatorImpl* m_TempAllocator = nullptr;
-		JPH::JobSystemThreadPool* m_JobSystem = nullptr;
+		JPH::JobSystem* m_JobSystem = nullptr;
 		JPH::PhysicsSystem* m_PhysicsSystem = nullptr;
 		BPLayerInterfaceImpl m_BroadPhaseLayerInterface;
 		ObjectVsBroadPhaseLayerFilterImpl m_ObjectVsBroadPhaseLayerFilter;
@@ -14,6 +14,7 @@ namespace HBL2
 		uint32_t MaxBodyPairs = 65536;
 		uint32_t MaxContactConstraints = 10240;
 		glm::vec3 GravityForce = { 0.f, -9.81f, 0.f };
+		bool UseEngineJobSystem = true; // Schedule physics jobs on the HBL2::JobSystem instead of a private Jolt thread pool.
 	};
 
 	class HBL2_API PhysicsEngine3D
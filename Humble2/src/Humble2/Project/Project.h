@@ -55,8 +55,11 @@ namespace HBL2
 		uint32_t MaxAppMemory = 500; // In MB
 		uint32_t MaxMainThreadFrameArenaMemory = 32; // In MB
 		uint32_t MaxRenderThreadFrameArenaMemory = 8; // In MB
+		uint32_t MaxFrameSlotArenaMemory = 32; // In MB, per frame in flight
 		uint32_t MaxWorkerMemory = 2; // In MB
 		uint32_t MaxUniformBufferMemory = 32; // In MB
+		uint32_t MaxSceneBufferMemory = 8; // In MB, per frame in flight
+		uint32_t MaxInstancedDraws = 32768; // Per frame in flight, sizes the instance storage buffer
 		ResourceManagerSpecification ResourceManagerSpec = {};
 		AssetManagerSpecification AssetManagerSpec = {};
 	};
@@ -81,8 +81,11 @@ namespace HBL2
 		out << YAML::Key << "Max App Memory (MB)" << YAML::Value << spec.Settings.MaxAppMemory;
 		out << YAML::Key << "Max Main Thread Frame Arena Memory (MB)" << YAML::Value << spec.Settings.MaxMainThreadFrameArenaMemory;
 		out << YAML::Key << "Max Render Thread Frame Arena Memory (MB)" << YAML::Value << spec.Settings.MaxRenderThreadFrameArenaMemory;
+		out << YAML::Key << "Max Frame Slot Arena Memory (MB)" << YAML::Value << spec.Settings.MaxFrameSlotArenaMemory;
 		out << YAML::Key << "Max Worker Memory (MB)" << YAML::Value << spec.Settings.MaxWorkerMemory;
 		out << YAML::Key << "Max UniformBuffer Memory (MB)" << YAML::Value << spec.Settings.MaxUniformBufferMemory;
+		out << YAML::Key << "Max Scene Buffer Memory (MB)" << YAML::Value << spec.Settings.MaxSceneBufferMemory;
+		out << YAML::Key << "Max Instanced Draws" << YAML::Value << spec.Settings.MaxInstancedDraws;
 
 		out << YAML::Key << "Resource Manager" << YAML::Value;
 		out << YAML::BeginMap;
@@ -99,6 +102,13 @@ namespace HBL2
 		out << YAML::Key << "Scripts Pool Size" << YAML::Value << spec.Settings.ResourceManagerSpec.Scripts;
 		out << YAML::Key << "Sounds Pool Size" << YAML::Value << spec.Settings.ResourceManagerSpec.Sounds;
 		out << YAML::Key << "Prefabs Pool Size" << YAML::Value << spec.Settings.ResourceManagerSpec.Prefabs;
+		out << YAML::Key << "Textures Budget (MB)" << YAML::Value << YAML::Flow << YAML::BeginSeq << spec.Settings.ResourceManagerSpec.TextureBudget.CPU << spec.Settings.ResourceManagerSpec.TextureBudget.GPU << YAML::EndSeq;
+		out << YAML::Key << "Meshes Budget (MB)" << YAML::Value << YAML::Flow << YAML::BeginSeq << spec.Settings.ResourceManagerSpec.MeshBudget.CPU << spec.Settings.ResourceManagerSpec.MeshBudget.GPU << YAML::EndSeq;
+		out << YAML::Key << "Buffers Budget (MB)" << YAML::Value << YAML::Flow << YAML::BeginSeq << spec.Settings.ResourceManagerSpec.BufferBudget.CPU << spec.Settings.ResourceManagerSpec.BufferBudget.GPU << YAML::EndSeq;
+		out << YAML::Key << "Shaders Budget (MB)" << YAML::Value << YAML::Flow << YAML::BeginSeq << spec.Settings.ResourceManagerSpec.ShaderBudget.CPU << spec.Settings.ResourceManagerSpec.ShaderBudget.GPU << YAML::EndSeq;
+		out << YAML::Key << "Sounds Budget (MB)" << YAML::Value << YAML::Flow << YAML::BeginSeq << spec.Settings.ResourceManagerSpec.SoundBudget.CPU << spec.Settings.ResourceManagerSpec.SoundBudget.GPU << YAML::EndSeq;
+		out << YAML::Key << "Residency Management" << YAML::Value << spec.Settings.ResourceManagerSpec.ResidencyManagement;
+		out << YAML::Key << "Residency Budget (MB)" << YAML::Value << spec.Settings.ResourceManagerSpec.ResidencyBudget;
 		out << YAML::EndMap;
 
 		out << YAML::Key << "Asset Manager" << YAML::Value;
@@ -189,7 +199,19 @@ namespace HBL2
 		spec.Settings.MaxAppMemory = data["Project"]["Advanced"]["Max App Memory (MB)"].as<uint32_t>();
 		spec.Settings.MaxMainThreadFrameArenaMemory = data["Project"]["Advanced"]["Max Main Thread Frame Arena Memory (MB)"].as<uint32_t>();
 		spec.Settings.MaxRenderThreadFrameArenaMemory = data["Project"]["Advanced"]["Max Render Thread Frame Arena Memory (MB)"].as<uint32_t>();
+		if (data["Project"]["Advanced"]["Max Frame Slot Arena Memory (MB)"].IsDefined())
+		{
+			spec.Settings.MaxFrameSlotArenaMemory = data["Project"]["Advanced"]["Max Frame Slot Arena Memory (MB)"].as<uint32_t>();
+		}
 		spec.Settings.MaxUniformBufferMemory = data["Project"]["Advanced"]["Max UniformBuffer Memory (MB)"].as<uint32_t>();
+		if (data["Project"]["Advanced"]["Max Scene Buffer Memory (MB)"].IsDefined())
+		{
+			spec.Settings.MaxSceneBufferMemory = data["Project"]["Advanced"]["Max Scene Buffer Memory (MB)"].as<uint32_t>();
+		}
+		if (data["Project"]["Advanced"]["Max Instanced Draws"].IsDefined())
+		{
+			spec.Settings.MaxInstancedDraws = data["Project"]["Advanced"]["Max Instanced Draws"].as<uint32_t>();
+		}
 
 		if (!data["Project"]["Advanced"]["Resource Manager"].IsDefined() || !data["Project"]["Advanced"]["Asset Manager"].IsDefined())
 		{
@@ -211,6 +233,35 @@ namespace HBL2
 		spec.Settings.ResourceManagerSpec.Sounds = data["Project"]["Advanced"]["Resource Manager"]["Sounds Pool Size"].as<uint32_t>();
 		spec.Settings.ResourceManagerSpec.Prefabs = data["Project"]["Advanced"]["Resource Manager"]["Prefabs Pool Size"].as<uint32_t>();
 
+		// Budgets are [CPU, GPU] in MB, projects saved before they existed stay unlimited.
+		auto deserializeBudget = [&](const char* key, ResourceBudget& budget)
+		{
+			const auto& node = data["Project"]["Advanced"]["Resource Manager"][key];
+			if (node.IsDefined() && node.IsSequence() && node.size() == 2)
+			{
+				budget.CPU = node[0].as<uint32_t>();
+				budget.GPU = node[1].as<uint32_t>();
+			}
+		};
+
+		deserializeBudget("Textures Budget (MB)", spec.Settings.ResourceManagerSpec.TextureBudget);
+		deserializeBudget("Meshes Budget (MB)", spec.Settings.ResourceManagerSpec.MeshBudget);
+		deserializeBudget("Buffers Budget (MB)", spec.Settings.ResourceManagerSpec.BufferBudget);
+		deserializeBudget("Shaders Budget (MB)", spec.Settings.ResourceManagerSpec.ShaderBudget);
+		deserializeBudget("Sounds Budget (MB)", spec.Settings.ResourceManagerSpec.SoundBudget);
+
+		const auto& residencyManagement = data["Project"]["Advanced"]["Resource Manager"]["Residency Management"];
+		if (residencyManagement.IsDefined())
+		{
+			spec.Settings.ResourceManagerSpec.ResidencyManagement = residencyManagement.as<bool>();
+		}
+
+		const auto& residencyBudget = data["Project"]["Advanced"]["Resource Manager"]["Residency Budget (MB)"];
+		if (residencyBudget.IsDefined())
+		{
+			spec.Settings.ResourceManagerSpec.ResidencyBudget = residencyBudget.as<uint32_t>();
+		}
+
 		spec.Settings.AssetManagerSpec.Assets = data["Project"]["Advanced"]["Asset Manager"]["Assets Pool Size"].as<uint32_t>();
 
 		return true;
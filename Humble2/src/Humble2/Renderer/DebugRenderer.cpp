@@ -17,20 +17,6 @@ namespace HBL2
 
 	void DebugRenderer::Initialize()
 	{
-		// We need 48MB for the vector vertices since we have 500K max vertices per primitives, each being 8MB, but with each of them for each frame.
-		// The rest is used for the draw list, which only requires a couple hundred bytes but we round up.
-		m_Reservation = Allocator::Arena.Reserve("DebugRendererPool", (Renderer::Instance->FrameCount * 24_MB) + 16_MB);
-		m_Arena.Initialize(&Allocator::Arena, (Renderer::Instance->FrameCount * 24_MB) + 16_MB, m_Reservation);
-
-		// Reserve max space for the draws and vertices cpu storage to avoid allocations.
-		for (auto& renderData : m_RenderData)
-		{
-			renderData.Draws.Initialize(m_Arena, 3);
-			renderData.LineVerts = MakeDArrayResized<DebugVertex>(m_Arena, s_MaxDebugVertices);
-			renderData.FillTrisVerts = MakeDArrayResized<DebugVertex>(m_Arena, s_MaxDebugVertices);
-			renderData.WireTrisVerts = MakeDArrayResized<DebugVertex>(m_Arena, s_MaxDebugVertices);
-		}
-
 		m_ResourceManager = ResourceManager::Instance;
 
 		m_DebugRenderPassLayout = m_ResourceManager->CreateRenderPassLayout({
@@ -202,12 +188,14 @@ namespace HBL2
 	
 	void DebugRenderer::BeginFrame()
 	{
-		DebugRenderData* renderData = &m_RenderData[Renderer::Instance->GetFrameWriteIndex()];
+		// The vertices live in the frame slot arena, the render thread uploads them straight from there.
+		Arena& frameArena = Renderer::Instance->GetFrameArena();
 
-		renderData->Draws.Reset();
-		renderData->CurrentLineIndex = 0;
-		renderData->CurrentFillIndex = 0;
-		renderData->CurrentWireIndex = 0;
+		m_CurrentRenderData = frameArena.AllocConstruct<DebugRenderData>();
+		m_CurrentRenderData->Draws.Initialize(frameArena, 3);
+		m_CurrentRenderData->LineVerts = MakeDArray<DebugVertex>(frameArena, m_LineVertexHint);
+		m_CurrentRenderData->FillTrisVerts = MakeDArray<DebugVertex>(frameArena, m_FillVertexHint);
+		m_CurrentRenderData->WireTrisVerts = MakeDArray<DebugVertex>(frameArena, m_WireVertexHint);
 
 		if (PhysicsEngine2D::Instance != nullptr)
 		{
@@ -222,7 +210,11 @@ namespace HBL2
 
 	void DebugRenderer::EndFrame()
 	{
-		DebugRenderData* renderData = &m_RenderData[Renderer::Instance->GetFrameWriteIndex()];
+		DebugRenderData* renderData = m_CurrentRenderData;
+
+		m_LineVertexHint = renderData->CurrentLineIndex;
+		m_FillVertexHint = renderData->CurrentFillIndex;
+		m_WireVertexHint = renderData->CurrentWireIndex;
 
 		// Line rendering.
 		if (renderData->CurrentLineIndex != 0)
@@ -267,6 +259,11 @@ namespace HBL2
 	{
 		DebugRenderData* renderData = (DebugRenderData*)debugRenderData;
 
+		if (renderData == nullptr)
+		{
+			return;
+		}
+
 		m_ResourceManager->SetBufferData(m_DebugLineVertexBuffer, 0, renderData->LineVerts.data());
 
 		if (renderData->CurrentLineIndex != 0)
@@ -318,13 +315,7 @@ namespace HBL2
 		m_ResourceManager->DeleteMaterial(m_DebugFillMaterial);
 		m_ResourceManager->DeleteMaterial(m_DebugWireMaterial);
 
-		for (auto& renderData : m_RenderData)
-		{
-			renderData.Draws.Reset();
-			renderData.LineVerts.clear();
-			renderData.FillTrisVerts.clear();
-			renderData.WireTrisVerts.clear();
-		}
+		m_CurrentRenderData = nullptr;
 
 		s_SphereIndices.clear();
 		s_SphereVerts.clear();
@@ -332,18 +323,22 @@ namespace HBL2
 
 	void DebugRenderer::DrawLine(const glm::vec3& from, const glm::vec3& to)
 	{
-		DebugRenderData* renderData = &m_RenderData[Renderer::Instance->GetFrameWriteIndex()];
+		DebugRenderData* renderData = m_CurrentRenderData;
 
-		renderData->LineVerts[renderData->CurrentLineIndex++] = { from, Color };
-		renderData->LineVerts[renderData->CurrentLineIndex++] = { to, Color };
+		// The GPU vertex buffers hold at most s_MaxDebugVertices, drop anything past that.
+		if (renderData == nullptr || renderData->CurrentLineIndex + 2 > s_MaxDebugVertices)
+		{
+			return;
+		}
+
+		renderData->LineVerts.push_back({ from, Color });
+		renderData->LineVerts.push_back({ to, Color });
+		renderData->CurrentLineIndex += 2;
 	}
 
 	void DebugRenderer::DrawRay(const glm::vec3& from, const glm::vec3& direction)
 	{
-		DebugRenderData* renderData = &m_RenderData[Renderer::Instance->GetFrameWriteIndex()];
-
-		renderData->LineVerts[renderData->CurrentLineIndex++] = { from, Color };
-		renderData->LineVerts[renderData->CurrentLineIndex++] = { from + direction, Color };
+		DrawLine(from, from + direction);
 	}
 
 	void DebugRenderer::DrawSphere(const glm::vec3& position, float radius)
@@ -436,20 +431,32 @@ namespace HBL2
 
 	void DebugRenderer::DrawTriangle(const glm::vec3& v1, const glm::vec3& v2, const glm::vec3& v3)
 	{
-		DebugRenderData* renderData = &m_RenderData[Renderer::Instance->GetFrameWriteIndex()];
+		DebugRenderData* renderData = m_CurrentRenderData;
+
+		if (renderData == nullptr || renderData->CurrentFillIndex + 3 > s_MaxDebugVertices)
+		{
+			return;
+		}
 
-		renderData->FillTrisVerts[renderData->CurrentFillIndex++] = { v1, Color };
-		renderData->FillTrisVerts[renderData->CurrentFillIndex++] = { v2, Color };
-		renderData->FillTrisVerts[renderData->CurrentFillIndex++] = { v3, Color };
+		renderData->FillTrisVerts.push_back({ v1, Color });
+		renderData->FillTrisVerts.push_back({ v2, Color });
+		renderData->FillTrisVerts.push_back({ v3, Color });
+		renderData->CurrentFillIndex += 3;
 	}
 
 	void DebugRenderer::DrawWireTriangle(const glm::vec3& v1, const glm::vec3& v2, const glm::vec3& v3)
 	{
-		DebugRenderData* renderData = &m_RenderData[Renderer::Instance->GetFrameWriteIndex()];
+		DebugRenderData* renderData = m_CurrentRenderData;
+
+		if (renderData == nullptr || renderData->CurrentWireIndex + 3 > s_MaxDebugVertices)
+		{
+			return;
+		}
 
-		renderData->WireTrisVerts[renderData->CurrentWireIndex++] = { v1, Color };
-		renderData->WireTrisVerts[renderData->CurrentWireIndex++] = { v2, Color };
-		renderData->WireTrisVerts[renderData->CurrentWireIndex++] = { v3, Color };
+		renderData->WireTrisVerts.push_back({ v1, Color });
+		renderData->WireTrisVerts.push_back({ v2, Color });
+		renderData->WireTrisVerts.push_back({ v3, Color });
+		renderData->CurrentWireIndex += 3;
 	}
 	
 	void DebugRenderer::InitSphereMesh(int segments, int rings)
@@ -27,6 +27,9 @@ namespace HBL2
 		uint32_t Color;
 	};
 
+	/**
+	 * @brief Debug geometry of a single frame, allocated in the frame slot arena (Renderer::GetFrameArena).
+	 */
 	struct DebugRenderData
 	{
 		DrawList Draws;
@@ -96,9 +99,11 @@ namespace HBL2
 		Handle<Buffer> m_DebugFillTriVertexBuffer;
 		Handle<Buffer> m_DebugWireTriVertexBuffer;
 
-		PoolReservation* m_Reservation = nullptr;
-		Arena m_Arena;
+		DebugRenderData* m_CurrentRenderData = nullptr;
 
-		DebugRenderData m_RenderData[Renderer::FrameCount];
+		// Vertex counts of the last frame, used to size the vertex arrays of the next one.
+		uint32_t m_LineVertexHint = 0;
+		uint32_t m_FillVertexHint = 0;
+		uint32_t m_WireVertexHint = 0;
 	};
 }
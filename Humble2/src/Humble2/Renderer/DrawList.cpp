@@ -1,7 +1,50 @@
 #include "DrawList.h"
 
+#include <cstring>
+
 namespace HBL2
 {
+	namespace
+	{
+		struct SortEntry
+		{
+			uint64_t Key = 0;
+			uint32_t Index = 0;
+		};
+
+		// Below this many draws the histograms cost more than an insertion sort.
+		constexpr uint32_t RadixSortThreshold = 32;
+
+		uint64_t Field(uint64_t value, uint32_t bits)
+		{
+			return value & ((1ull << bits) - 1);
+		}
+
+		// A non negative float orders the same as its bit pattern, so the bits after the sign are a quantized depth.
+		uint64_t QuantizeDepth(float depth, uint32_t bits)
+		{
+			if (!(depth > 0.0f))
+			{
+				return 0;
+			}
+
+			uint32_t pattern = 0;
+			std::memcpy(&pattern, &depth, sizeof(float));
+
+			return pattern >> (31 - bits);
+		}
+
+		// Variant handles are pipeline pointers, mix them so the kept bits are not just the allocation alignment.
+		uint64_t HashVariant(uint64_t variant, uint32_t bits)
+		{
+			variant ^= variant >> 33;
+			variant *= 0xff51afd7ed558ccdull;
+			variant ^= variant >> 33;
+
+			return variant >> (64 - bits);
+		}
+	}
+
 	DrawList::DrawList(Arena& arena, uint32_t reservedDrawCount)
 	{
 		Initialize(arena, reservedDrawCount);
@@ -15,66 +58,175 @@ namespace HBL2
 	void DrawList::Initialize(Arena& arena)
 	{
 		m_Draws = MakeDArray<LocalDrawStream>(arena, 32768);
+		m_SortKeys = MakeDArray<uint64_t>(arena, 32768);
 	}
 
 	void DrawList::Initialize(ScratchArena& arena)
 	{
 		m_Draws = MakeDArray<LocalDrawStream>(arena, 32768);
+		m_SortKeys = MakeDArray<uint64_t>(arena, 32768);
 	}
 
 	void DrawList::Initialize(Arena& arena, uint32_t reservedDrawCount)
 	{
 		m_Draws = MakeDArray<LocalDrawStream>(arena, reservedDrawCount);
+		m_SortKeys = MakeDArray<uint64_t>(arena, reservedDrawCount);
 	}
 
 	void DrawList::Initialize(ScratchArena& arena, uint32_t reservedDrawCount)
 	{
 		m_Draws = MakeDArray<LocalDrawStream>(arena, reservedDrawCount);
+		m_SortKeys = MakeDArray<uint64_t>(arena, reservedDrawCount);
 	}
 
-	void DrawList::Insert(LocalDrawStream&& draw)
+	void DrawList::Insert(LocalDrawStream&& draw, float depth)
 	{
+		m_SortKeys.push_back(MakeSortKey(draw, depth, m_SortOrder));
 		m_Draws.emplace_back(std::move(draw));
 	}
 
+	uint64_t DrawList::MakeSortKey(const LocalDrawStream& draw, float depth, DrawSortOrder order)
+	{
+		const uint64_t shader = Field(draw.Shader.Index(), 12);
+		const uint64_t variant = HashVariant(draw.VariantHandle, 10);
+		const uint64_t mesh = draw.IndexBuffer.IsValid() ? draw.IndexBuffer.Index() : draw.VertexBuffer.Index();
+
+		if (order == DrawSortOrder::BackToFront)
+		{
+			const uint64_t invertedDepth = Field(~QuantizeDepth(depth, 24), 24);
+
+			return (1ull << 63) | (invertedDepth << 39) | (shader << 27) | (variant << 17) | Field(draw.MaterialBindGroup.Index(), 17);
+		}
+
+		return (shader << 51) | (variant << 41) | (Field(draw.MaterialBindGroup.Index(), 14) << 27) | (Field(mesh, 11) << 16) | QuantizeDepth(depth, 16);
+	}
+
 	void DrawList::Sort()
 	{
-		std::sort(m_Draws.begin(), m_Draws.end(), [](const LocalDrawStream& a, const LocalDrawStream& b)
+		const uint32_t count = (uint32_t)m_Draws.size();
+
+		if (count < 2)
 		{
-			// First sort by shader.
-			const uint32_t shaderA = a.Shader.HashKey();
-			const uint32_t shaderB = b.Shader.HashKey();
+			return;
+		}
 
-			if (shaderA != shaderB)
+		// Temporaries come from the arena of the list and are released on return, the draws themselves were allocated before the mark.
+		ScratchArena scratch(*m_Draws.get_allocator().GetArena());
+
+		// Sort 16 byte (key, index) pairs and move the draws only once at the end.
+		DArray<SortEntry> entries = MakeDArrayResized<SortEntry>(scratch, count);
+
+		for (uint32_t i = 0; i < count; ++i)
+		{
+			entries[i] = { m_SortKeys[i], i };
+		}
+
+		if (count <= RadixSortThreshold)
+		{
+			for (uint32_t i = 1; i < count; ++i)
 			{
-				return shaderA < shaderB;
+				const SortEntry entry = entries[i];
+
+				uint32_t j = i;
+				for (; j > 0 && entries[j - 1].Key > entry.Key; --j)
+				{
+					entries[j] = entries[j - 1];
+				}
+
+				entries[j] = entry;
 			}
+		}
+		else
+		{
+			DArray<SortEntry> swap = MakeDArrayResized<SortEntry>(scratch, count);
+
+			// LSD radix sort, one byte per pass. It is stable, so equal keys keep their insertion order.
+			uint32_t histograms[8][256] = {};
 
-			// If they have same shader, then sort by variant key.
-			if (a.VariantHandle != b.VariantHandle)
+			for (const SortEntry& entry : entries)
 			{
-				return a.VariantHandle < b.VariantHandle;
+				for (uint32_t pass = 0; pass < 8; ++pass)
+				{
+					histograms[pass][(entry.Key >> (pass * 8)) & 0xFF]++;
+				}
 			}
 
-			// If they have same variant key, then sort by material (bind group).
-			const uint32_t materialA = a.MaterialBindGroup.HashKey();
-			const uint32_t materialB = b.MaterialBindGroup.HashKey();
+			SortEntry* source = entries.data();
+			SortEntry* destination = swap.data();
 
-			if (materialA != materialB)
+			for (uint32_t pass = 0; pass < 8; ++pass)
 			{
-				return materialA < materialB;
+				const uint32_t shift = pass * 8;
+				uint32_t* histogram = histograms[pass];
+
+				// Every key has the same byte here (e.g. unused depth bits), the pass would not move anything.
+				if (histogram[(source[0].Key >> shift) & 0xFF] == count)
+				{
+					continue;
+				}
+
+				uint32_t offset = 0;
+				for (uint32_t bucket = 0; bucket < 256; ++bucket)
+				{
+					const uint32_t bucketCount = histogram[bucket];
+					histogram[bucket] = offset;
+					offset += bucketCount;
+				}
+
+				for (uint32_t i = 0; i < count; ++i)
+				{
+					destination[histogram[(source[i].Key >> shift) & 0xFF]++] = source[i];
+				}
+
+				std::swap(source, destination);
 			}
 
-			// Then, order by index buffer.
-			const uint32_t ibA = a.IndexBuffer.HashKey();
-			const uint32_t ibB = b.IndexBuffer.HashKey();
+			if (source != entries.data())
+			{
+				std::copy(source, source + count, entries.data());
+			}
+		}
+
+		DArray<LocalDrawStream> sortedDraws = MakeDArray<LocalDrawStream>(scratch, count);
 
-			return ibA < ibB;
-		});
+		for (uint32_t i = 0; i < count; ++i)
+		{
+			sortedDraws.push_back(m_Draws[entries[i].Index]);
+			m_SortKeys[i] = entries[i].Key;
+		}
+
+		std::copy(sortedDraws.begin(), sortedDraws.end(), m_Draws.begin());
 	}
 
 	void DrawList::Reset()
 	{
 		m_Draws.clear();
+		m_SortKeys.clear();
+	}
+
+	bool DrawList::CanShareInstances(const LocalDrawStream& a, const LocalDrawStream& b)
+	{
+		if (!a.Instanceable || !b.Instanceable)
+		{
+			return false;
+		}
+
+		// Draws that already are instanced place their own instances, leave them as they are.
+		if (a.InstanceCount != 1 || b.InstanceCount != 1 || a.InstanceOffset != 0 || b.InstanceOffset != 0)
+		{
+			return false;
+		}
+
+		return a.Shader == b.Shader
+			&& a.VariantHandle == b.VariantHandle
+			&& a.IndexBuffer == b.IndexBuffer
+			&& a.VertexBuffer == b.VertexBuffer
+			&& a.MaterialBindGroup == b.MaterialBindGroup
+			&& a.BindGroup == b.BindGroup
+			&& a.Size == b.Size
+			&& a.IndexCount == b.IndexCount
+			&& a.IndexOffset == b.IndexOffset
+			&& a.VertexCount == b.VertexCount
+			&& a.VertexOffset == b.VertexOffset;
 	}
 }
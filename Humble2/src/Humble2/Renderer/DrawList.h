@@ -29,6 +29,8 @@ namespace HBL2
 		uint32_t VertexOffset = 0;
 		uint32_t InstanceCount = 1;
 		uint32_t InstanceOffset = 0;
+
+		bool Instanceable = false; // The shader reads the per draw data by instance index, so the draw can be merged with identical ones.
 	};
 
 	struct GlobalDrawStream
@@ -41,6 +43,20 @@ namespace HBL2
 		bool UsesDynamicOffset = false;
 	};
 
+	enum class DrawSortOrder : uint8_t
+	{
+		FrontToBack = 0, // Opaque: state first, then near to far inside the same state.
+		BackToFront,     // Transparent: far to near first, then state.
+	};
+
+	/**
+	 * @brief Draws of one pass, each with a 64-bit sort key computed on insertion and radix sorted.
+	 *
+	 * Front to back keys (msb to lsb): blend (1) | shader (12) | variant (10) | material (14) | mesh (11) | depth (16).
+	 * Back to front keys (msb to lsb): blend (1) | inverted depth (24) | shader (12) | variant (10) | material (17).
+	 * The pass is implicit since every pass has its own list. Handle indices are truncated to their field and
+	 * the pipeline variant is hashed into its field, a collision only costs a state change, never correctness.
+	 */
 	class DrawList
 	{
 	public:
@@ -52,14 +68,84 @@ namespace HBL2
 		void Initialize(ScratchArena& arena);
 		void Initialize(Arena& arena, uint32_t reservedDrawCount);
 		void Initialize(ScratchArena& arena, uint32_t reservedDrawCount);
-		void Insert(LocalDrawStream&& draw);
+		/**
+		 * @brief Adds a draw.
+		 *
+		 * @param draw The draw.
+		 * @param depth Distance of the draw from the viewer, only used for ordering.
+		 */
+		void Insert(LocalDrawStream&& draw, float depth = 0.0f);
 		void Sort();
 		void Reset();
 
+		/**
+		 * @brief Collapses runs of consecutive instanceable draws with the same state and geometry into one instanced draw, call after Sort.
+		 *
+		 * @param placeInstances Called with the draws of each run of two or more, copies their per draw data next to each other in the
+		 * instance buffer and returns the index of the first one, or UINT32_MAX to leave the run as separate draws.
+		 * @return The number of draws removed.
+		 */
+		template<typename F>
+		uint32_t MergeInstances(F&& placeInstances)
+		{
+			const uint32_t count = (uint32_t)m_Draws.size();
+			uint32_t kept = 0;
+			uint32_t first = 0;
+
+			while (first < count)
+			{
+				uint32_t last = first + 1;
+
+				while (last < count && CanShareInstances(m_Draws[first], m_Draws[last]))
+				{
+					last++;
+				}
+
+				const uint32_t firstInstance = (last - first > 1) ? placeInstances(Span<const LocalDrawStream>(m_Draws.data() + first, last - first)) : UINT32_MAX;
+
+				if (firstInstance != UINT32_MAX)
+				{
+					m_Draws[kept] = m_Draws[first];
+					m_Draws[kept].InstanceCount = last - first;
+					m_Draws[kept].InstanceOffset = firstInstance;
+					m_SortKeys[kept] = m_SortKeys[first];
+					kept++;
+				}
+				else
+				{
+					for (uint32_t i = first; i < last; i++, kept++)
+					{
+						m_Draws[kept] = m_Draws[i];
+						m_SortKeys[kept] = m_SortKeys[i];
+					}
+				}
+
+				first = last;
+			}
+
+			const uint32_t removed = count - kept;
+			m_Draws.resize(kept);
+			m_SortKeys.resize(kept);
+
+			return removed;
+		}
+
+		void SetSortOrder(DrawSortOrder order) { m_SortOrder = order; }
+		DrawSortOrder GetSortOrder() const { return m_SortOrder; }
+
+		static uint64_t MakeSortKey(const LocalDrawStream& draw, float depth, DrawSortOrder order);
+
+		/**
+		 * @brief Whether two single instance draws can be issued as one instanced draw, i.e. both are instanceable and only differ in their per draw data.
+		 */
+		static bool CanShareInstances(const LocalDrawStream& a, const LocalDrawStream& b);
+
 		const uint32_t GetCount() const { return (uint32_t)m_Draws.size(); }
 		const Span<const LocalDrawStream> GetDraws() const { return { m_Draws.data(), m_Draws.size() }; }
 
 	private:
 		DArray<LocalDrawStream> m_Draws = MakeEmptyDArray<LocalDrawStream>();
+		DArray<uint64_t> m_SortKeys = MakeEmptyDArray<uint64_t>();
+		DrawSortOrder m_SortOrder = DrawSortOrder::FrontToBack;
 	};
 }
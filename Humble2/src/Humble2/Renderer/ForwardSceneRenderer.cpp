@@ -4,7 +4,10 @@
 #include "Core/Context.h"
 #include "Renderer/DebugRenderer.h"
 #include "Renderer/Device.h"
+#include "Renderer/FrustumCulling.h"
+#include "Utilities/JobSystem.h"
 #include "Utilities/ShaderUtilities.h"
+#include "Utilities/Collections/HashMap.h"
 
 #include <glm/gtx/euler_angles.hpp>
 
@@ -72,32 +75,54 @@ namespace HBL2
 		}
 	};
 
-	using packed_size = ShaderDescriptor::RenderPipeline::packed_size;
+	// A static mesh with its assets and shader variant resolved on the game thread, the rest of its gathering runs on the job system.
+	struct StaticMeshGatherItem
+	{
+		Entity Owner = Entity::Null;
+		const Component::Transform* Transform = nullptr;
+		Handle<Mesh> MeshHandle;
+		Handle<Material> MaterialHandle;
+		uint64_t VariantHandle = 0;
+		uint32_t MeshIndex = 0;
+		uint32_t SubMeshIndex = 0;
+	};
 
-	void ForwardSceneRenderer::Initialize(Scene* scene)
+	// What the job produced for an item, written to the item's own slot so workers never share memory.
+	struct StaticMeshGatherResult
 	{
-		// Each draw list is pre allocated with ~2MB of space (~32K draws), we have 16 draw lists, 8 for each renderData in flight.
-		// So, for the draw lists we need ~32MB.
-		m_Reservation = Allocator::Arena.Reserve("ForwardSceneRendererPool", (Renderer::Instance->FrameCount * 8 * 2_MB) + 32_MB);
-		m_Arena.Initialize(&Allocator::Arena, (Renderer::Instance->FrameCount * 8 * 2_MB) + 32_MB, m_Reservation);
+		LocalDrawStream Draw;
+		glm::vec3 Center = glm::vec3(0.0f);
+		float Depth = 0.0f;
+		uint32_t CasterMask = 0;
+		bool Visible = false;
+		bool Opaque = false;
+		bool DrawDataDirty = false;
+		bool DrawDataPending = false; // No scene buffer slot, the draw data is bump allocated once the whole range is gathered.
+	};
 
-		for (auto& sceneRenderData : m_RenderData)
-		{
-			sceneRenderData.m_PrePassSpriteDraws.Initialize(m_Arena);
-			sceneRenderData.m_PrePassStaticMeshDraws.Initialize(m_Arena);
-			sceneRenderData.m_ShadowPassSpriteDraws.Initialize(m_Arena);
-			sceneRenderData.m_ShadowPassStaticMeshDraws.Initialize(m_Arena);
-			sceneRenderData.m_SpriteOpaqueDraws.Initialize(m_Arena);
-			sceneRenderData.m_SpriteTransparentDraws.Initialize(m_Arena);
-			sceneRenderData.m_StaticMeshOpaqueDraws.Initialize(m_Arena);
-			sceneRenderData.m_StaticMeshTransparentDraws.Initialize(m_Arena);
-		}
+	using packed_size = ShaderDescriptor::RenderPipeline::packed_size;
 
+	void ForwardSceneRenderer::Initialize(Scene* scene)
+	{
 		m_Scene = scene;
 
 		m_ResourceManager = ResourceManager::Instance;
 		m_EditorScene = m_ResourceManager->GetScene(Context::EditorScene);
 		m_UniformRingBuffer = Renderer::Instance->TempUniformRingBuffer;
+		m_InstanceRingBuffer = Renderer::Instance->TempInstanceRingBuffer;
+
+		// Each frame in flight has its own copy of the scene buffer, so a slot is rewritten only while that copy is not in use.
+		m_SceneBufferCapacity = (m_UniformRingBuffer->GetPersistentSize() / Renderer::FrameCount) / m_UniformRingBuffer->GetAlignedSize(sizeof(PerDrawData));
+		m_SceneBufferSlotCount = 0;
+		m_SceneBufferSlotOwners.clear();
+		m_FreeSceneBufferSlots.clear();
+		m_StaticMeshDrawCache.clear();
+
+		// The OpenGL backend does not bind storage buffers, its shaders light from the light data alone.
+		if (Renderer::Instance->GetAPI() == GraphicsAPI::OPENGL)
+		{
+			m_ClusteredLighting = false;
+		}
 
 		// Create color render pass.
 		m_RenderPassLayout = m_ResourceManager->CreateRenderPassLayout({
@@ -123,6 +148,7 @@ namespace HBL2
 			.layout = Renderer::Instance->GetDynamicBindingsLayout(),
 			.buffers = {
 				{ .buffer = Renderer::Instance->TempUniformRingBuffer->GetBuffer(), .range = sizeof(PerDrawData) },
+				{ .buffer = Renderer::Instance->TempInstanceRingBuffer->GetBuffer(), .range = Renderer::Instance->TempInstanceRingBuffer->GetBufferSize() },
 			}
 		});
 
@@ -131,6 +157,7 @@ namespace HBL2
 			.layout = Renderer::Instance->GetDynamicBindingsLayout(),
 			.buffers = {
 				{ .buffer = Renderer::Instance->TempUniformRingBuffer->GetBuffer(), .range = sizeof(PerDrawDataSprite) },
+				{ .buffer = Renderer::Instance->TempInstanceRingBuffer->GetBuffer(), .range = Renderer::Instance->TempInstanceRingBuffer->GetBufferSize() },
 			}
 		});
 
@@ -146,12 +173,49 @@ namespace HBL2
 
 	void ForwardSceneRenderer::Gather(Entity mainCamera)
 	{
-		SceneRenderData* sceneRenderData = &m_RenderData[Renderer::Instance->GetFrameWriteIndex()];
+		SceneRenderData* sceneRenderData = AllocateRenderData();
 
 		GetViewProjection(sceneRenderData, mainCamera);
 
-		GatherDraws(sceneRenderData);
+		// Lights first, the draws cull shadow casters against the light space matrices.
 		GatherLights(sceneRenderData);
+		GatherDraws(sceneRenderData);
+
+		const auto drawLists = sceneRenderData->GetDrawLists();
+
+		for (uint32_t i = 0; i < SceneRenderData::DrawListCount; i++)
+		{
+			m_DrawCountHints[i] = drawLists[i]->GetCount();
+		}
+	}
+
+	SceneRenderData* ForwardSceneRenderer::AllocateRenderData()
+	{
+		Arena& frameArena = Renderer::Instance->GetFrameArena();
+
+		m_CurrentRenderData = frameArena.AllocConstruct<SceneRenderData>();
+
+		const auto drawLists = m_CurrentRenderData->GetDrawLists();
+
+		// Size each list from last frame (plus some headroom), instead of reserving for the worst case in every slot.
+		for (uint32_t i = 0; i < SceneRenderData::DrawListCount; i++)
+		{
+			drawLists[i]->Initialize(frameArena, std::max(64u, m_DrawCountHints[i] + m_DrawCountHints[i] / 4));
+		}
+
+		m_CurrentRenderData->m_StaticMeshTransparentDraws.SetSortOrder(DrawSortOrder::BackToFront);
+		m_CurrentRenderData->m_SpriteTransparentDraws.SetSortOrder(DrawSortOrder::BackToFront);
+
+		m_CurrentRenderData->m_LightSpaceMatricesData = MakeDArray<uint8_t>(frameArena);
+
+		if (m_ClusteredLighting)
+		{
+			m_CurrentRenderData->m_ClusterLights = MakeDArrayResized<ClusterLight>(frameArena, LightClusters::MaxLights);
+			m_CurrentRenderData->m_ClusterRanges = MakeDArrayResized<glm::uvec2>(frameArena, LightClusters::ClusterCount);
+			m_CurrentRenderData->m_ClusterLightIndices = MakeDArrayResized<uint32_t>(frameArena, LightClusters::MaxLightIndices);
+		}
+
+		return m_CurrentRenderData;
 	}
 
 	void ForwardSceneRenderer::Render(void* renderData, void* debugRenderData)
@@ -165,6 +229,18 @@ namespace HBL2
 		// Map dynamic uniform buffer data (i.e.: Bump allocated per object data)
 		rm->MapBufferData(uniformRingBuffer->GetBuffer(), sceneRenderData->m_UBOStartingOffset, sceneRenderData->m_UBOEndingOffset - sceneRenderData->m_UBOStartingOffset);
 
+		// Map the per instance data of the merged draws.
+		if (sceneRenderData->m_InstanceEndingOffset > sceneRenderData->m_InstanceStartingOffset)
+		{
+			rm->MapBufferData(m_InstanceRingBuffer->GetBuffer(), sceneRenderData->m_InstanceStartingOffset, sceneRenderData->m_InstanceEndingOffset - sceneRenderData->m_InstanceStartingOffset);
+		}
+
+		// Map only the draw data that changed in the scene buffer, the rest is still on the GPU from earlier frames.
+		for (const glm::uvec2& upload : sceneRenderData->m_SceneBufferUploads)
+		{
+			rm->MapBufferData(uniformRingBuffer->GetBuffer(), upload.x, upload.y);
+		}
+
 		CommandBuffer* commandBuffer = Renderer::Instance->BeginCommandRecording(CommandBufferType::MAIN);
 
 		rm->TransitionTextureLayout(commandBuffer, Renderer::Instance->IntermediateColorTexture, ResourceState::Undefined, ResourceState::RenderTarget);
@@ -298,7 +374,7 @@ namespace HBL2
 
 	void* ForwardSceneRenderer::GetRenderData()
 	{
-		return &m_RenderData[Renderer::Instance->GetFrameWriteIndex()];
+		return m_CurrentRenderData;
 	}
 
 	// Pass setup.
@@ -961,18 +1037,64 @@ namespace HBL2
 		// Store the offset that the objects start from in the dynamic uniform buffer.
 		sceneRenderData->m_UBOStartingOffset = m_UniformRingBuffer->GetCurrentOffset();
 
+		const CullingFrustum cullingFrustum(sceneRenderData->m_CameraFrustum);
+		const glm::vec3 cameraPosition = glm::vec3(sceneRenderData->m_LightData.ViewPosition);
+
+		// Each shadow casting light renders its tile with its light space matrix, so casters are culled per light against it.
+		CullingFrustum shadowFrustums[SceneRenderData::MaxShadowLights];
+		uint32_t shadowLightIndices[SceneRenderData::MaxShadowLights];
+		uint32_t shadowLightCount = 0;
+
+		const uint32_t lightCount = std::min((uint32_t)sceneRenderData->m_LightData.LightCount, SceneRenderData::MaxShadowLights);
+
+		for (uint32_t lightIndex = 0; lightIndex < lightCount; lightIndex++)
+		{
+			sceneRenderData->m_ShadowCasterDraws[lightIndex].Reset();
+
+			if (sceneRenderData->m_LightData.LightShadowData[lightIndex].x != 0.0f)
+			{
+				shadowFrustums[shadowLightCount] = CullingFrustum(sceneRenderData->m_LightData.LightSpaceMatrices[lightIndex]);
+				shadowLightIndices[shadowLightCount] = lightIndex;
+				shadowLightCount++;
+			}
+		}
+
 		// Static meshes
 		{
 			uint64_t depthOnlyVariantHandle = ResourceManager::Instance->GetOrAddShaderVariant(m_DepthOnlyShader, m_DepthOnlyMaterialHash);
 			uint64_t shadowPrePassVariantHandle = ResourceManager::Instance->GetOrAddShaderVariant(m_ShadowPrePassShader, m_ShadowPrePassMaterialHash);
+			Handle<BindGroup> emptyBindings = Renderer::Instance->GetEmptyBindings();
 
 			sceneRenderData->m_StaticMeshOpaqueDraws.Reset();
 			sceneRenderData->m_StaticMeshTransparentDraws.Reset();
 			sceneRenderData->m_PrePassStaticMeshDraws.Reset();
-			sceneRenderData->m_ShadowPassStaticMeshDraws.Reset();
+
+			ScratchArena scratch(Allocator::FrameArenaMT);
+
+			// Static draw data lives at a stable slot of the scene buffer, in the copy of the frame being gathered.
+			const uint32_t sceneBufferStride = m_UniformRingBuffer->GetAlignedSize(sizeof(PerDrawData));
+			const uint32_t sceneBufferCopy = Renderer::Instance->GetFrameWriteIndex();
+			const uint32_t sceneBufferCopyOffset = m_UniformRingBuffer->GetPersistentOffset() + sceneBufferCopy * (m_UniformRingBuffer->GetPersistentSize() / Renderer::FrameCount);
+
+			// When another renderer wrote the scene buffer since this one last did, none of the copies can be trusted.
+			if (m_UniformRingBuffer->ClaimPersistentRegion(this))
+			{
+				for (StaticMeshDrawCacheEntry& cached : m_StaticMeshDrawCache)
+				{
+					cached.UploadedCopies = 0;
+				}
+			}
+
+			// Resolve the assets here since that can load them, everything else is gathered in parallel below.
+			DArray<StaticMeshGatherItem> items = MakeDArray<StaticMeshGatherItem>(scratch, std::max(64u, m_DrawCountHints[0] + m_DrawCountHints[1]));
+			const uint32_t gatherStamp = ++m_GatherStamp;
+
+			// Variants can be created (and compiled) on a miss, which the backends only support on this thread, so each material
+			// is resolved here once and the jobs below only read resources.
+			HashMap<uint32_t, uint64_t> variantHandles(scratch.GetArena(), 64);
 
 			m_Scene->Filter<Component::StaticMesh, Component::Transform>()
-				.ForEach([&](Component::StaticMesh& staticMesh, Component::Transform& transform)
+				.ForEach([&](Entity entity, Component::StaticMesh& staticMesh, Component::Transform& transform)
 				{
 					if (staticMesh.Enabled)
 					{
@@ -981,116 +1103,327 @@ namespace HBL2
 							return;
 						}
 
-						Handle<Material> materialHandle = AssetManager::Instance->GetAsset<Material>(staticMesh.Material);
-						Material* material = ResourceManager::Instance->GetMaterial(materialHandle);
-
-						Handle<Mesh> meshHandle = AssetManager::Instance->GetAsset<Mesh>(staticMesh.Mesh);
-						Mesh* mesh = ResourceManager::Instance->GetMesh(meshHandle);
-
-						if (mesh == nullptr || mesh->IsEmpty())
+						if ((uint32_t)entity.Idx >= m_StaticMeshDrawCache.size())
 						{
-							return;
+							m_StaticMeshDrawCache.resize((uint32_t)entity.Idx + 1);
 						}
 
-						const auto& meshPart = mesh->Meshes[staticMesh.MeshIndex];
+						// Slots follow the entity index and are kept while a static mesh is gathered at it, once the scene buffer
+						// is full the draw data is bump allocated until a slot is released.
+						StaticMeshDrawCacheEntry& cached = m_StaticMeshDrawCache[entity.Idx];
+						cached.GatherStamp = gatherStamp;
 
-						if (meshPart.IsEmpty())
+						if (cached.DrawDataSlot == UINT32_MAX)
 						{
-							return;
+							if (!m_FreeSceneBufferSlots.empty())
+							{
+								cached.DrawDataSlot = m_FreeSceneBufferSlots.back();
+								m_FreeSceneBufferSlots.pop_back();
+							}
+							else if (m_SceneBufferSlotCount < m_SceneBufferCapacity)
+							{
+								cached.DrawDataSlot = m_SceneBufferSlotCount++;
+								m_SceneBufferSlotOwners.push_back(UINT32_MAX);
+							}
+
+							if (cached.DrawDataSlot != UINT32_MAX)
+							{
+								m_SceneBufferSlotOwners[cached.DrawDataSlot] = (uint32_t)entity.Idx;
+								cached.UploadedCopies = 0;
+							}
 						}
 
-						const auto& subMesh = meshPart.SubMeshes[staticMesh.SubMeshIndex];
+						const Handle<Material> materialHandle = AssetManager::Instance->GetAsset<Material>(staticMesh.Material);
 
-						if (material == nullptr)
+						auto variant = variantHandles.find(materialHandle.Pack());
+						if (variant == variantHandles.end())
 						{
-							return;
+							const Material* material = ResourceManager::Instance->GetMaterial(materialHandle);
+							variantHandles[materialHandle.Pack()] = (material != nullptr ? ResourceManager::Instance->GetOrAddShaderVariant(material->Shader, material->VariantHash) : 0);
+							variant = variantHandles.find(materialHandle.Pack());
+
+							ResourceManager::Instance->MarkReferenced(materialHandle);
 						}
 
-						// Bump allocate and set per draw data.
-						auto alloc = m_UniformRingBuffer->BumpAllocate<PerDrawData>();
-						alloc.Data->Model = transform.WorldMatrix;
-						alloc.Data->InverseModel = glm::transpose(glm::inverse(glm::mat3(transform.WorldMatrix)));
-						alloc.Data->Color = glm::vec4(1.0f);
+						const Handle<Mesh> meshHandle = AssetManager::Instance->GetAsset<Mesh>(staticMesh.Mesh);
+						ResourceManager::Instance->MarkReferenced(meshHandle);
+
+						items.push_back({
+							.Owner = entity,
+							.Transform = &transform,
+							.MeshHandle = meshHandle,
+							.MaterialHandle = materialHandle,
+							.VariantHandle = variant->second,
+							.MeshIndex = staticMesh.MeshIndex,
+							.SubMeshIndex = staticMesh.SubMeshIndex,
+						});
+					}
+				});
 
-						// Fill draw lists.
-						if (!material->VariantHash.blendEnabled)
-						{
-							sceneRenderData->m_StaticMeshOpaqueDraws.Insert({
-								.Shader = material->Shader,
-								.VariantHandle = ResourceManager::Instance->GetOrAddShaderVariant(material->Shader, material->VariantHash),
-								.IndexBuffer = meshPart.IndexBuffer,
-								.VertexBuffer = meshPart.VertexBuffers[0],
-								.MaterialBindGroup = material->MaterialBindGroup,
-								.BindGroup = material->DrawBindGroup,
-								.Size = sizeof(PerDrawData),
-								.Offset = alloc.Offset,
-								.IndexCount = subMesh.IndexCount,
-								.IndexOffset = subMesh.IndexOffset,
-								.VertexCount = subMesh.VertexCount,
-								.VertexOffset = subMesh.VertexOffset,
-								.InstanceCount = subMesh.InstanceCount,
-								.InstanceOffset = subMesh.InstanceOffset,
-							});
+			// Release the slots of entities that were destroyed or no longer have an enabled static mesh.
+			for (uint32_t slot = 0; slot < m_SceneBufferSlotCount; slot++)
+			{
+				const uint32_t owner = m_SceneBufferSlotOwners[slot];
 
-							// Include only opaque objects in depth pre-pass.
-							sceneRenderData->m_PrePassStaticMeshDraws.Insert({
-								.Shader = m_DepthOnlyShader,
-								.VariantHandle = depthOnlyVariantHandle,
-								.IndexBuffer = meshPart.IndexBuffer,
-								.VertexBuffer = meshPart.VertexBuffers[0],
-								.MaterialBindGroup = Renderer::Instance->GetEmptyBindings(),
-								.BindGroup = m_DepthOnlyMeshBindGroup,
-								.Size = sizeof(PerDrawData),
-								.Offset = alloc.Offset,
-								.IndexCount = subMesh.IndexCount,
-								.IndexOffset = subMesh.IndexOffset,
-								.VertexCount = subMesh.VertexCount,
-								.VertexOffset = subMesh.VertexOffset,
-								.InstanceCount = subMesh.InstanceCount,
-								.InstanceOffset = subMesh.InstanceOffset,
-							});
-						}
-						else
-						{
-							sceneRenderData->m_StaticMeshTransparentDraws.Insert({
-								.Shader = material->Shader,
-								.VariantHandle = ResourceManager::Instance->GetOrAddShaderVariant(material->Shader, material->VariantHash),
-								.IndexBuffer = meshPart.IndexBuffer,
-								.VertexBuffer = meshPart.VertexBuffers[0],
-								.MaterialBindGroup = material->MaterialBindGroup,
-								.BindGroup = material->DrawBindGroup,
-								.Size = sizeof(PerDrawData),
-								.Offset = alloc.Offset,
-								.IndexCount = subMesh.IndexCount,
-								.IndexOffset = subMesh.IndexOffset,
-								.VertexCount = subMesh.VertexCount,
-								.VertexOffset = subMesh.VertexOffset,
-								.InstanceCount = subMesh.InstanceCount,
-								.InstanceOffset = subMesh.InstanceOffset,
-							});
-						}
+				if (owner != UINT32_MAX && m_StaticMeshDrawCache[owner].GatherStamp != gatherStamp)
+				{
+					m_StaticMeshDrawCache[owner].DrawDataSlot = UINT32_MAX;
+					m_SceneBufferSlotOwners[slot] = UINT32_MAX;
+					m_FreeSceneBufferSlots.push_back(slot);
+				}
+			}
 
-						if (material->ReceiveShadows)
+			DArray<StaticMeshGatherResult> results = MakeDArrayResized<StaticMeshGatherResult>(scratch, items.size());
+
+			const auto gatherItem = [&](uint32_t itemIndex)
+			{
+				const StaticMeshGatherItem& item = items[itemIndex];
+				StaticMeshGatherResult& result = results[itemIndex];
+
+				Material* material = ResourceManager::Instance->GetMaterial(item.MaterialHandle);
+				Mesh* mesh = ResourceManager::Instance->GetMesh(item.MeshHandle);
+
+				if (mesh == nullptr || mesh->IsEmpty() || material == nullptr)
+				{
+					return;
+				}
+
+				const glm::mat4& worldMatrix = item.Transform->WorldMatrix;
+
+				// Unchanged entities (the static majority) reuse their bounds, inverse model and mesh part from earlier frames.
+				StaticMeshDrawCacheEntry& cached = m_StaticMeshDrawCache[item.Owner.Idx];
+				const uint32_t meshVersion = mesh->GetVersion();
+
+				const bool cacheHit = cached.EntityGeneration == item.Owner.Gen
+					&& cached.MeshHandle == item.MeshHandle
+					&& cached.MeshVersion == meshVersion
+					&& cached.MeshIndex == item.MeshIndex
+					&& cached.SubMeshIndex == item.SubMeshIndex
+					&& std::memcmp(&cached.WorldMatrix, &worldMatrix, sizeof(glm::mat4)) == 0;
+
+				if (!cacheHit)
+				{
+					const auto& meshPart = mesh->Meshes[item.MeshIndex];
+
+					if (meshPart.IsEmpty())
+					{
+						cached.EntityGeneration = -1;
+						return;
+					}
+
+					const auto& subMesh = meshPart.SubMeshes[item.SubMeshIndex];
+
+					cached.EntityGeneration = item.Owner.Gen;
+					cached.UploadedCopies = 0;
+					cached.MeshHandle = item.MeshHandle;
+					cached.MeshVersion = meshVersion;
+					cached.MeshIndex = item.MeshIndex;
+					cached.SubMeshIndex = item.SubMeshIndex;
+					cached.WorldMatrix = worldMatrix;
+
+					cached.InverseModel = glm::transpose(glm::inverse(glm::mat3(worldMatrix)));
+					cached.Bounded = GetWorldBounds(subMesh.Extents.IsValid() ? subMesh.Extents : meshPart.Extents, worldMatrix, cached.BoundsCenter, cached.BoundsExtents);
+					cached.IndexBuffer = meshPart.IndexBuffer;
+					cached.VertexBuffer = meshPart.VertexBuffers[0];
+					cached.IndexCount = subMesh.IndexCount;
+					cached.IndexOffset = subMesh.IndexOffset;
+					cached.VertexCount = subMesh.VertexCount;
+					cached.VertexOffset = subMesh.VertexOffset;
+					cached.InstanceCount = subMesh.InstanceCount;
+					cached.InstanceOffset = subMesh.InstanceOffset;
+				}
+
+				const bool bounded = cached.Bounded;
+				const glm::vec3& boundsCenter = cached.BoundsCenter;
+				const glm::vec3& boundsExtents = cached.BoundsExtents;
+
+				const bool visible = !bounded || cullingFrustum.IsVisible(boundsCenter, boundsExtents);
+
+				// Off screen meshes can still cast shadows into view, bit i is set when the caster is inside the i-th shadow light.
+				uint32_t casterMask = 0;
+
+				if (material->ReceiveShadows)
+				{
+					for (uint32_t i = 0; i < shadowLightCount; i++)
+					{
+						const glm::vec4& sphere = sceneRenderData->m_ShadowCullingSpheres[shadowLightIndices[i]];
+
+						if (!bounded || (shadowFrustums[i].IsVisible(boundsCenter, boundsExtents) && (sphere.w == 0.0f || IntersectsSphere(boundsCenter, boundsExtents, glm::vec3(sphere), sphere.w))))
 						{
-							sceneRenderData->m_ShadowPassStaticMeshDraws.Insert({
-								.Shader = m_ShadowPrePassShader,
-								.VariantHandle = shadowPrePassVariantHandle,
-								.IndexBuffer = meshPart.IndexBuffer,
-								.VertexBuffer = meshPart.VertexBuffers[0],
-								.MaterialBindGroup = Renderer::Instance->GetEmptyBindings(),
-								.BindGroup = m_DepthOnlyMeshBindGroup,
-								.Size = sizeof(PerDrawData),
-								.Offset = alloc.Offset,
-								.IndexCount = subMesh.IndexCount,
-								.IndexOffset = subMesh.IndexOffset,
-								.VertexCount = subMesh.VertexCount,
-								.VertexOffset = subMesh.VertexOffset,
-								.InstanceCount = subMesh.InstanceCount,
-								.InstanceOffset = subMesh.InstanceOffset,
-							});
+							casterMask |= (1u << i);
 						}
 					}
-				});
+				}
+
+				if (!visible && casterMask == 0)
+				{
+					return;
+				}
+
+				// Write the per draw data to the entity's scene buffer slot when that copy is stale, bump allocate it later when there is no slot.
+				uint32_t drawDataOffset = 0;
+
+				if (cached.DrawDataSlot != UINT32_MAX)
+				{
+					drawDataOffset = sceneBufferCopyOffset + cached.DrawDataSlot * sceneBufferStride;
+
+					if ((cached.UploadedCopies & (1u << sceneBufferCopy)) == 0)
+					{
+						PerDrawData* drawData = m_UniformRingBuffer->GetPersistentData<PerDrawData>(drawDataOffset);
+						drawData->Model = worldMatrix;
+						drawData->InverseModel = cached.InverseModel;
+						drawData->Color = glm::vec4(1.0f);
+
+						cached.UploadedCopies |= (1u << sceneBufferCopy);
+						result.DrawDataDirty = true;
+					}
+				}
+				else
+				{
+					result.DrawDataPending = true;
+				}
+
+				result.Center = bounded ? boundsCenter : glm::vec3(worldMatrix[3]);
+				result.Depth = glm::distance(cameraPosition, result.Center);
+				result.Visible = visible;
+				result.Opaque = !material->VariantHash.blendEnabled;
+				result.CasterMask = casterMask;
+				result.Draw = {
+					.Shader = material->Shader,
+					.VariantHandle = visible ? item.VariantHandle : 0,
+					.IndexBuffer = cached.IndexBuffer,
+					.VertexBuffer = cached.VertexBuffer,
+					.MaterialBindGroup = material->MaterialBindGroup,
+					.BindGroup = material->DrawBindGroup,
+					.Size = sizeof(PerDrawData),
+					.Offset = drawDataOffset,
+					.IndexCount = cached.IndexCount,
+					.IndexOffset = cached.IndexOffset,
+					.VertexCount = cached.VertexCount,
+					.VertexOffset = cached.VertexOffset,
+					.InstanceCount = cached.InstanceCount,
+					.InstanceOffset = cached.InstanceOffset,
+					.Instanceable = material->Instancing,
+				};
+			};
+
+			JobSystem::Get().ParallelForRange(0, (uint32_t)items.size(), [&](uint32_t rangeBegin, uint32_t rangeEnd)
+			{
+				uint32_t pendingCount = 0;
+
+				for (uint32_t itemIndex = rangeBegin; itemIndex < rangeEnd; ++itemIndex)
+				{
+					gatherItem(itemIndex);
+					pendingCount += results[itemIndex].DrawDataPending ? 1 : 0;
+				}
+
+				if (pendingCount == 0)
+				{
+					return;
+				}
+
+				// One reservation sized to what the range actually draws, so nothing is left unused in the ring.
+				auto alloc = m_UniformRingBuffer->BumpAllocateElements<PerDrawData>(pendingCount);
+				uint32_t pendingIndex = 0;
+
+				for (uint32_t itemIndex = rangeBegin; itemIndex < rangeEnd; ++itemIndex)
+				{
+					StaticMeshGatherResult& result = results[itemIndex];
+
+					if (!result.DrawDataPending)
+					{
+						continue;
+					}
+
+					// The ring is full, drop the draw rather than point it at data that was never written.
+					if (alloc.Data == nullptr)
+					{
+						result.Visible = false;
+						result.CasterMask = 0;
+						continue;
+					}
+
+					const StaticMeshGatherItem& item = items[itemIndex];
+					const uint32_t elementOffset = pendingIndex++ * sceneBufferStride;
+
+					PerDrawData* drawData = (PerDrawData*)((char*)alloc.Data + elementOffset);
+					drawData->Model = item.Transform->WorldMatrix;
+					drawData->InverseModel = m_StaticMeshDrawCache[item.Owner.Idx].InverseModel;
+					drawData->Color = glm::vec4(1.0f);
+
+					result.Draw.Offset = alloc.Offset + elementOffset;
+				}
+			});
+
+			sceneRenderData->m_SceneBufferUploads = MakeDArray<glm::uvec2>(Renderer::Instance->GetFrameArena());
+
+			// Fill draw lists, in entity order so the result does not depend on how the jobs were scheduled.
+			for (uint32_t itemIndex = 0; itemIndex < results.size(); ++itemIndex)
+			{
+				const StaticMeshGatherResult& result = results[itemIndex];
+
+				// Marked here rather than in the jobs, so they stay read only towards the resource manager.
+				if (result.Visible || result.CasterMask != 0)
+				{
+					ResourceManager::Instance->MarkUsed(items[itemIndex].MeshHandle);
+				}
+
+				if (result.Visible)
+				{
+					ResourceManager::Instance->MarkUsed(items[itemIndex].MaterialHandle);
+				}
+
+				// Collect the rewritten slots for upload, merging neighbours since slots are mostly handed out in entity order.
+				if (result.DrawDataDirty)
+				{
+					DArray<glm::uvec2>& uploads = sceneRenderData->m_SceneBufferUploads;
+
+					if (!uploads.empty() && uploads.back().x + uploads.back().y == result.Draw.Offset)
+					{
+						uploads.back().y += sceneBufferStride;
+					}
+					else
+					{
+						uploads.push_back({ result.Draw.Offset, sceneBufferStride });
+					}
+				}
+
+				if (result.Visible && result.Opaque)
+				{
+					sceneRenderData->m_StaticMeshOpaqueDraws.Insert(LocalDrawStream(result.Draw), result.Depth);
+
+					// Include only opaque objects in depth pre-pass.
+					LocalDrawStream prePassDraw = result.Draw;
+					prePassDraw.Shader = m_DepthOnlyShader;
+					prePassDraw.VariantHandle = depthOnlyVariantHandle;
+					prePassDraw.MaterialBindGroup = emptyBindings;
+					prePassDraw.BindGroup = m_DepthOnlyMeshBindGroup;
+					prePassDraw.Instanceable = false;
+					sceneRenderData->m_PrePassStaticMeshDraws.Insert(std::move(prePassDraw), result.Depth);
+				}
+				else if (result.Visible)
+				{
+					sceneRenderData->m_StaticMeshTransparentDraws.Insert(LocalDrawStream(result.Draw), result.Depth);
+				}
+
+				for (uint32_t i = 0; i < shadowLightCount; i++)
+				{
+					if ((result.CasterMask & (1u << i)) == 0)
+					{
+						continue;
+					}
+
+					const uint32_t lightIndex = shadowLightIndices[i];
+
+					LocalDrawStream shadowDraw = result.Draw;
+					shadowDraw.Shader = m_ShadowPrePassShader;
+					shadowDraw.VariantHandle = shadowPrePassVariantHandle;
+					shadowDraw.MaterialBindGroup = emptyBindings;
+					shadowDraw.BindGroup = m_DepthOnlyMeshBindGroup;
+					shadowDraw.Instanceable = false;
+					sceneRenderData->m_ShadowCasterDraws[lightIndex].Insert(std::move(shadowDraw), glm::distance(glm::vec3(sceneRenderData->m_ShadowCullingSpheres[lightIndex]), result.Center));
+				}
+			}
 		}
 
 		// Sprites
@@ -1101,6 +1434,8 @@ namespace HBL2
 			sceneRenderData->m_SpriteTransparentDraws.Reset();
 			sceneRenderData->m_PrePassSpriteDraws.Reset();
 
+			const MeshExtents spriteExtents = { { -0.5f, -0.5f, 0.0f }, { 0.5f, 0.5f, 0.0f } };
+
 			m_Scene->Filter<Component::Sprite, Component::Transform>()
 				.ForEach([&](Component::Sprite& sprite, Component::Transform& transform)
 				{
@@ -1119,8 +1454,23 @@ namespace HBL2
 							return;
 						}
 
+						if (!cullingFrustum.IsVisible(spriteExtents, transform.WorldMatrix))
+						{
+							return;
+						}
+
+						ResourceManager::Instance->MarkUsed(materialHandle);
+
+						const float depth = glm::distance(cameraPosition, glm::vec3(transform.WorldMatrix[3]));
+
 						// Bump allocate and set per draw data.
 						auto alloc = m_UniformRingBuffer->BumpAllocate<PerDrawDataSprite>();
+
+						if (alloc.Data == nullptr)
+						{
+							return;
+						}
+
 						alloc.Data->Model = transform.WorldMatrix;
 						alloc.Data->Color = glm::vec4(1.0f);
 
@@ -1136,7 +1486,7 @@ namespace HBL2
 								.Size = sizeof(PerDrawDataSprite),
 								.Offset = alloc.Offset,
 								.VertexCount = 6,
-							});
+							}, depth);
 
 							// Include only opaque objects in depth pre-pass.
 							sceneRenderData->m_PrePassSpriteDraws.Insert({
@@ -1148,7 +1498,7 @@ namespace HBL2
 								.Size = sizeof(PerDrawDataSprite),
 								.Offset = alloc.Offset,
 								.VertexCount = 6,
-							});
+							}, depth);
 						}
 						else
 						{
@@ -1161,7 +1511,7 @@ namespace HBL2
 								.Size = sizeof(PerDrawDataSprite),
 								.Offset = alloc.Offset,
 								.VertexCount = 6,
-							});
+							}, depth);
 						}
 					}
 				});
@@ -1177,68 +1527,131 @@ namespace HBL2
 			sceneRenderData->m_StaticMeshOpaqueDraws.Sort();
 			sceneRenderData->m_PrePassStaticMeshDraws.Sort();
 			sceneRenderData->m_StaticMeshTransparentDraws.Sort();
-			sceneRenderData->m_ShadowPassStaticMeshDraws.Sort();
 			sceneRenderData->m_SpriteOpaqueDraws.Sort();
 			sceneRenderData->m_PrePassSpriteDraws.Sort();
 			sceneRenderData->m_SpriteTransparentDraws.Sort();
 
+			for (uint32_t lightIndex = 0; lightIndex < lightCount; lightIndex++)
+			{
+				sceneRenderData->m_ShadowCasterDraws[lightIndex].Sort();
+			}
+
+			MergeInstances(sceneRenderData);
+
 			END_PROFILE_PASS(Renderer::Instance->GetStats().SortingTime);
 		}
 	}
 
+	void ForwardSceneRenderer::MergeInstances(SceneRenderData* sceneRenderData)
+	{
+		sceneRenderData->m_InstanceStartingOffset = m_InstanceRingBuffer->GetCurrentOffset();
+		sceneRenderData->m_InstanceEndingOffset = sceneRenderData->m_InstanceStartingOffset;
+
+		// The OpenGL backend issues every draw as a single instance.
+		if (Renderer::Instance->GetAPI() == GraphicsAPI::OPENGL)
+		{
+			return;
+		}
+
+		// Copies the per draw data of a run next to each other, the shader indexes it with the instance index (first instance included).
+		auto placeInstances = [this](Span<const LocalDrawStream> run) -> uint32_t
+		{
+			// One spare record, so the run can start on a record boundary whatever the ring offset is.
+			auto alloc = m_InstanceRingBuffer->BumpAllocate<PerDrawData>((uint32_t)run.Size() + 1);
+
+			if (alloc.Data == nullptr)
+			{
+				return UINT32_MAX;
+			}
+
+			const uint32_t firstOffset = UniformRingBuffer::CeilToNextMultiple(alloc.Offset, (uint32_t)sizeof(PerDrawData));
+			PerDrawData* instances = (PerDrawData*)((char*)alloc.Data + (firstOffset - alloc.Offset));
+
+			for (uint32_t i = 0; i < run.Size(); i++)
+			{
+				instances[i] = *m_UniformRingBuffer->GetData<PerDrawData>(run[i].Offset);
+			}
+
+			return firstOffset / (uint32_t)sizeof(PerDrawData);
+		};
+
+		// Only material draws, the depth only shaders of the pre-pass and the shadow pass read a single draw.
+		sceneRenderData->m_StaticMeshOpaqueDraws.MergeInstances(placeInstances);
+		sceneRenderData->m_StaticMeshTransparentDraws.MergeInstances(placeInstances);
+
+		sceneRenderData->m_InstanceEndingOffset = m_InstanceRingBuffer->GetCurrentOffset();
+	}
+
 	void ForwardSceneRenderer::GatherLights(SceneRenderData* sceneRenderData)
 	{
 		sceneRenderData->m_LightData.LightCount = 0;
 
+		uint32_t clusterLightCount = 0;
+
 		m_Scene->Filter<Component::Light, Component::Transform>()
 			.ForEach([&](Component::Light& light, Component::Transform& transform)
 			{
-				if (light.Enabled)
+				if (!light.Enabled)
 				{
-					float lightType = 0.0f;
+					return;
+				}
 
-					const Attenuation& attenuation = GetClosestAttenuation(light.Distance);
+				const bool bounded = (light.Type != Component::Light::EType::Directional);
 
-					int lightIndex = (int)sceneRenderData->m_LightData.LightCount;
+				// The light data holds the first lights (directional and shadowed ones included), clustered lighting takes every bounded light.
+				const bool inLightData = sceneRenderData->m_LightData.LightCount < SceneRenderData::MaxShadowLights;
+				const bool inClusters = m_ClusteredLighting && bounded && clusterLightCount < LightClusters::MaxLights;
 
-					sceneRenderData->m_LightData.LightShadowData[lightIndex].x = light.CastsShadows ? 1.0f : 0.0f;
+				if (!inLightData && !inClusters)
+				{
+					return;
+				}
 
-					switch (light.Type)
-					{
-					case Component::Light::EType::Directional:
-						lightType = 0.0f;
-						sceneRenderData->m_LightData.LightShadowData[lightIndex].y = light.ConstantBias;
-						sceneRenderData->m_LightData.LightShadowData[lightIndex].z = light.SlopeBias;
-						sceneRenderData->m_LightData.LightShadowData[lightIndex].w = light.NormalOffsetScale;
-						break;
-					case Component::Light::EType::Point:
-						lightType = 1.0f;
-						sceneRenderData->m_LightData.LightMetadata[lightIndex].y = attenuation.constant;
-						sceneRenderData->m_LightData.LightMetadata[lightIndex].z = attenuation.linear;
-						sceneRenderData->m_LightData.LightMetadata[lightIndex].w = attenuation.quadratic;
-
-						sceneRenderData->m_LightData.LightShadowData[lightIndex].y = light.ConstantBias;
-						sceneRenderData->m_LightData.LightShadowData[lightIndex].z = light.SlopeBias;
-						sceneRenderData->m_LightData.LightShadowData[lightIndex].w = light.NormalOffsetScale;
-						break;
-					case Component::Light::EType::Spot:
-						lightType = 2.0f;
-						sceneRenderData->m_LightData.LightMetadata[lightIndex].y = glm::cos(glm::radians(light.InnerCutOff));
-						sceneRenderData->m_LightData.LightMetadata[lightIndex].z = glm::cos(glm::radians(light.OuterCutOff));
-
-						sceneRenderData->m_LightData.LightShadowData[lightIndex].y = light.ConstantBias;
-						sceneRenderData->m_LightData.LightShadowData[lightIndex].z = light.SlopeBias;
-						sceneRenderData->m_LightData.LightShadowData[lightIndex].w = light.NormalOffsetScale;
-						break;
-					}
+				float lightType = 0.0f;
+
+				const Attenuation& attenuation = GetClosestAttenuation(light.Distance);
+
+				glm::vec4 lightMetadata = glm::vec4(light.Intensity, 0.0f, 0.0f, 0.0f);
+
+				switch (light.Type)
+				{
+				case Component::Light::EType::Directional:
+					lightType = 0.0f;
+					break;
+				case Component::Light::EType::Point:
+					lightType = 1.0f;
+					lightMetadata.y = attenuation.constant;
+					lightMetadata.z = attenuation.linear;
+					lightMetadata.w = attenuation.quadratic;
+					break;
+				case Component::Light::EType::Spot:
+					lightType = 2.0f;
+					lightMetadata.y = glm::cos(glm::radians(light.InnerCutOff));
+					lightMetadata.z = glm::cos(glm::radians(light.OuterCutOff));
+					break;
+				}
+
+				// Calculate light forward direction.
+				glm::vec3 rotationRadians = glm::radians(transform.Rotation);
+				glm::mat4 localRotation = glm::eulerAngleYXZ(rotationRadians.y, rotationRadians.x, rotationRadians.z);
+				glm::vec3 localForward = glm::vec3(0.0f, -1.0f, 0.0f);
+				glm::vec4 rotatedDirection = localRotation * glm::vec4(localForward, 0.0f); // w = 0 to avoid translation
+				glm::mat3 worldRotation = glm::mat3(transform.WorldMatrix);// Extract rotation part of world matrix (3x3)
+				glm::vec3 worldDirection = glm::normalize(worldRotation * glm::vec3(rotatedDirection));
 
-					// Calculate light forward direction.
-					glm::vec3 rotationRadians = glm::radians(transform.Rotation);
-					glm::mat4 localRotation = glm::eulerAngleYXZ(rotationRadians.y, rotationRadians.x, rotationRadians.z);
-					glm::vec3 localForward = glm::vec3(0.0f, -1.0f, 0.0f);
-					glm::vec4 rotatedDirection = localRotation * glm::vec4(localForward, 0.0f); // w = 0 to avoid translation
-					glm::mat3 worldRotation = glm::mat3(transform.WorldMatrix);// Extract rotation part of world matrix (3x3)
-					glm::vec3 worldDirection = glm::normalize(worldRotation * glm::vec3(rotatedDirection));
+				glm::vec4 lightPosition = transform.WorldMatrix * glm::vec4(transform.Translation, 1.0f);
+				lightPosition.w = lightType;
+
+				int lightIndex = -1;
+
+				if (inLightData)
+				{
+					lightIndex = (int)sceneRenderData->m_LightData.LightCount;
+
+					sceneRenderData->m_LightData.LightShadowData[lightIndex].x = light.CastsShadows ? 1.0f : 0.0f;
+					sceneRenderData->m_LightData.LightShadowData[lightIndex].y = light.ConstantBias;
+					sceneRenderData->m_LightData.LightShadowData[lightIndex].z = light.SlopeBias;
+					sceneRenderData->m_LightData.LightShadowData[lightIndex].w = light.NormalOffsetScale;
 
 					float near_plane = 0.1f, far_plane = 1000.0f;
 					//glm::mat4 lightProjection = glm::ortho(-10.0f, 10.0f, -10.0f, 10.0f, near_plane, far_plane);
@@ -1259,15 +1672,35 @@ namespace HBL2
 
 					glm::mat4 lightView = glm::lookAt(lightPos, lightTarget, lightUp);
 
-					sceneRenderData->m_LightData.LightPositions[lightIndex] = transform.WorldMatrix * glm::vec4(transform.Translation, 1.0f);
-					sceneRenderData->m_LightData.LightPositions[lightIndex].w = lightType;
+					sceneRenderData->m_LightData.LightPositions[lightIndex] = lightPosition;
 					sceneRenderData->m_LightData.LightDirections[lightIndex] = glm::vec4(worldDirection, 0.0f);
-					sceneRenderData->m_LightData.LightMetadata[lightIndex].x = light.Intensity;
+					sceneRenderData->m_LightData.LightMetadata[lightIndex] = lightMetadata;
 					sceneRenderData->m_LightData.LightColors[lightIndex] = glm::vec4(light.Color, 1.0f);
 					sceneRenderData->m_LightData.LightSpaceMatrices[lightIndex] = lightProjection * lightView;
+					sceneRenderData->m_ShadowCullingSpheres[lightIndex] = glm::vec4(lightPos, light.Type == Component::Light::EType::Point ? light.Distance : 0.0f);
 					sceneRenderData->m_LightData.LightCount++;
 				}
+
+				if (inClusters)
+				{
+					ClusterLight& clusterLight = sceneRenderData->m_ClusterLights[clusterLightCount++];
+					clusterLight.Position = lightPosition;
+					clusterLight.Direction = glm::vec4(worldDirection, light.Distance);
+					clusterLight.Color = glm::vec4(light.Color, (lightIndex != -1 && light.CastsShadows) ? (float)lightIndex : -1.0f);
+					clusterLight.Metadata = lightMetadata;
+				}
 			});
+
+		if (m_ClusteredLighting)
+		{
+			LightClusters::Build(
+				sceneRenderData->m_CameraView,
+				sceneRenderData->m_CameraProjection,
+				Span<const ClusterLight>(sceneRenderData->m_ClusterLights.data(), clusterLightCount),
+				sceneRenderData->m_ClusterGridData,
+				sceneRenderData->m_ClusterRanges,
+				sceneRenderData->m_ClusterLightIndices);
+		}
 	}
 
 	// Pass rendering.
@@ -1288,7 +1721,7 @@ namespace HBL2
 		m_Scene->Filter<Component::Light, Component::Transform>()
 			.ForEach([&](Component::Light& light, Component::Transform& transform)
 			{
-				if (light.Enabled)
+				if (light.Enabled && index < SceneRenderData::MaxShadowLights)
 				{
 					if (light.CastsShadows)
 					{
@@ -1313,7 +1746,7 @@ namespace HBL2
 							.GlobalBufferOffset = index * alignedSize,
 							.UsesDynamicOffset = true,
 						};
-						passRenderer->DrawSubPass(globalDrawStream, sceneRenderData->m_ShadowPassStaticMeshDraws);
+						passRenderer->DrawSubPass(globalDrawStream, sceneRenderData->m_ShadowCasterDraws[index]);
 
 						commandBuffer->EndRenderPass(*passRenderer);
 					}
@@ -1387,6 +1820,7 @@ namespace HBL2
             Handle<BindGroup> globalBindings = Renderer::Instance->GetGlobalBindings3D();
             ResourceManager::Instance->SetBufferData(globalBindings, 0, (void*)&sceneRenderData->m_CameraData);
             ResourceManager::Instance->SetBufferData(globalBindings, 1, (void*)&sceneRenderData->m_LightData);
+            SetClusterBufferData(globalBindings, sceneRenderData);
             GlobalDrawStream globalDrawStream = { .BindGroup = globalBindings, .UsesDynamicOffset = true };
             passRenderer->DrawSubPass(globalDrawStream, sceneRenderData->m_StaticMeshOpaqueDraws);
         }
@@ -1411,6 +1845,7 @@ namespace HBL2
 			Handle<BindGroup> globalBindings = Renderer::Instance->GetGlobalBindings3D();
 			ResourceManager::Instance->SetBufferData(globalBindings, 0, (void*)&sceneRenderData->m_CameraData);
 			ResourceManager::Instance->SetBufferData(globalBindings, 1, (void*)&sceneRenderData->m_LightData);
+			SetClusterBufferData(globalBindings, sceneRenderData);
 			GlobalDrawStream globalDrawStream = { .BindGroup = globalBindings, .UsesDynamicOffset = true };
 			passRenderer->DrawSubPass(globalDrawStream, sceneRenderData->m_StaticMeshTransparentDraws);
 		}
@@ -1649,6 +2084,7 @@ namespace HBL2
 			sceneRenderData->m_OnlyRotationInViewProjection = glm::mat4(1.0f);
 			sceneRenderData->m_CameraData.ViewProjection = glm::mat4(1.0f);
 			sceneRenderData->m_LightData.ViewPosition = glm::vec4(0.0f);
+			sceneRenderData->m_CameraView = glm::mat4(1.0f);
 			sceneRenderData->m_CameraProjection = glm::mat4(1.0f);
 			sceneRenderData->m_CameraSettings.Exposure = 1.0f;
 			sceneRenderData->m_CameraSettings.Gamma = 2.2f;
@@ -1667,6 +2103,7 @@ namespace HBL2
 		//m_LightData.ViewPosition = tr.WorldMatrix * glm::vec4(tr.Translation, 1.0f);
 		sceneRenderData->m_LightData.ViewPosition = tr.WorldMatrix[3];
 		sceneRenderData->m_OnlyRotationInViewProjection = camera.Projection * glm::mat4(glm::mat3(camera.View));
+		sceneRenderData->m_CameraView = camera.View;
 		sceneRenderData->m_CameraProjection = camera.Projection;
 	}
 
@@ -1682,4 +2119,15 @@ namespace HBL2
 			std::memcpy(sceneRenderData->m_LightSpaceMatricesData.data() + offset, &matrices[i], sizeof(glm::mat4));
 		}
 	}
+
+	void ForwardSceneRenderer::SetClusterBufferData(Handle<BindGroup> globalBindings, SceneRenderData* sceneRenderData)
+	{
+		// The grid is always set, a zero GridSize.w tells the shaders to light from the light data alone.
+		ResourceManager::Instance->SetBufferData(globalBindings, 2, (void*)&sceneRenderData->m_ClusterGridData);
+
+		// Left unset without clustered lighting, so the backends skip uploading them.
+		ResourceManager::Instance->SetBufferData(globalBindings, 3, m_ClusteredLighting ? (void*)sceneRenderData->m_ClusterLights.data() : nullptr);
+		ResourceManager::Instance->SetBufferData(globalBindings, 4, m_ClusteredLighting ? (void*)sceneRenderData->m_ClusterRanges.data() : nullptr);
+		ResourceManager::Instance->SetBufferData(globalBindings, 5, m_ClusteredLighting ? (void*)sceneRenderData->m_ClusterLightIndices.data() : nullptr);
+	}
 }
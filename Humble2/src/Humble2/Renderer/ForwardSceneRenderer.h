@@ -3,12 +3,16 @@
 #include "SceneRenderer.h"
 
 #include "DrawList.h"
+#include "LightClusters.h"
 #include "UniformRingBuffer.h"
 
 #include "Scene/Scene.h"
 #include "Renderer/Renderer.h"
 #include "Resources/ResourceManager.h"
 
+#include <array>
+#include <vector>
+
 namespace HBL2
 {
 	struct PerDrawData
@@ -31,6 +35,47 @@ namespace HBL2
 		float Metalicness;
 	};
 
+	/**
+	 * @brief What a static mesh draw needs from its transform and mesh, kept per entity across frames and rebuilt only
+	 * when the world matrix, the mesh (asset, part or contents) or the entity itself changes.
+	 */
+	struct StaticMeshDrawCacheEntry
+	{
+		// What the entry was prepared from.
+		int32_t EntityGeneration = -1;
+		Handle<Mesh> MeshHandle;
+		uint32_t MeshVersion = 0;
+		uint32_t MeshIndex = 0;
+		uint32_t SubMeshIndex = 0;
+		glm::mat4 WorldMatrix = glm::mat4(1.0f);
+
+		// What is prepared.
+		glm::mat4 InverseModel = glm::mat4(1.0f);
+		glm::vec3 BoundsCenter = glm::vec3(0.0f);
+		glm::vec3 BoundsExtents = glm::vec3(0.0f);
+		bool Bounded = false;
+		Handle<Buffer> IndexBuffer;
+		Handle<Buffer> VertexBuffer;
+		uint32_t IndexCount = 0;
+		uint32_t IndexOffset = 0;
+		uint32_t VertexCount = 0;
+		uint32_t VertexOffset = 0;
+		uint32_t InstanceCount = 0;
+		uint32_t InstanceOffset = 0;
+
+		// Stable slot of the entity's draw data in the scene buffer (UINT32_MAX when it did not fit), and bit i is set when
+		// copy i of the slot holds the current draw data.
+		uint32_t DrawDataSlot = UINT32_MAX;
+		uint32_t UploadedCopies = 0;
+
+		// Last gather that collected a static mesh at this entity index, the slot is released when a gather skips it.
+		uint32_t GatherStamp = 0;
+	};
+
+	/**
+	 * @brief Everything the game thread gathers for a frame. Allocated in the frame slot arena (Renderer::GetFrameArena),
+	 * so it is read in place by the render thread and freed when the slot is released.
+	 */
 	struct SceneRenderData
 	{
 		LightData m_LightData{};
@@ -38,26 +83,70 @@ namespace HBL2
 		CameraSettings m_CameraSettings{};
 		Component::Camera::CameraFrustum m_CameraFrustum{};
 		glm::mat4 m_OnlyRotationInViewProjection = glm::mat4(1.0f);
+		glm::mat4 m_CameraView = glm::mat4(1.0f);
 		glm::mat4 m_CameraProjection = glm::mat4(1.0f);
 
-		std::vector<uint8_t> m_LightSpaceMatricesData;
+		DArray<uint8_t> m_LightSpaceMatricesData = MakeEmptyDArray<uint8_t>();
+
+		static constexpr uint32_t MaxShadowLights = 16;
+
+		// Range of each light for caster culling, xyz is the world position and w the radius (0 when unbounded).
+		glm::vec4 m_ShadowCullingSpheres[MaxShadowLights]{};
+
+		// Clustered lighting, always allocated at full size since the global bind group uploads its buffers whole.
+		ClusterGridData m_ClusterGridData{};
+		DArray<ClusterLight> m_ClusterLights = MakeEmptyDArray<ClusterLight>();
+		DArray<glm::uvec2> m_ClusterRanges = MakeEmptyDArray<glm::uvec2>();
+		DArray<uint32_t> m_ClusterLightIndices = MakeEmptyDArray<uint32_t>();
 
 		uint32_t m_UBOStartingOffset = 0;
 		uint32_t m_UBOEndingOffset = 0;
+		uint32_t m_InstanceStartingOffset = 0;
+		uint32_t m_InstanceEndingOffset = 0;
+
+		// Ranges of the scene buffer rewritten this frame, x is the offset and y the size in bytes.
+		DArray<glm::uvec2> m_SceneBufferUploads = MakeEmptyDArray<glm::uvec2>();
 		DrawList m_StaticMeshOpaqueDraws;
 		DrawList m_StaticMeshTransparentDraws;
 		DrawList m_PrePassStaticMeshDraws;
-		DrawList m_ShadowPassStaticMeshDraws;
 
 		DrawList m_SpriteOpaqueDraws;
 		DrawList m_SpriteTransparentDraws;
 		DrawList m_PrePassSpriteDraws;
 		DrawList m_ShadowPassSpriteDraws;
+
+		// Shadow casters of each light (indexed like the light data), each list is rendered only into that light's atlas tile.
+		DrawList m_ShadowCasterDraws[MaxShadowLights];
+
+		static constexpr uint32_t DrawListCount = 7 + MaxShadowLights;
+
+		std::array<DrawList*, DrawListCount> GetDrawLists()
+		{
+			std::array<DrawList*, DrawListCount> drawLists = {
+				&m_StaticMeshOpaqueDraws, &m_StaticMeshTransparentDraws, &m_PrePassStaticMeshDraws,
+				&m_SpriteOpaqueDraws, &m_SpriteTransparentDraws, &m_PrePassSpriteDraws, &m_ShadowPassSpriteDraws,
+			};
+
+			for (uint32_t i = 0; i < MaxShadowLights; i++)
+			{
+				drawLists[7 + i] = &m_ShadowCasterDraws[i];
+			}
+
+			return drawLists;
+		}
 	};
 
 	class HBL2_API ForwardSceneRenderer final : public SceneRenderer
 	{
 	public:
+		/**
+		 * @param clusteredLighting Bins point and spot lights into a froxel grid (Forward+) instead of capping them at the light data size.
+		 */
+		explicit ForwardSceneRenderer(bool clusteredLighting = false)
+			: m_ClusteredLighting(clusteredLighting)
+		{
+		}
+
 		virtual ~ForwardSceneRenderer() = default;
 
 		virtual void Initialize(Scene* scene) override;
@@ -77,8 +166,10 @@ namespace HBL2
 		void DebugPassSetup();
 		void PresentPassSetup();
 
+		SceneRenderData* AllocateRenderData();
 		void GatherDraws(SceneRenderData* sceneRenderData);
 		void GatherLights(SceneRenderData* sceneRenderData);
+		void MergeInstances(SceneRenderData* sceneRenderData);
 
 		void ShadowPass(CommandBuffer* commandBuffer, SceneRenderData* sceneRenderData);
 		void DepthPrePass(CommandBuffer* commandBuffer, SceneRenderData* sceneRenderData);
@@ -94,16 +185,31 @@ namespace HBL2
 		void GetViewProjection(SceneRenderData* sceneRenderData, Entity mainCamera);
 
 		void CreateAlignedMatrixArray(SceneRenderData* sceneRenderData, const glm::mat4* matrices, size_t count, uint32_t alignedSize);
+		void SetClusterBufferData(Handle<BindGroup> globalBindings, SceneRenderData* sceneRenderData);
 
 	private:
-		PoolReservation* m_Reservation = nullptr;
-		Arena m_Arena;
-
 		ResourceManager* m_ResourceManager = nullptr;
 		UniformRingBuffer* m_UniformRingBuffer = nullptr;
+		UniformRingBuffer* m_InstanceRingBuffer = nullptr;
 
 		Scene* m_EditorScene = nullptr;
-		SceneRenderData m_RenderData[Renderer::FrameCount]{};
+		SceneRenderData* m_CurrentRenderData = nullptr;
+
+		bool m_ClusteredLighting = false;
+
+		// Draw counts of the last gathered frame, used to size the draw lists of the next one.
+		uint32_t m_DrawCountHints[SceneRenderData::DrawListCount]{};
+
+		// Indexed by entity index, touched only by the gather job of the entity's static mesh.
+		std::vector<StaticMeshDrawCacheEntry> m_StaticMeshDrawCache;
+
+		// Slots handed out in the scene buffer (the persistent region of the uniform ring), at most m_SceneBufferCapacity.
+		// Released slots go to the free list and are handed out again before new ones.
+		uint32_t m_SceneBufferSlotCount = 0;
+		uint32_t m_SceneBufferCapacity = 0;
+		std::vector<uint32_t> m_SceneBufferSlotOwners; // Slot -> entity index holding it, UINT32_MAX when free.
+		std::vector<uint32_t> m_FreeSceneBufferSlots;
+		uint32_t m_GatherStamp = 0;
 		
 		Handle<RenderPassLayout> m_RenderPassLayout;
 
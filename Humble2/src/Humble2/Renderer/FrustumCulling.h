@@ -0,0 +1,197 @@
+#pragma once
+
+#include "Scene/Components.h"
+#include "Resources/Types.h"
+
+#include <glm/glm.hpp>
+
+#include <cstdint>
+
+#if defined(__SSE__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+	#include <xmmintrin.h>
+	#define HBL2_CULLING_SSE 1
+#else
+	#define HBL2_CULLING_SSE 0
+#endif
+
+namespace HBL2
+{
+	/**
+	 * @brief Encloses the local extents, placed by the world matrix, in a world space box.
+	 *
+	 * @return False for empty extents, which have no box and are treated as visible by every test.
+	 */
+	inline bool GetWorldBounds(const MeshExtents& localExtents, const glm::mat4& worldMatrix, glm::vec3& center, glm::vec3& extents)
+	{
+		if (!localExtents.IsValid())
+		{
+			return false;
+		}
+
+		const glm::vec3 localCenter = (localExtents.Min + localExtents.Max) * 0.5f;
+		const glm::vec3 localHalfSize = (localExtents.Max - localExtents.Min) * 0.5f;
+
+		// The world box encloses the transformed one, each world axis gathers the absolute contribution of every local axis.
+		center = glm::vec3(worldMatrix * glm::vec4(localCenter, 1.0f));
+		extents = glm::abs(glm::vec3(worldMatrix[0])) * localHalfSize.x
+				+ glm::abs(glm::vec3(worldMatrix[1])) * localHalfSize.y
+				+ glm::abs(glm::vec3(worldMatrix[2])) * localHalfSize.z;
+
+		return true;
+	}
+
+	/**
+	 * @brief Whether a world space box touches a sphere, used to bound the casters of a point light by its range.
+	 */
+	inline bool IntersectsSphere(const glm::vec3& center, const glm::vec3& extents, const glm::vec3& sphereCenter, float radius)
+	{
+		const glm::vec3 delta = glm::max(glm::abs(sphereCenter - center) - extents, glm::vec3(0.0f));
+		return glm::dot(delta, delta) <= radius * radius;
+	}
+
+	/**
+	 * @brief Camera or light frustum laid out for testing boxes against four planes per instruction.
+	 *
+	 * The six planes are stored as structure of arrays and padded to eight with planes that accept everything,
+	 * so a box test is two SSE iterations without per plane branches.
+	 */
+	struct CullingFrustum
+	{
+		static constexpr uint32_t PlaneCount = 8;
+
+		alignas(16) float NormalX[PlaneCount];
+		alignas(16) float NormalY[PlaneCount];
+		alignas(16) float NormalZ[PlaneCount];
+		alignas(16) float Distance[PlaneCount];
+
+		/**
+		 * @brief A frustum that keeps everything.
+		 */
+		CullingFrustum()
+		{
+			for (uint32_t i = 0; i < PlaneCount; ++i)
+			{
+				NormalX[i] = 0.0f;
+				NormalY[i] = 0.0f;
+				NormalZ[i] = 0.0f;
+				Distance[i] = 1.0f;
+			}
+		}
+
+		explicit CullingFrustum(const Component::Camera::CameraFrustum& frustum)
+		{
+			for (uint32_t i = 0; i < PlaneCount; ++i)
+			{
+				const bool padding = (i >= 6);
+
+				NormalX[i] = padding ? 0.0f : frustum.Planes[i].normal.x;
+				NormalY[i] = padding ? 0.0f : frustum.Planes[i].normal.y;
+				NormalZ[i] = padding ? 0.0f : frustum.Planes[i].normal.z;
+				Distance[i] = padding ? 1.0f : frustum.Planes[i].distance;
+			}
+		}
+
+		/**
+		 * @brief Extracts the planes of a view projection matrix, in the same order and convention as CameraSystem::CalculateFrustum.
+		 */
+		explicit CullingFrustum(const glm::mat4& viewProjection)
+			: CullingFrustum()
+		{
+			for (uint32_t i = 0; i < 6; ++i)
+			{
+				// Left, right, bottom, top, near, far: the last row plus or minus the row of the clip axis.
+				const uint32_t axis = i / 2;
+				const float sign = (i % 2 == 0) ? 1.0f : -1.0f;
+
+				const glm::vec3 normal = glm::vec3(
+					viewProjection[0][3] + sign * viewProjection[0][axis],
+					viewProjection[1][3] + sign * viewProjection[1][axis],
+					viewProjection[2][3] + sign * viewProjection[2][axis]);
+
+				const float length = glm::length(normal);
+
+				if (length == 0.0f)
+				{
+					continue;
+				}
+
+				NormalX[i] = normal.x / length;
+				NormalY[i] = normal.y / length;
+				NormalZ[i] = normal.z / length;
+				Distance[i] = (viewProjection[3][3] + sign * viewProjection[3][axis]) / length;
+			}
+		}
+
+		/**
+		 * @brief Whether a world space box is at least partially inside the frustum.
+		 *
+		 * A box is outside when it is fully behind any plane, i.e. the signed distance of its center plus its projected radius
+		 * on the plane normal is negative. A zeroed or degenerate frustum (no camera) keeps everything.
+		 *
+		 * @param center The box center.
+		 * @param extents The box half size.
+		 */
+		bool IsVisible(const glm::vec3& center, const glm::vec3& extents) const
+		{
+#if HBL2_CULLING_SSE
+			const __m128 centerX = _mm_set1_ps(center.x);
+			const __m128 centerY = _mm_set1_ps(center.y);
+			const __m128 centerZ = _mm_set1_ps(center.z);
+			const __m128 extentsX = _mm_set1_ps(extents.x);
+			const __m128 extentsY = _mm_set1_ps(extents.y);
+			const __m128 extentsZ = _mm_set1_ps(extents.z);
+			const __m128 signMask = _mm_set1_ps(-0.0f);
+
+			for (uint32_t i = 0; i < PlaneCount; i += 4)
+			{
+				const __m128 normalX = _mm_load_ps(NormalX + i);
+				const __m128 normalY = _mm_load_ps(NormalY + i);
+				const __m128 normalZ = _mm_load_ps(NormalZ + i);
+
+				const __m128 distance = _mm_add_ps(_mm_load_ps(Distance + i),
+					_mm_add_ps(_mm_add_ps(_mm_mul_ps(normalX, centerX), _mm_mul_ps(normalY, centerY)), _mm_mul_ps(normalZ, centerZ)));
+
+				const __m128 radius = _mm_add_ps(
+					_mm_add_ps(_mm_mul_ps(_mm_andnot_ps(signMask, normalX), extentsX), _mm_mul_ps(_mm_andnot_ps(signMask, normalY), extentsY)),
+					_mm_mul_ps(_mm_andnot_ps(signMask, normalZ), extentsZ));
+
+				if (_mm_movemask_ps(_mm_cmplt_ps(_mm_add_ps(distance, radius), _mm_setzero_ps())) != 0)
+				{
+					return false;
+				}
+			}
+
+			return true;
+#else
+			for (uint32_t i = 0; i < PlaneCount; ++i)
+			{
+				const float distance = Distance[i] + NormalX[i] * center.x + NormalY[i] * center.y + NormalZ[i] * center.z;
+				const float radius = glm::abs(NormalX[i]) * extents.x + glm::abs(NormalY[i]) * extents.y + glm::abs(NormalZ[i]) * extents.z;
+
+				if (distance + radius < 0.0f)
+				{
+					return false;
+				}
+			}
+
+			return true;
+#endif
+		}
+
+		/**
+		 * @brief Whether the local extents, placed by the world matrix, are at least partially inside the frustum. Empty extents are always visible.
+		 */
+		bool IsVisible(const MeshExtents& localExtents, const glm::mat4& worldMatrix) const
+		{
+			glm::vec3 center;
+			glm::vec3 extents;
+
+			if (!GetWorldBounds(localExtents, worldMatrix, center, extents))
+			{
+				return true;
+			}
+
+			return IsVisible(center, extents);
+		}
+	};
+}
@@ -0,0 +1,354 @@
+#include "LightClusters.h"
+
+#include "Core/Allocators.h"
+#include "Utilities/JobSystem.h"
+#include "Utilities/Collections/Collections.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+namespace HBL2
+{
+	namespace
+	{
+		constexpr uint32_t TilesPerSlice = LightClusters::TilesX * LightClusters::TilesY;
+
+		struct LightBounds
+		{
+			glm::vec4 Sphere = {}; // View space center and radius.
+
+			// Inclusive cluster range, empty when the light is outside the grid.
+			uint32_t MinX = 0, MaxX = 0;
+			uint32_t MinY = 0, MaxY = 0;
+			uint32_t MinZ = 1, MaxZ = 0;
+		};
+
+		struct ClusterBounds
+		{
+			glm::vec3 Min = {};
+			glm::vec3 Max = {};
+		};
+
+		// Both ends of the view ray through a tile corner, the cluster corners are points of it at the slice depths.
+		struct CornerRay
+		{
+			glm::vec3 Near = {};
+			glm::vec3 Far = {};
+
+			glm::vec3 AtDepth(float depth) const
+			{
+				const float t = (depth + Near.z) / (Near.z - Far.z);
+				return Near + (Far - Near) * t;
+			}
+		};
+
+		glm::vec3 Unproject(const glm::mat4& inverseProjection, float x, float y, float z)
+		{
+			const glm::vec4 point = inverseProjection * glm::vec4(x, y, z, 1.0f);
+			return glm::vec3(point) / point.w;
+		}
+
+		// The bounding sphere of a spot light cone, much tighter than its range for narrow cones.
+		glm::vec4 ConeBoundingSphere(const glm::vec3& origin, const glm::vec3& direction, float range, float cosAngle)
+		{
+			cosAngle = glm::clamp(cosAngle, 0.0f, 1.0f);
+
+			// Wider than 45 degrees, the sphere through the cap circle is the smallest.
+			if (cosAngle < 0.70710678f)
+			{
+				const float sinAngle = std::sqrt(1.0f - cosAngle * cosAngle);
+				return glm::vec4(origin + direction * (cosAngle * range), sinAngle * range);
+			}
+
+			const float radius = range / (2.0f * cosAngle);
+			return glm::vec4(origin + direction * radius, radius);
+		}
+
+		bool SphereIntersectsBox(const glm::vec4& sphere, const ClusterBounds& box)
+		{
+			const glm::vec3 center = glm::vec3(sphere);
+			const glm::vec3 delta = center - glm::clamp(center, box.Min, box.Max);
+			return glm::dot(delta, delta) <= sphere.w * sphere.w;
+		}
+
+		uint32_t ToTile(float ndc, uint32_t tileCount)
+		{
+			const float tile = std::floor((ndc * 0.5f + 0.5f) * (float)tileCount);
+			return (uint32_t)glm::clamp(tile, 0.0f, (float)(tileCount - 1));
+		}
+	}
+
+	void LightClusters::Build(const glm::mat4& view, const glm::mat4& projection, Span<const ClusterLight> lights, ClusterGridData& grid, Span<glm::uvec2> ranges, Span<uint32_t> indices)
+	{
+		HBL2_CORE_ASSERT(ranges.Size() >= ClusterCount, "LightClusters: the cluster range array is too small!");
+		HBL2_CORE_ASSERT(indices.Size() >= MaxLightIndices, "LightClusters: the light index array is too small!");
+
+		const uint32_t lightCount = std::min((uint32_t)lights.Size(), MaxLights);
+		const glm::mat4 inverseProjection = glm::inverse(projection);
+
+		// Depth clip range is zero to one, so these are the near and far planes for both projection types.
+		const float nearDepth = -Unproject(inverseProjection, 0.0f, 0.0f, 0.0f).z;
+		const float farDepth = -Unproject(inverseProjection, 0.0f, 0.0f, 1.0f).z;
+
+		// A perspective projection copies the view depth into w, an orthographic one does not.
+		const bool perspective = (projection[2][3] != 0.0f);
+
+		grid.View = view;
+		grid.GridSize = { TilesX, TilesY, Slices, 1 };
+		grid.Counts = { lightCount, 0, 0, 0 };
+
+		std::fill(ranges.begin(), ranges.begin() + ClusterCount, glm::uvec2(0));
+
+		if (!(farDepth > nearDepth) || (perspective && !(nearDepth > 0.0f)))
+		{
+			grid.DepthSlicing = {};
+			grid.Counts.x = 0;
+			return;
+		}
+
+		// Exponential slices keep clusters roughly cubic with perspective. Orthographic views use a single slice for the whole depth range.
+		float sliceScale = 0.0f;
+		float sliceBias = 0.0f;
+
+		if (perspective)
+		{
+			const float logDepthRange = std::log(farDepth / nearDepth);
+			sliceScale = (float)Slices / logDepthRange;
+			sliceBias = -(float)Slices * std::log(nearDepth) / logDepthRange;
+		}
+
+		grid.DepthSlicing = { sliceScale, sliceBias, nearDepth, farDepth };
+
+		auto sliceDepth = [&](uint32_t slice) -> float
+		{
+			if (!perspective)
+			{
+				return slice == 0 ? nearDepth : farDepth;
+			}
+
+			return nearDepth * std::pow(farDepth / nearDepth, (float)slice / (float)Slices);
+		};
+
+		auto depthSlice = [&](float depth) -> uint32_t
+		{
+			if (!perspective)
+			{
+				return 0;
+			}
+
+			const float slice = std::floor(std::log(std::max(depth, nearDepth)) * sliceScale + sliceBias);
+			return (uint32_t)glm::clamp(slice, 0.0f, (float)(Slices - 1));
+		};
+
+		ScratchArena scratch(Allocator::FrameArenaMT);
+
+		// View space bounds of every cluster.
+		DArray<CornerRay> cornerRays = MakeDArrayResized<CornerRay>(scratch, (TilesX + 1) * (TilesY + 1));
+
+		for (uint32_t y = 0; y <= TilesY; y++)
+		{
+			for (uint32_t x = 0; x <= TilesX; x++)
+			{
+				const float ndcX = -1.0f + 2.0f * (float)x / (float)TilesX;
+				const float ndcY = -1.0f + 2.0f * (float)y / (float)TilesY;
+
+				cornerRays[y * (TilesX + 1) + x] = { Unproject(inverseProjection, ndcX, ndcY, 0.0f), Unproject(inverseProjection, ndcX, ndcY, 1.0f) };
+			}
+		}
+
+		DArray<ClusterBounds> clusterBounds = MakeDArrayResized<ClusterBounds>(scratch, ClusterCount);
+
+		JobSystem::Get().ParallelFor(0, ClusterCount, [&](uint32_t cluster)
+		{
+			const uint32_t z = cluster / TilesPerSlice;
+			const uint32_t y = (cluster / TilesX) % TilesY;
+			const uint32_t x = cluster % TilesX;
+
+			const float depths[2] = { sliceDepth(z), sliceDepth(z + 1) };
+
+			ClusterBounds bounds = { glm::vec3(FLT_MAX), glm::vec3(-FLT_MAX) };
+
+			for (uint32_t corner = 0; corner < 4; corner++)
+			{
+				const CornerRay& ray = cornerRays[(y + corner / 2) * (TilesX + 1) + x + corner % 2];
+
+				for (float depth : depths)
+				{
+					const glm::vec3 point = ray.AtDepth(depth);
+					bounds.Min = glm::min(bounds.Min, point);
+					bounds.Max = glm::max(bounds.Max, point);
+				}
+			}
+
+			clusterBounds[cluster] = bounds;
+		}, 64);
+
+		// View space sphere and the cluster range it can touch, for every light.
+		DArray<LightBounds> lightBounds = MakeDArrayResized<LightBounds>(scratch, lightCount);
+
+		JobSystem::Get().ParallelFor(0, lightCount, [&](uint32_t lightIndex)
+		{
+			const ClusterLight& light = lights[lightIndex];
+			LightBounds& bounds = lightBounds[lightIndex];
+
+			const float range = light.Direction.w;
+
+			if (!(range > 0.0f))
+			{
+				return;
+			}
+
+			glm::vec4 worldSphere = glm::vec4(glm::vec3(light.Position), range);
+
+			if (light.Position.w == 2.0f)
+			{
+				worldSphere = ConeBoundingSphere(glm::vec3(light.Position), glm::normalize(glm::vec3(light.Direction)), range, light.Metadata.z);
+			}
+
+			const glm::vec3 center = glm::vec3(view * glm::vec4(glm::vec3(worldSphere), 1.0f));
+			const float radius = worldSphere.w;
+
+			const float minDepth = -center.z - radius;
+			const float maxDepth = -center.z + radius;
+
+			if (maxDepth < nearDepth || minDepth > farDepth)
+			{
+				return;
+			}
+
+			uint32_t minX = 0, maxX = TilesX - 1;
+			uint32_t minY = 0, maxY = TilesY - 1;
+
+			// In front of the near plane the projected corners of the view space box enclose the projected sphere.
+			// Otherwise the sphere can cover any part of the screen, so every tile is a candidate.
+			if (minDepth > nearDepth)
+			{
+				glm::vec2 ndcMin = glm::vec2(FLT_MAX);
+				glm::vec2 ndcMax = glm::vec2(-FLT_MAX);
+
+				for (uint32_t corner = 0; corner < 8; corner++)
+				{
+					const glm::vec3 offset = glm::vec3((corner & 1) ? radius : -radius, (corner & 2) ? radius : -radius, (corner & 4) ? radius : -radius);
+					const glm::vec4 clip = projection * glm::vec4(center + offset, 1.0f);
+					const glm::vec2 ndc = glm::vec2(clip) / clip.w;
+
+					ndcMin = glm::min(ndcMin, ndc);
+					ndcMax = glm::max(ndcMax, ndc);
+				}
+
+				if (ndcMax.x < -1.0f || ndcMin.x > 1.0f || ndcMax.y < -1.0f || ndcMin.y > 1.0f)
+				{
+					return;
+				}
+
+				minX = ToTile(ndcMin.x, TilesX);
+				maxX = ToTile(ndcMax.x, TilesX);
+				minY = ToTile(ndcMin.y, TilesY);
+				maxY = ToTile(ndcMax.y, TilesY);
+			}
+
+			bounds.Sphere = glm::vec4(center, radius);
+			bounds.MinX = minX;
+			bounds.MaxX = maxX;
+			bounds.MinY = minY;
+			bounds.MaxY = maxY;
+			bounds.MinZ = depthSlice(minDepth);
+			bounds.MaxZ = depthSlice(maxDepth);
+		}, 32);
+
+		// Bucket the lights by slice, so a cluster only walks the lights of its own slice.
+		DArray<uint32_t> sliceOffsets = MakeDArrayResized<uint32_t>(scratch, Slices + 1);
+
+		for (const LightBounds& bounds : lightBounds)
+		{
+			for (uint32_t z = bounds.MinZ; z <= bounds.MaxZ; z++)
+			{
+				sliceOffsets[z + 1]++;
+			}
+		}
+
+		for (uint32_t z = 0; z < Slices; z++)
+		{
+			sliceOffsets[z + 1] += sliceOffsets[z];
+		}
+
+		DArray<uint32_t> sliceLights = MakeDArrayResized<uint32_t>(scratch, sliceOffsets[Slices]);
+		DArray<uint32_t> sliceFill = MakeDArray<uint32_t>(scratch, Slices);
+		sliceFill.assign(sliceOffsets.begin(), sliceOffsets.end() - 1);
+
+		for (uint32_t lightIndex = 0; lightIndex < lightCount; lightIndex++)
+		{
+			const LightBounds& bounds = lightBounds[lightIndex];
+
+			for (uint32_t z = bounds.MinZ; z <= bounds.MaxZ; z++)
+			{
+				sliceLights[sliceFill[z]++] = lightIndex;
+			}
+		}
+
+		// Walks the lights touching a cluster, in light order, until the callback returns false.
+		auto forEachClusterLight = [&](uint32_t cluster, auto&& fn)
+		{
+			const uint32_t z = cluster / TilesPerSlice;
+			const uint32_t y = (cluster / TilesX) % TilesY;
+			const uint32_t x = cluster % TilesX;
+
+			const ClusterBounds& box = clusterBounds[cluster];
+
+			for (uint32_t i = sliceOffsets[z]; i < sliceOffsets[z + 1]; i++)
+			{
+				const uint32_t lightIndex = sliceLights[i];
+				const LightBounds& bounds = lightBounds[lightIndex];
+
+				if (x < bounds.MinX || x > bounds.MaxX || y < bounds.MinY || y > bounds.MaxY)
+				{
+					continue;
+				}
+
+				if (SphereIntersectsBox(bounds.Sphere, box) && !fn(lightIndex))
+				{
+					return;
+				}
+			}
+		};
+
+		// Count, place every cluster in the index list, then fill. The two passes keep the list compact without per thread storage.
+		DArray<uint32_t> clusterCounts = MakeDArrayResized<uint32_t>(scratch, ClusterCount);
+
+		JobSystem::Get().ParallelFor(0, ClusterCount, [&](uint32_t cluster)
+		{
+			uint32_t count = 0;
+			forEachClusterLight(cluster, [&count](uint32_t) { count++; return true; });
+			clusterCounts[cluster] = count;
+		}, 32);
+
+		uint32_t indexCount = 0;
+
+		for (uint32_t cluster = 0; cluster < ClusterCount; cluster++)
+		{
+			const uint32_t count = std::min(clusterCounts[cluster], MaxLightIndices - indexCount);
+			ranges[cluster] = { indexCount, count };
+			indexCount += count;
+		}
+
+		JobSystem::Get().ParallelFor(0, ClusterCount, [&](uint32_t cluster)
+		{
+			const glm::uvec2 range = ranges[cluster];
+
+			if (range.y == 0)
+			{
+				return;
+			}
+
+			uint32_t written = 0;
+			forEachClusterLight(cluster, [&](uint32_t lightIndex)
+			{
+				indices[range.x + written++] = lightIndex;
+				return written < range.y;
+			});
+		}, 32);
+
+		grid.Counts.y = indexCount;
+	}
+}
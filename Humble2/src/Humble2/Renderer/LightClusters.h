@@ -0,0 +1,71 @@
+#pragma once
+
+#include "Base.h"
+#include "Utilities/Collections/Span.h"
+
+#include <glm/glm.hpp>
+
+#include <cstdint>
+
+namespace HBL2
+{
+	/**
+	 * @brief A point or spot light as read by clustered shading, every bounded light of the frame has one, shadowed or not.
+	 */
+	struct ClusterLight
+	{
+		glm::vec4 Position;  // xyz world position, w light type (1 point, 2 spot), as in LightData::LightPositions.
+		glm::vec4 Direction; // xyz world direction, w range.
+		glm::vec4 Color;     // rgb color, a index of the light in LightData for its shadow data, -1 when it has none.
+		glm::vec4 Metadata;  // Same layout as LightData::LightMetadata.
+	};
+
+	/**
+	 * @brief Per frame constants of the clustered shading grid.
+	 *
+	 * A fragment finds its cluster from its normalized device coordinates and view depth:
+	 * x = floor((ndc.x * 0.5 + 0.5) * GridSize.x), y likewise, z = floor(log(depth) * DepthSlicing.x + DepthSlicing.y),
+	 * each clamped to the grid. Its lights are LightIndices[ClusterRanges[cluster].x + i] for i < ClusterRanges[cluster].y,
+	 * with cluster = (z * GridSize.y + y) * GridSize.x + x.
+	 * While GridSize.w is set, the shaders take only the directional lights from LightData and every point and spot light
+	 * from the clusters, otherwise they light from LightData alone.
+	 */
+	struct alignas(16) ClusterGridData
+	{
+		glm::mat4 View = glm::mat4(1.0f); // World to view space, the depth of a point is its negated view space z.
+		glm::uvec4 GridSize = {};         // xyz cluster counts, w 1 when clustered shading is enabled.
+		glm::vec4 DepthSlicing = {};      // x scale and y bias of the slice of a log depth, z near and w far depth.
+		glm::uvec4 Counts = {};           // x lights, y light indices, zw unused.
+	};
+
+	/**
+	 * @brief Bins point and spot lights into a view space froxel grid for clustered (Forward+) shading.
+	 *
+	 * The grid is TilesX x TilesY tiles across the screen and Slices exponential depth slices between the camera near and
+	 * far planes. Each cluster gets an offset and a count into one shared light index list, so a fragment only evaluates
+	 * the lights whose bounding sphere touches its cluster. Directional lights light every cluster and are not binned.
+	 */
+	class HBL2_API LightClusters
+	{
+	public:
+		static constexpr uint32_t TilesX = 16;
+		static constexpr uint32_t TilesY = 9;
+		static constexpr uint32_t Slices = 24;
+		static constexpr uint32_t ClusterCount = TilesX * TilesY * Slices;
+		static constexpr uint32_t MaxLights = 1024;
+		static constexpr uint32_t MaxLightIndices = ClusterCount * 32;
+
+		/**
+		 * @brief Bins the lights and fills the grid constants, the cluster ranges and the light index list.
+		 *
+		 * When the index list runs out, the clusters that did not fit keep a partial list (the farthest slices lose lights first).
+		 *
+		 * @param lights The lights of the frame, at most MaxLights.
+		 * @param ranges ClusterCount entries, x is the offset and y the count of each cluster in the index list.
+		 * @param indices MaxLightIndices entries.
+		 *
+		 * @note Game thread, the binning itself is spread over the job system.
+		 */
+		static void Build(const glm::mat4& view, const glm::mat4& projection, Span<const ClusterLight> lights, ClusterGridData& grid, Span<glm::uvec2> ranges, Span<uint32_t> indices);
+	};
+}
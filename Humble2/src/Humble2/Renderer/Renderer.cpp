@@ -1,10 +1,12 @@
 #include "Renderer.h"
 
 #include "Device.h"
+#include "ForwardSceneRenderer.h"
 #include "Core/Window.h"
 #include "Project/Project.h"
 
 #include <future>
+#include <format>
 
 namespace HBL2
 {
@@ -17,16 +19,32 @@ namespace HBL2
 
 		m_UniformRingBufferSize = (uint32_t)MB(projectSettings.MaxUniformBufferMemory) * FrameCount;
 
+		// Every merged run takes one spare record to start on a record boundary, and runs are at least two draws long.
+		const uint32_t instanceRecords = projectSettings.MaxInstancedDraws + projectSettings.MaxInstancedDraws / 2;
+		m_InstanceRingBufferSize = instanceRecords * (uint32_t)sizeof(PerDrawData) * FrameCount;
+
 		uint32_t offset = 0;
+		uint32_t instanceOffset = 0;
 		uint32_t singleUBSize = m_UniformRingBufferSize / FrameCount;
+		uint32_t singleInstanceSize = m_InstanceRingBufferSize / FrameCount;
 
 		for (int i = 0; i < FrameCount; i++)
 		{
 			m_FrameReady[i] = false;
 			m_FrameInUse[i] = false;
 			m_UniformRingBufferFrameOffsets[i] = offset;
+			m_InstanceRingBufferFrameOffsets[i] = instanceOffset;
 
 			offset += singleUBSize;
+			instanceOffset += singleInstanceSize;
+		}
+
+		// One arena per frame slot, written by the game thread and read in place by the render thread.
+		for (int i = 0; i < FrameCount; i++)
+		{
+			const std::string reservationName = std::format("FrameArenaReservationSlot{}", i);
+			m_FrameArenaReservations[i] = Allocator::Arena.Reserve(reservationName.c_str(), MB(projectSettings.MaxFrameSlotArenaMemory));
+			m_FrameArenas[i].Initialize(&Allocator::Arena, MB(projectSettings.MaxFrameSlotArenaMemory), m_FrameArenaReservations[i]);
 		}
 
 		/*
@@ -66,6 +84,27 @@ namespace HBL2
 					.visibility = ShaderStage::FRAGMENT,
 					.type = BufferBindingType::UNIFORM,
 				},
+				// Clustered lighting: grid constants, lights, cluster ranges and light indices (see LightClusters.h).
+				{
+					.slot = 3,
+					.visibility = ShaderStage::FRAGMENT,
+					.type = BufferBindingType::UNIFORM,
+				},
+				{
+					.slot = 4,
+					.visibility = ShaderStage::FRAGMENT,
+					.type = BufferBindingType::READ_ONLY_STORAGE,
+				},
+				{
+					.slot = 5,
+					.visibility = ShaderStage::FRAGMENT,
+					.type = BufferBindingType::READ_ONLY_STORAGE,
+				},
+				{
+					.slot = 6,
+					.visibility = ShaderStage::FRAGMENT,
+					.type = BufferBindingType::READ_ONLY_STORAGE,
+				},
 			},
 		});
 
@@ -90,6 +129,11 @@ namespace HBL2
 					.visibility = ShaderStage::VERTEX,
 					.type = BufferBindingType::UNIFORM_DYNAMIC_OFFSET,
 				},
+				{
+					.slot = 1,
+					.visibility = ShaderStage::VERTEX,
+					.type = BufferBindingType::READ_ONLY_STORAGE,
+				},
 			},
 		});
 
@@ -112,7 +156,11 @@ namespace HBL2
 		PreInitialize();
 
 		// With 32MB per frame in flight, we can bump allocate data for ~200K draws, should be plenty enough for almost all use cases.
-		TempUniformRingBuffer = new UniformRingBuffer(m_UniformRingBufferSize, (uint32_t)Device::Instance->GetGPUProperties().limits.minUniformBufferOffsetAlignment);
+		// The scene buffer region after the ring keeps the draw data of static meshes at stable offsets, one copy per frame in flight.
+		TempUniformRingBuffer = new UniformRingBuffer(m_UniformRingBufferSize, (uint32_t)Device::Instance->GetGPUProperties().limits.minUniformBufferOffsetAlignment, BufferUsage::UNIFORM, "dynamic-uniform-buffer", (uint32_t)MB(projectSettings.MaxSceneBufferMemory) * FrameCount);
+
+		// Per instance data of merged draws, read by index and partitioned per frame in flight like the uniform ring.
+		TempInstanceRingBuffer = new UniformRingBuffer(m_InstanceRingBufferSize, 16, BufferUsage::STORAGE, "instance-storage-buffer");
 
 		IntermediateColorTexture = ResourceManager::Instance->CreateTexture({
 			.debugName = "intermediate-color-target",
@@ -282,6 +330,11 @@ namespace HBL2
 		});
 
 		m_ReservedWriteIndex = m_WriteIndex;
+
+		// The slot arena was reset when the slot was released, so drop any pointers into it from the last time this slot was used.
+		m_Frames[m_ReservedWriteIndex].Renderer = nullptr;
+		m_Frames[m_ReservedWriteIndex].RenderData = nullptr;
+		m_Frames[m_ReservedWriteIndex].DebugRenderData = nullptr;
 	}
 
 	void Renderer::MarkAndSubmit()
@@ -301,6 +354,7 @@ namespace HBL2
 
 		// Reset temp uniform buffer to new offset.
 		TempUniformRingBuffer->Invalidate(m_UniformRingBufferFrameOffsets[m_WriteIndex]);
+		TempInstanceRingBuffer->Invalidate(m_InstanceRingBufferFrameOffsets[m_WriteIndex]);
 
 		lock.unlock();
 		m_WorkCV.notify_one(); // wake render thread
@@ -340,6 +394,9 @@ namespace HBL2
 
 	void Renderer::ReleaseFrameSlot(int32_t acquiredIndex)
 	{
+		// The render thread is done reading this frame, so everything the game thread allocated for it can go.
+		m_FrameArenas[acquiredIndex].Reset();
+
 		{
 			std::lock_guard<std::mutex> lock(m_WorkMutex);
 			m_FrameInUse[acquiredIndex] = false;
@@ -355,6 +412,7 @@ namespace HBL2
 			m_Frames[i].ImGuiRenderData.Clear();
 			m_Frames[i].Renderer = nullptr;
 			m_Frames[i].RenderData = nullptr;
+			m_Frames[i].DebugRenderData = nullptr;
 		}
 	}
 
@@ -364,6 +422,7 @@ namespace HBL2
 		{
 			m_FrameReady[i] = false;
 			m_FrameInUse[i] = false;
+			m_FrameArenas[i].Reset();
 		}
 
 		m_ReadIndex = 0;
@@ -9,16 +9,18 @@
 #include "ShadowAtlasAllocator.h"
 #include "SceneRenderer.h"
 
+#include "Utilities/Tracer.h"
+
 #include "ImGui/imgui_threaded_rendering.h"
 #include <queue>
 
 namespace HBL2
 {
 #ifdef DIST
-    #define BEGIN_PROFILE_PASS()
+    #define BEGIN_PROFILE_PASS() HBL2_TRACE_FUNC()
     #define END_PROFILE_PASS(time)
 #else
-    #define BEGIN_PROFILE_PASS() Timer profilePass
+    #define BEGIN_PROFILE_PASS() HBL2_TRACE_FUNC(); Timer profilePass
     #define END_PROFILE_PASS(time) time = profilePass.ElapsedMillis()
 #endif
 
@@ -147,6 +149,16 @@ namespace HBL2
 		void ReleaseFrameSlot(int32_t acquiredIndex);
 		void ClearFrameDataBuffer();
 		inline uint32_t GetFrameWriteIndex() const { HBL2_CORE_ASSERT(m_ReservedWriteIndex != UINT32_MAX, "WriteIndex not reserved!"); return m_ReservedWriteIndex; }
+
+		/**
+		 * @brief Returns the arena of the frame slot currently being written by the game thread.
+		 *
+		 * Memory allocated here stays valid until the render thread releases the slot (ReleaseFrameSlot),
+		 * so the render thread can read it in place, without any copies.
+		 * Only to be used by the game thread between WaitAndBegin and MarkAndSubmit.
+		 */
+		inline Arena& GetFrameArena() { return m_FrameArenas[GetFrameWriteIndex()]; }
+		inline Arena& GetFrameArena(uint32_t frameIndex) { return m_FrameArenas[frameIndex]; }
 		void ResetForSceneChange();
 		void ShutdownRenderThread();
 
@@ -188,6 +200,7 @@ namespace HBL2
 		GraphicsAPI GetAPI() const { return m_GraphicsAPI; }
 
 		UniformRingBuffer* TempUniformRingBuffer = nullptr;
+		UniformRingBuffer* TempInstanceRingBuffer = nullptr; // Bound as a storage buffer on slot 1 of the dynamic bindings layout.
 		ShadowAtlasAllocator ShadowAtlasAllocator{};
 
 		Handle<Texture> IntermediateColorTexture;
@@ -230,8 +243,12 @@ namespace HBL2
 	protected:
 
 		FrameData m_Frames[FrameCount];
+		PoolReservation* m_FrameArenaReservations[FrameCount]{};
+		Arena m_FrameArenas[FrameCount];
 		uint32_t m_UniformRingBufferSize = 32_MB * FrameCount;
 		uint32_t m_UniformRingBufferFrameOffsets[FrameCount];
+		uint32_t m_InstanceRingBufferSize = 0;
+		uint32_t m_InstanceRingBufferFrameOffsets[FrameCount];
 
 		bool m_FrameReady[FrameCount];
 		bool m_FrameInUse[FrameCount];
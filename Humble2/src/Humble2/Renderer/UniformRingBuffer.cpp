@@ -5,15 +5,15 @@
 
 namespace HBL2
 {
-	UniformRingBuffer::UniformRingBuffer(uint32_t size, uint32_t uniformOffset)
-		: m_BufferSize(size), m_UniformOffset(uniformOffset), m_CurrentOffset(0)
+	UniformRingBuffer::UniformRingBuffer(uint32_t size, uint32_t uniformOffset, BufferUsage usage, const char* debugName, uint32_t persistentSize)
+		: m_BufferSize(size + persistentSize), m_RingSize(size), m_UniformOffset(uniformOffset), m_CurrentOffset(0)
 	{
 		m_Reservation = Allocator::Arena.Reserve("UniformRingBufferPool", m_BufferSize);
 		m_Arena.Initialize(&Allocator::Arena, m_BufferSize, m_Reservation);
 
 		m_Buffer = ResourceManager::Instance->CreateBuffer({
-			.debugName = "dynamic-uniform-buffer",
-			.usage = BufferUsage::UNIFORM,
+			.debugName = debugName,
+			.usage = usage,
 			.usageHint = BufferUsageHint::DYNAMIC,
 			.memoryUsage = MemoryUsage::CPU_GPU,
 			.byteSize = m_BufferSize,
@@ -28,7 +28,36 @@ namespace HBL2
 
 	void UniformRingBuffer::Invalidate(uint32_t startOffset)
 	{
-		m_CurrentOffset = startOffset;
+		m_CurrentOffset.store(startOffset, std::memory_order_release);
+	}
+
+	bool UniformRingBuffer::ClaimPersistentRegion(const void* owner)
+	{
+		if (m_PersistentOwner == owner)
+		{
+			return false;
+		}
+
+		m_PersistentOwner = owner;
+		return true;
+	}
+
+	uint32_t UniformRingBuffer::Reserve(uint32_t byteSize)
+	{
+		uint32_t offset = m_CurrentOffset.load(std::memory_order_relaxed);
+
+		// Only advance if the reservation fits, so a failed one leaves the offset usable for smaller requests.
+		do
+		{
+			if (offset + byteSize > m_RingSize)
+			{
+				HBL2_CORE_FATAL("UniformRingBuffer ran out of space, consider increasing it through the project settings.");
+				return UINT32_MAX;
+			}
+		}
+		while (!m_CurrentOffset.compare_exchange_weak(offset, offset + byteSize, std::memory_order_acq_rel, std::memory_order_relaxed));
+
+		return offset;
 	}
 
 	void UniformRingBuffer::Free()
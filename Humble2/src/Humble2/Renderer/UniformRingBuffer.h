@@ -6,6 +6,8 @@
 #include "Resources/Types.h"
 #include "Resources/Handle.h"
 
+#include <atomic>
+
 namespace HBL2
 {
 	template<typename T>
@@ -18,29 +20,85 @@ namespace HBL2
 	class HBL2_API UniformRingBuffer
 	{
 	public:
-		UniformRingBuffer(uint32_t size, uint32_t uniformOffset);
+		/**
+		 * @param persistentSize Bytes after the ring that are never bump allocated, for data kept at stable offsets across frames.
+		 */
+		UniformRingBuffer(uint32_t size, uint32_t uniformOffset, BufferUsage usage = BufferUsage::UNIFORM, const char* debugName = "dynamic-uniform-buffer", uint32_t persistentSize = 0);
 
 		template<typename T>
 		Allocation<T> BumpAllocate()
 		{
 			uint32_t alignedStride = CeilToNextMultiple(sizeof(T), m_UniformOffset);
 
-			if (m_CurrentOffset + alignedStride > m_BufferSize)
+			uint32_t blockIndex = Reserve(alignedStride);
+
+			if (blockIndex == UINT32_MAX)
 			{
-				HBL2_CORE_FATAL("UniformRingBuffer ran out of space, consider increasing it through the project settings.");
 				return {};
 			}
 
-			uint32_t blockIndex = m_CurrentOffset;
-			m_CurrentOffset += alignedStride;
+			return { .Data = (T*)((char*)m_BufferData + blockIndex), .Offset = blockIndex, };
+		}
+
+		/**
+		 * @brief Bump allocates a contiguous array of count elements.
+		 */
+		template<typename T>
+		Allocation<T> BumpAllocate(uint32_t count)
+		{
+			uint32_t blockIndex = Reserve(CeilToNextMultiple(sizeof(T) * count, m_UniformOffset));
+
+			if (blockIndex == UINT32_MAX)
+			{
+				return {};
+			}
 
 			return { .Data = (T*)((char*)m_BufferData + blockIndex), .Offset = blockIndex, };
 		}
 
+		/**
+		 * @brief Bump allocates count elements with a single reservation, element i lives at Offset + i * GetAlignedSize(sizeof(T)).
+		 *
+		 * @note Unlike BumpAllocate(count), every element is aligned so it can be bound on its own.
+		 */
+		template<typename T>
+		Allocation<T> BumpAllocateElements(uint32_t count)
+		{
+			uint32_t blockIndex = Reserve(CeilToNextMultiple(sizeof(T), m_UniformOffset) * count);
+
+			if (blockIndex == UINT32_MAX)
+			{
+				return {};
+			}
+
+			return { .Data = (T*)((char*)m_BufferData + blockIndex), .Offset = blockIndex, };
+		}
+
+		/**
+		 * @brief The CPU side copy of data allocated earlier in the frame, at the offset returned by BumpAllocate.
+		 */
+		template<typename T>
+		const T* GetData(uint32_t offset) const { return (const T*)((const char*)m_BufferData + offset); }
+
+		/**
+		 * @brief The CPU side copy of the persistent region at a buffer offset, written in place and uploaded with MapBufferData.
+		 */
+		template<typename T>
+		T* GetPersistentData(uint32_t offset) { return (T*)((char*)m_BufferData + offset); }
+
+		/**
+		 * @brief Makes the caller the user of the persistent region.
+		 *
+		 * @return True when someone else wrote the region since the caller last claimed it, so its contents there are stale.
+		 */
+		bool ClaimPersistentRegion(const void* owner);
+
 		Handle<Buffer> GetBuffer() const { return m_Buffer; }
 		uint32_t GetBufferSize() const { return m_BufferSize; }
+		uint32_t GetPersistentOffset() const { return m_RingSize; }
+		uint32_t GetPersistentSize() const { return m_BufferSize - m_RingSize; }
 
-		const uint32_t GetCurrentOffset() const { return m_CurrentOffset; }
+		const uint32_t GetCurrentOffset() const { return m_CurrentOffset.load(std::memory_order_acquire); }
 		const uint32_t GetAlignedSize(uint32_t byteSize) { return CeilToNextMultiple(byteSize, m_UniformOffset); }
 
 		void Invalidate(uint32_t startOffset = 0);
@@ -50,10 +108,14 @@ namespace HBL2
 		static uint32_t CeilToNextMultiple(uint32_t value, uint32_t step);
 
 	private:
+		uint32_t Reserve(uint32_t byteSize);
+
 		Handle<Buffer> m_Buffer;
 		void* m_BufferData;
 		uint32_t m_BufferSize;
-		uint32_t m_CurrentOffset;
+		uint32_t m_RingSize;
+		const void* m_PersistentOwner = nullptr;
+		std::atomic<uint32_t> m_CurrentOffset;
 		uint32_t m_UniformOffset;
 
 		PoolReservation* m_Reservation = nullptr;
@@ -8,26 +8,32 @@ namespace HBL2
 	class Handle
 	{
 	public:
+		// 24-bit slot index and 8-bit generation, packed into 32 bits.
+		static constexpr uint32_t IndexBits = 24;
+		static constexpr uint32_t GenerationBits = 8;
+		static constexpr uint32_t InvalidIndex = (1u << IndexBits) - 1;
+		static constexpr uint32_t MaxSlots = InvalidIndex;
+
 		Handle() : m_ArrayIndex(0), m_GenerationalCounter(0) {}
 
 		bool IsValid() const { return m_GenerationalCounter != 0; }
 		bool operator==(const Handle<T>& other) const { return m_ArrayIndex == other.m_ArrayIndex && m_GenerationalCounter == other.m_GenerationalCounter; }
 		bool operator!=(const Handle<T>& other) const { return m_ArrayIndex != other.m_ArrayIndex || m_GenerationalCounter != other.m_GenerationalCounter; }
 
-		uint32_t HashKey() const { return (((uint32_t)m_ArrayIndex) << 16) + (uint32_t)m_GenerationalCounter; }
-		uint32_t Pack() const { return (static_cast<uint32_t>(m_ArrayIndex) << 16) | m_GenerationalCounter; }
-		uint16_t Index() const { return m_ArrayIndex; }
-		uint16_t Generation() const { return m_GenerationalCounter; }
+		uint32_t HashKey() const { return Pack(); }
+		uint32_t Pack() const { return (static_cast<uint32_t>(m_ArrayIndex) << GenerationBits) | static_cast<uint32_t>(m_GenerationalCounter); }
+		uint32_t Index() const { return m_ArrayIndex; }
+		uint8_t Generation() const { return static_cast<uint8_t>(m_GenerationalCounter); }
 
-		static Handle<T> UnPack(uint32_t packedHandle) { return { static_cast<uint16_t>(packedHandle >> 16), static_cast<uint16_t>(packedHandle & 0xFFFF) }; }
+		static Handle<T> UnPack(uint32_t packedHandle) { return { packedHandle >> GenerationBits, static_cast<uint8_t>(packedHandle & 0xFFu) }; }
 
 	private:
-		Handle(uint16_t arrayIndex, uint16_t generationalCounter) : m_ArrayIndex(arrayIndex), m_GenerationalCounter(generationalCounter) {}
+		Handle(uint32_t arrayIndex, uint8_t generationalCounter) : m_ArrayIndex(arrayIndex), m_GenerationalCounter(generationalCounter) {}
 
-		uint16_t m_ArrayIndex;
-		uint16_t m_GenerationalCounter;
+		uint32_t m_ArrayIndex : IndexBits;
+		uint32_t m_GenerationalCounter : GenerationBits;
 
 		template<typename U, typename H> friend class Pool;
 		template<typename UH, typename UC, typename H> friend class SplitPool;
 	};
-}
\ No newline at end of file
+}
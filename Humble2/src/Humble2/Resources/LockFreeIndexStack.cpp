@@ -2,38 +2,31 @@
 
 namespace HBL2
 {
-    void LockFreeIndexStack::Initialize(std::atomic<uint16_t>* next, uint32_t count)
+    void LockFreeIndexStack::Initialize(PagedArray<std::atomic<uint32_t>>* next, uint32_t count)
     {
         m_Next = next;
-        m_Count = count;
-
-        // Build a simple forward chain: 0 -> 1 -> 2 -> ... -> Invalid
-        for (uint32_t i = 0; i < count; ++i)
-        {
-            uint16_t nxt = (i + 1 < count) ? static_cast<uint16_t>(i + 1) : InvalidIndex;
-            m_Next[i].store(nxt, std::memory_order_relaxed);
-        }
+        m_Count.store(0, std::memory_order_relaxed);
+        m_Head.store(PackHead(InvalidIndex, 0u), std::memory_order_release);
 
-        // Head = 0, tag = 0
-        m_Head.store(PackHead(0u, 0u), std::memory_order_release);
+        AddRange(0, count);
     }
 
-    uint16_t LockFreeIndexStack::Pop()
+    uint32_t LockFreeIndexStack::Pop()
     {
         // Returns InvalidIndex if empty
         while (true)
         {
-            uint32_t oldHead = m_Head.load(std::memory_order_acquire);
-            const uint16_t idx = UnpackIndex(oldHead);
-            const uint16_t tag = UnpackTag(oldHead);
+            uint64_t oldHead = m_Head.load(std::memory_order_acquire);
+            const uint32_t idx = UnpackIndex(oldHead);
+            const uint32_t tag = UnpackTag(oldHead);
 
             if (idx == InvalidIndex)
             {
                 return InvalidIndex;
             }
 
-            const uint16_t next = m_Next[idx].load(std::memory_order_relaxed);
-            const uint32_t newHead = PackHead(next, static_cast<uint16_t>(tag + 1));
+            const uint32_t next = (*m_Next)[idx].load(std::memory_order_relaxed);
+            const uint64_t newHead = PackHead(next, tag + 1);
 
             if (m_Head.compare_exchange_weak(oldHead, newHead, std::memory_order_acq_rel, std::memory_order_acquire))
             {
@@ -42,16 +35,48 @@ namespace HBL2
         }
     }
 
-    void LockFreeIndexStack::Push(uint16_t idx)
+    void LockFreeIndexStack::Push(uint32_t idx)
+    {
+        while (true)
+        {
+            uint64_t oldHead = m_Head.load(std::memory_order_acquire);
+            const uint32_t headIdx = UnpackIndex(oldHead);
+            const uint32_t tag = UnpackTag(oldHead);
+
+            (*m_Next)[idx].store(headIdx, std::memory_order_relaxed);
+            const uint64_t newHead = PackHead(idx, tag + 1);
+
+            if (m_Head.compare_exchange_weak(oldHead, newHead, std::memory_order_acq_rel, std::memory_order_acquire))
+            {
+                return;
+            }
+        }
+    }
+
+    void LockFreeIndexStack::AddRange(uint32_t first, uint32_t count)
     {
+        if (count == 0)
+        {
+            return;
+        }
+
+        // Build a forward chain first -> first + 1 -> ... -> last, then splice it in front of the current head with a single CAS.
+        const uint32_t last = first + count - 1;
+        for (uint32_t i = first; i < last; ++i)
+        {
+            (*m_Next)[i].store(i + 1, std::memory_order_relaxed);
+        }
+
+        m_Count.fetch_add(count, std::memory_order_relaxed);
+
         while (true)
         {
-            uint32_t oldHead = m_Head.load(std::memory_order_acquire);
-            const uint16_t headIdx = UnpackIndex(oldHead);
-            const uint16_t tag = UnpackTag(oldHead);
+            uint64_t oldHead = m_Head.load(std::memory_order_acquire);
+            const uint32_t headIdx = UnpackIndex(oldHead);
+            const uint32_t tag = UnpackTag(oldHead);
 
-            m_Next[idx].store(headIdx, std::memory_order_relaxed);
-            const uint32_t newHead = PackHead(idx, static_cast<uint16_t>(tag + 1));
+            (*m_Next)[last].store(headIdx, std::memory_order_relaxed);
+            const uint64_t newHead = PackHead(first, tag + 1);
 
             if (m_Head.compare_exchange_weak(oldHead, newHead, std::memory_order_acq_rel, std::memory_order_acquire))
             {
@@ -62,7 +87,7 @@ namespace HBL2
 
     bool LockFreeIndexStack::Empty() const
     {
-        const uint16_t idx = UnpackIndex(m_Head.load(std::memory_order_acquire));
+        const uint32_t idx = UnpackIndex(m_Head.load(std::memory_order_acquire));
         return idx == InvalidIndex;
     }
 
@@ -74,35 +99,35 @@ namespace HBL2
 
     uint32_t LockFreeIndexStack::Count() const
     {
-        return m_Count;
+        return m_Count.load(std::memory_order_relaxed);
     }
 
     uint32_t LockFreeIndexStack::NonInvalidCount() const
     {
         uint32_t count = 0;
 
-        uint16_t idx = UnpackIndex(m_Head.load(std::memory_order_acquire));
+        uint32_t idx = UnpackIndex(m_Head.load(std::memory_order_acquire));
         while (idx != InvalidIndex)
         {
             ++count;
-            idx = m_Next[idx].load(std::memory_order_relaxed);
+            idx = (*m_Next)[idx].load(std::memory_order_relaxed);
         }
 
-        return m_Count - count;
+        return m_Count.load(std::memory_order_relaxed) - count;
     }
 
-    uint32_t LockFreeIndexStack::PackHead(uint16_t index, uint16_t tag)
+    uint64_t LockFreeIndexStack::PackHead(uint32_t index, uint32_t tag)
     {
-        return (static_cast<uint32_t>(tag) << 16) | static_cast<uint32_t>(index);
+        return (static_cast<uint64_t>(tag) << 32) | static_cast<uint64_t>(index);
     }
 
-    uint16_t LockFreeIndexStack::UnpackIndex(uint32_t head)
+    uint32_t LockFreeIndexStack::UnpackIndex(uint64_t head)
     {
-        return static_cast<uint16_t>(head & 0xFFFFu);
+        return static_cast<uint32_t>(head & 0xFFFFFFFFu);
     }
 
-    uint16_t LockFreeIndexStack::UnpackTag(uint32_t head)
+    uint32_t LockFreeIndexStack::UnpackTag(uint64_t head)
     {
-        return static_cast<uint16_t>((head >> 16) & 0xFFFFu);
-    }    
-}
+        return static_cast<uint32_t>(head >> 32);
+    }
+}
\ No newline at end of file
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "PagedArray.h"
+
 #include <atomic>
 #include <cstdint>
 
@@ -8,29 +10,30 @@ namespace HBL2
     class LockFreeIndexStack
     {
     public:
-        static constexpr uint16_t InvalidIndex = 0xFFFF;
+        static constexpr uint32_t InvalidIndex = 0xFFFFFFFF;
 
         LockFreeIndexStack() = default;
 
         LockFreeIndexStack(const LockFreeIndexStack&) = delete;
         LockFreeIndexStack& operator=(const LockFreeIndexStack&) = delete;
 
-        void Initialize(std::atomic<uint16_t>* next, uint32_t count);
-        uint16_t Pop();
-        void Push(uint16_t idx);
+        void Initialize(PagedArray<std::atomic<uint32_t>>* next, uint32_t count);
+        uint32_t Pop();
+        void Push(uint32_t idx);
+        void AddRange(uint32_t first, uint32_t count);
         bool Empty() const;
         void ClearToEmpty();
         uint32_t Count() const;
         uint32_t NonInvalidCount() const;
 
     private:
-        static uint32_t PackHead(uint16_t index, uint16_t tag);
-        static uint16_t UnpackIndex(uint32_t head);
-        static uint16_t UnpackTag(uint32_t head);
+        static uint64_t PackHead(uint32_t index, uint32_t tag);
+        static uint32_t UnpackIndex(uint64_t head);
+        static uint32_t UnpackTag(uint64_t head);
 
     private:
-        std::atomic<uint32_t> m_Head{ PackHead(InvalidIndex, 0u) };
-        std::atomic<uint16_t>* m_Next = nullptr;
-        uint32_t m_Count = 0;
+        std::atomic<uint64_t> m_Head{ PackHead(InvalidIndex, 0u) };
+        PagedArray<std::atomic<uint32_t>>* m_Next = nullptr;
+        std::atomic<uint32_t> m_Count = 0;
     };
-}
\ No newline at end of file
+}
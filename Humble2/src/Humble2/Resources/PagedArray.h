@@ -0,0 +1,105 @@
+#pragma once
+
+#include "Core/Allocators.h"
+#include "Utilities/Allocators/Arena.h"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+
+namespace HBL2
+{
+    /**
+     * @brief Slot storage that grows in pages, existing slots never move.
+     *
+     * Page 0 holds the first page size (rounded up to a power of two) slots and every following page doubles
+     * the total, so locating a slot is an add, a bit scan and a subtract, with no locks and no reallocation.
+     * Each page is its own MainArena reservation. Slots are zero filled raw storage, constructing and
+     * destructing elements is left to the owner.
+     */
+    template<typename T>
+    class PagedArray
+    {
+    public:
+        static constexpr uint32_t MaxPages = 25; // Enough to address 2^24 slots with a single slot first page.
+
+        PagedArray() = default;
+
+        PagedArray(const PagedArray&) = delete;
+        PagedArray& operator=(const PagedArray&) = delete;
+
+        void Initialize(const char* name, uint32_t firstPageSize)
+        {
+            m_Name = name;
+            m_FirstPageShift = (uint32_t)std::bit_width(std::bit_ceil(std::max(firstPageSize, 1u))) - 1;
+            m_PageCount = 0;
+            m_Capacity.store(0, std::memory_order_relaxed);
+
+            Grow();
+        }
+
+        /**
+         * @brief Appends the next page.
+         *
+         * @note Not safe to call concurrently with itself, owners serialize growth. Concurrent slot access is fine,
+         *       the page is published before the capacity that makes its slots reachable.
+         *
+         * @return False if the maximum page count was reached.
+         */
+        bool Grow()
+        {
+            if (m_PageCount == MaxPages)
+            {
+                return false;
+            }
+
+            const uint32_t page = m_PageCount;
+            const uint32_t pageSize = 1u << (m_FirstPageShift + page);
+
+            const size_t bytes = ArenaLayout::Create()
+                .Add<T>(pageSize)
+                .Total();
+
+            m_Pages[page].Reservation = Allocator::Arena.Reserve(m_Name, bytes);
+            m_Pages[page].PageArena.Initialize(&Allocator::Arena, bytes, m_Pages[page].Reservation);
+
+            T* data = (T*)m_Pages[page].PageArena.Alloc(sizeof(T) * pageSize, alignof(T));
+            std::memset((void*)data, 0, sizeof(T) * pageSize);
+
+            m_PageData[page] = data;
+            m_PageCount = page + 1;
+
+            m_Capacity.store(m_Capacity.load(std::memory_order_relaxed) + pageSize, std::memory_order_release);
+
+            return true;
+        }
+
+        T& operator[](uint32_t index) const
+        {
+            const uint32_t biased = index + (1u << m_FirstPageShift);
+            const uint32_t page = (uint32_t)std::bit_width(biased) - 1 - m_FirstPageShift;
+            return m_PageData[page][biased - (1u << (m_FirstPageShift + page))];
+        }
+
+        uint32_t Capacity() const { return m_Capacity.load(std::memory_order_acquire); }
+
+        uint32_t PageCount() const { return m_PageCount; }
+
+    private:
+        struct Page
+        {
+            PoolReservation* Reservation = nullptr;
+            Arena PageArena;
+        };
+
+        T* m_PageData[MaxPages] = {};
+        uint32_t m_FirstPageShift = 0;
+        uint32_t m_PageCount = 0;
+        std::atomic<uint32_t> m_Capacity{ 0 };
+
+        const char* m_Name = "PagedArray";
+        Page m_Pages[MaxPages];
+    };
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Handle.h"
+#include "PagedArray.h"
 #include "LockFreeIndexStack.h"
 #include "Utilities/Collections/Span.h"
 
@@ -9,6 +10,7 @@
 
 #include <atomic>
 #include <cstdint>
+#include <mutex>
 #include <new>
 #include <type_traits>
 
@@ -18,7 +20,7 @@ namespace HBL2
     class Pool
     {
     public:
-        static constexpr uint16_t InvalidIndex = LockFreeIndexStack::InvalidIndex;
+        static constexpr uint32_t InvalidIndex = Handle<H>::InvalidIndex;
 
         Pool() = default;
 
@@ -31,53 +33,49 @@ namespace HBL2
         {
         }
 
+        /**
+         * @brief Sets up the first page of the pool.
+         *
+         * @param size The initial number of slots, the pool grows in pages when they run out (up to Handle<H>::MaxSlots).
+         */
         void Initialize(uint32_t size)
         {
-            m_Size = size;
-
-            if (m_Size == 0 || m_Size > 0xFFFEu)
+            if (size == 0 || size > Handle<H>::MaxSlots)
             {
-                m_Size = 32;
+                size = 32;
             }
 
-            size_t bytes = ArenaLayout::Create()
-                .Add<T>(m_Size)
-                .template Add<std::atomic<uint16_t>>(m_Size)
-                .template Add<std::atomic<uint16_t>>(m_Size)
-                .Total();
-
-            m_Reservation = Allocator::Arena.Reserve("PoolReservation", bytes);
-            m_PoolArena.Initialize(&Allocator::Arena, bytes, m_Reservation);
-
-            m_Data = (T*)m_PoolArena.Alloc(sizeof(T) * m_Size, alignof(T));
-
-            void* generationalCounterMem = m_PoolArena.Alloc(sizeof(std::atomic<uint16_t>) * m_Size, alignof(std::atomic<uint16_t>));
-            m_GenerationalCounter = m_PoolArena.ConstructArray<std::atomic<uint16_t>>(generationalCounterMem, m_Size, 0);
+            m_Data.Initialize("PoolReservation", size);
+            m_GenerationalCounter.Initialize("PoolReservation", size);
+            m_NextFree.Initialize("PoolReservation", size);
 
-            void* nextFreeMem = m_PoolArena.Alloc(sizeof(std::atomic<uint16_t>) * m_Size, alignof(std::atomic<uint16_t>));
-            m_NextFree = m_PoolArena.ConstructArray<std::atomic<uint16_t>>(nextFreeMem, m_Size, 0);
+            const uint32_t capacity = std::min(m_Data.Capacity(), Handle<H>::MaxSlots);
 
-            for (uint32_t i = 0; i < m_Size; ++i)
+            for (uint32_t i = 0; i < capacity; ++i)
             {
                 m_GenerationalCounter[i].store(1, std::memory_order_relaxed);
             }
 
-            m_FreeList.Initialize(m_NextFree, m_Size);
+            m_FreeList.Initialize(&m_NextFree, capacity);
         }
 
         template <typename Arg>
         Handle<H> Insert(const Arg&& arg)
         {
-            const uint16_t index = m_FreeList.Pop();
-            if (index == InvalidIndex)
+            uint32_t index = m_FreeList.Pop();
+            if (index == LockFreeIndexStack::InvalidIndex)
             {
-                HBL2_CORE_ASSERT(false, "Exhausted available Pool indeces!");
-                return {};
+                index = Grow();
+                if (index == LockFreeIndexStack::InvalidIndex)
+                {
+                    HBL2_CORE_ASSERT(false, "Exhausted available Pool indeces!");
+                    return {};
+                }
             }
 
             new (&m_Data[index]) T(std::forward<const Arg>(arg));
 
-            const uint16_t gen = m_GenerationalCounter[index].load(std::memory_order_relaxed);
+            const uint8_t gen = m_GenerationalCounter[index].load(std::memory_order_relaxed);
             return { index, gen };
         }
 
@@ -88,19 +86,25 @@ namespace HBL2
                 return;
             }
 
-            const uint16_t idx = handle.m_ArrayIndex;
-            if (idx == InvalidIndex || idx >= m_Size)
+            const uint32_t idx = handle.m_ArrayIndex;
+            if (idx >= m_Data.Capacity())
             {
                 return;
             }
 
-            const uint16_t cur = m_GenerationalCounter[idx].load(std::memory_order_acquire);
+            uint8_t cur = m_GenerationalCounter[idx].load(std::memory_order_acquire);
             if (cur != handle.m_GenerationalCounter)
             {
                 return;
             }
 
-            m_GenerationalCounter[idx].fetch_add(1, std::memory_order_acq_rel);
+            // Generation 0 marks invalid handles, skip it when wrapping around.
+            const uint8_t next = (cur == 0xFF) ? 1 : cur + 1;
+            if (!m_GenerationalCounter[idx].compare_exchange_strong(cur, next, std::memory_order_acq_rel))
+            {
+                return;
+            }
+
             m_FreeList.Push(idx);
         }
 
@@ -111,14 +115,14 @@ namespace HBL2
                 return nullptr;
             }
 
-            const uint16_t idx = handle.m_ArrayIndex;
-            if (idx == InvalidIndex || idx >= m_Size)
+            const uint32_t idx = handle.m_ArrayIndex;
+            if (idx >= m_Data.Capacity())
             {
                 HBL2_CORE_ASSERT(false, "Exhausted available Pool indeces!");
                 return nullptr;
             }
 
-            const uint16_t gen = m_GenerationalCounter[idx].load(std::memory_order_acquire);
+            const uint8_t gen = m_GenerationalCounter[idx].load(std::memory_order_acquire);
             if (gen != handle.m_GenerationalCounter)
             {
                 return nullptr;
@@ -127,14 +131,17 @@ namespace HBL2
             return &m_Data[idx];
         }
 
-        const Span<T> GetDataPool() const
+        /**
+         * @brief Returns the slot at the index, live or not, meant for linear scans over [0, Capacity()).
+         */
+        T& GetAt(uint32_t index) const
         {
-            return { m_Data, m_Size };
+            return m_Data[index];
         }
 
-        Handle<H> GetHandleFromIndex(uint16_t index) const
+        Handle<H> GetHandleFromIndex(uint32_t index) const
         {
-            if (index == InvalidIndex || index >= m_Size)
+            if (index >= m_Data.Capacity())
             {
                 return {};
             }
@@ -142,20 +149,57 @@ namespace HBL2
             return { index, m_GenerationalCounter[index].load(std::memory_order_acquire) };
         }
 
-        uint32_t Capacity() const { return m_Size; }
+        uint32_t Capacity() const { return std::min(m_Data.Capacity(), Handle<H>::MaxSlots); }
 
         uint32_t FreeSlotCount() const { return m_FreeList.NonInvalidCount(); }
 
     private:
-        LockFreeIndexStack m_FreeList;
+        uint32_t Grow()
+        {
+            std::lock_guard<std::mutex> lock(m_GrowMutex);
 
-        std::atomic<uint16_t>* m_NextFree = nullptr;
-        T* m_Data = nullptr;
-        std::atomic<uint16_t>* m_GenerationalCounter = nullptr;
+            // Another thread may have grown the pool while we were waiting.
+            const uint32_t index = m_FreeList.Pop();
+            if (index != LockFreeIndexStack::InvalidIndex)
+            {
+                return index;
+            }
+
+            const uint32_t oldCapacity = Capacity();
+            if (oldCapacity == Handle<H>::MaxSlots)
+            {
+                return LockFreeIndexStack::InvalidIndex;
+            }
+
+            // Generations and links are published before the data page, Get bounds checks against the data capacity.
+            m_GenerationalCounter.Grow();
+            m_NextFree.Grow();
+
+            const uint32_t newCapacity = std::min(m_GenerationalCounter.Capacity(), Handle<H>::MaxSlots);
+            for (uint32_t i = oldCapacity; i < newCapacity; ++i)
+            {
+                m_GenerationalCounter[i].store(1, std::memory_order_relaxed);
+            }
+
+            m_Data.Grow();
+
+            if (newCapacity == oldCapacity)
+            {
+                return LockFreeIndexStack::InvalidIndex;
+            }
+
+            // The first new slot goes straight to the caller, a Pop could lose it to another thread and find the list empty again.
+            m_FreeList.AddRange(oldCapacity + 1, newCapacity - oldCapacity - 1);
+
+            return oldCapacity;
+        }
+
+        LockFreeIndexStack m_FreeList;
 
-        uint32_t m_Size = 32;
+        PagedArray<T> m_Data;
+        PagedArray<std::atomic<uint8_t>> m_GenerationalCounter;
+        PagedArray<std::atomic<uint32_t>> m_NextFree;
 
-        PoolReservation* m_Reservation = nullptr;
-        Arena m_PoolArena;
+        std::mutex m_GrowMutex;
     };
 }
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "Utilities/Collections/StaticFunction.h"
+
+#include <stdint.h>
+
+namespace HBL2
+{
+	enum class ResourceBudgetCategory : uint8_t
+	{
+		Textures = 0,
+		Meshes,		// Vertex and index buffers.
+		Buffers,	// Every other buffer (uniform, storage, indirect, ...).
+		Shaders,
+		Sounds,
+		Count,
+	};
+
+	// Soft memory limit of a resource category in MB, 0 means unlimited.
+	struct ResourceBudget
+	{
+		uint32_t CPU = 0;
+		uint32_t GPU = 0;
+	};
+
+	struct ResourceBudgetUsage
+	{
+		uint64_t CPUBytes = 0;
+		uint64_t GPUBytes = 0;
+		uint64_t PeakCPUBytes = 0;
+		uint64_t PeakGPUBytes = 0;
+		uint64_t CPULimitBytes = 0;
+		uint64_t GPULimitBytes = 0;
+
+		bool OverBudget() const
+		{
+			return (CPULimitBytes != 0 && CPUBytes > CPULimitBytes) || (GPULimitBytes != 0 && GPUBytes > GPULimitBytes);
+		}
+	};
+
+	using ResourceBudgetCallback = StaticFunction<void(ResourceBudgetCategory, const ResourceBudgetUsage&), 64>;
+
+	// Resources whose GPU residency is tracked from the draws the scene renderer gathers.
+	enum class ResidencyKind : uint8_t
+	{
+		Texture = 0,
+		Mesh,
+		Count,
+	};
+
+	struct ResidencyUsage
+	{
+		uint64_t GPUBytes = 0;
+		uint64_t GPULimitBytes = 0;
+		bool DriverReported = false; // True when the numbers come from the backend (e.g. the VMA heap budget) instead of the tracked footprints.
+	};
+
+	// Asked to release a resource that has not been drawn recently, gets the packed handle of a Handle<Texture> or Handle<Mesh>.
+	// Returns false if it does not own the resource or can not bring it back later, the resource is then never offered again.
+	using ResidencyEvictionCallback = StaticFunction<bool(ResidencyKind, uint32_t), 64>;
+}
@@ -2,109 +2,105 @@
 
 namespace HBL2
 {
-    void ResourceDeletionQueue::Push(uint64_t frame, std::function<void()>&& deletor)
+    void ResourceDeletionQueue::Push(uint64_t frame, Deletor&& deletor)
     {
         if (!deletor)
         {
             return;
         }
 
-        std::lock_guard<std::mutex> lock(m_Mutex);
-
-        if (m_Size >= m_Capacity)
-        {
-            Resize();
-        }
-
-        // We mark the item to be deleted on frame ahead to ensure the GPU will be done with it.
-        // Thats because of the double buffering set up, on Renderer::BeginFrame we only wait for the new
-        // frame fence to be done, no the one that was just rendering.
-        uint64_t itemFrame = frame + 1;
-
-        m_Buffer[m_Tail] = { itemFrame, std::move(deletor) };
-        m_Tail = (m_Tail + 1) % m_Capacity;
-        ++m_Size;
+        m_Deletors.enqueue({ RetireFrame(frame), std::move(deletor) });
     }
 
-    void ResourceDeletionQueue::Flush(uint64_t currentFrame)
+    void ResourceDeletionQueue::Collect(uint64_t currentFrame)
     {
-        m_FlushTemp.clear();
+        Entry entries[256];
+        size_t count = 0;
 
+        while ((count = m_Entries.try_dequeue_bulk(entries, 256)) != 0)
         {
-            std::lock_guard<std::mutex> lock(m_Mutex);
-
-            while (m_Size > 0)
+            for (size_t i = 0; i < count; ++i)
             {
-                const DeleteItem& item = m_Buffer[m_Head];
-                if (item.Frame >= currentFrame)
-                {
-                    // Stop processing as the current item is not ready for deletion.
-                    break;
-                }
-
-                m_FlushTemp.push_back(std::move(m_Buffer[m_Head]));
-                m_Head = (m_Head + 1) % m_Capacity;
-                --m_Size;
+                StageEntry(entries[i]);
             }
         }
 
-        // Run deletors outside the lock.
-        for (DeleteItem& item : m_FlushTemp)
+        DeleteItem item;
+        while (m_Deletors.try_dequeue(item))
         {
-            if (item.Deletor)
-            {
-                item.Deletor();
-            }
+            m_PendingDeletors.push_back(std::move(item));
         }
-    }
 
-    void ResourceDeletionQueue::FlushAll()
-    {
-        while (true)
-        {
-            m_FlushTemp.clear();
+        std::apply([currentFrame](auto&... batch) { (Retire(batch, currentFrame), ...); }, m_Batches);
 
-            {
-                std::lock_guard<std::mutex> lock(m_Mutex);
+        m_RetiredDeletors.clear();
 
-                while (m_Size > 0)
-                {
-                    m_FlushTemp.push_back(std::move(m_Buffer[m_Head]));
-                    m_Head = (m_Head + 1) % m_Capacity;
-                    --m_Size;
-                }
-            }
-
-            if (m_FlushTemp.empty())
+        size_t kept = 0;
+        for (size_t i = 0; i < m_PendingDeletors.size(); ++i)
+        {
+            if (m_PendingDeletors[i].Frame < currentFrame)
             {
-                break;
+                m_RetiredDeletors.push_back(std::move(m_PendingDeletors[i]));
             }
-
-            for (DeleteItem& item : m_FlushTemp)
+            else
             {
-                if (item.Deletor)
-                {
-                    item.Deletor();
-                }
+                m_PendingDeletors[kept++] = std::move(m_PendingDeletors[i]);
             }
         }
+
+        m_PendingDeletors.resize(kept);
     }
 
-    void ResourceDeletionQueue::Resize()
+    void ResourceDeletionQueue::RunRetiredDeletors()
     {
-        size_t newCapacity = m_Capacity * 2;
-        std::vector<DeleteItem> newBuffer(newCapacity);
+        for (DeleteItem& item : m_RetiredDeletors)
+        {
+            item.Callback();
+        }
 
-        for (size_t i = 0; i < m_Size; ++i)
+        m_RetiredDeletors.clear();
+    }
+
+    bool ResourceDeletionQueue::IsEmpty() const
+    {
+        if (m_Entries.size_approx() != 0 || m_Deletors.size_approx() != 0 || !m_PendingDeletors.empty())
         {
-            newBuffer[i] = std::move(m_Buffer[(m_Head + i) % m_Capacity]);
+            return false;
         }
 
-        m_Buffer = std::move(newBuffer);
-        m_Capacity = newCapacity;
-        m_Head = 0;
-        m_Tail = m_Size;
+        bool empty = true;
+        std::apply([&empty](const auto&... batch) { ((empty = empty && batch.Pending.empty()), ...); }, m_Batches);
+        return empty;
+    }
 
-        HBL2_CORE_INFO("[ResourceDeletionQueue] Resized buffer to capacity: {0}", m_Capacity);
+    void ResourceDeletionQueue::StageEntry(const Entry& entry)
+    {
+        switch (entry.Kind)
+        {
+        case DeletionKind::Texture:
+            Stage<Texture>(entry);
+            break;
+        case DeletionKind::Buffer:
+            Stage<Buffer>(entry);
+            break;
+        case DeletionKind::Shader:
+            Stage<Shader>(entry);
+            break;
+        case DeletionKind::BindGroup:
+            Stage<BindGroup>(entry);
+            break;
+        case DeletionKind::BindGroupLayout:
+            Stage<BindGroupLayout>(entry);
+            break;
+        case DeletionKind::RenderPass:
+            Stage<RenderPass>(entry);
+            break;
+        case DeletionKind::RenderPassLayout:
+            Stage<RenderPassLayout>(entry);
+            break;
+        default:
+            HBL2_CORE_ASSERT(false, "Unknown deletion kind!");
+            break;
+        }
     }
 }
@@ -1,50 +1,169 @@
 #pragma once
 
 #include "Base.h"
+#include "Handle.h"
+#include "BaseTypeDefinitions.h"
+
+#include "Utilities/Collections/Span.h"
+#include "Utilities/Collections/StaticFunction.h"
+
+#include <moodycamel/concurrentqueue.h>
 
 #include <vector>
-#include <functional>
+#include <tuple>
 #include <cstdint>
 
 namespace HBL2
 {
-    struct DeleteItem
+    enum class DeletionKind : uint8_t
     {
-        uint64_t Frame = 0;
-        std::function<void()> Deletor;
+        Texture = 0,
+        Buffer,
+        Shader,
+        BindGroup,
+        BindGroupLayout,
+        RenderPass,
+        RenderPassLayout,
+        Count,
     };
 
+    template<typename T> struct DeletionKindOf;
+    template<> struct DeletionKindOf<Texture> { static constexpr DeletionKind Value = DeletionKind::Texture; };
+    template<> struct DeletionKindOf<Buffer> { static constexpr DeletionKind Value = DeletionKind::Buffer; };
+    template<> struct DeletionKindOf<Shader> { static constexpr DeletionKind Value = DeletionKind::Shader; };
+    template<> struct DeletionKindOf<BindGroup> { static constexpr DeletionKind Value = DeletionKind::BindGroup; };
+    template<> struct DeletionKindOf<BindGroupLayout> { static constexpr DeletionKind Value = DeletionKind::BindGroupLayout; };
+    template<> struct DeletionKindOf<RenderPass> { static constexpr DeletionKind Value = DeletionKind::RenderPass; };
+    template<> struct DeletionKindOf<RenderPassLayout> { static constexpr DeletionKind Value = DeletionKind::RenderPassLayout; };
+
+    using Deletor = StaticFunction<void(void), 64>;
+
+    /**
+     * @brief Defers resource destruction until the GPU frame that last used the resource has retired.
+     *
+     * Any thread can push. Handles travel through a lock-free MPSC queue as 16 byte entries (retire frame, kind,
+     * packed handle), the render thread drains them once per frame into per kind arrays and hands every retired
+     * array to the backend in one call. Deletions that are not a pool handle (old image views, imgui descriptor
+     * sets, shader pipelines replaced by a recompile) go through the Deletor path, which is kept for those few cases.
+     */
     class ResourceDeletionQueue
     {
     public:
-        ResourceDeletionQueue()
-            : m_Capacity(512), m_Buffer(512), m_Head(0), m_Tail(0), m_Size(0)
+        ResourceDeletionQueue() = default;
+
+        template<typename T>
+        void Push(uint64_t frame, Handle<T> handle)
         {
-            m_FlushTemp.reserve(256);
+            if (!handle.IsValid())
+            {
+                return;
+            }
+
+            m_Entries.enqueue({ RetireFrame(frame), handle.Pack(), DeletionKindOf<T>::Value });
         }
 
-        ResourceDeletionQueue(size_t initialCapacity)
-            : m_Capacity(initialCapacity), m_Buffer(initialCapacity), m_Head(0), m_Tail(0), m_Size(0)
+        void Push(uint64_t frame, Deletor&& deletor);
+
+        /**
+         * @brief Drains the queue and moves everything that retired before the current frame into the retired arrays.
+         *
+         * @note Render thread only. The retired arrays stay valid until the next call.
+         */
+        void Collect(uint64_t currentFrame);
+
+        template<typename T>
+        Span<const Handle<T>> GetRetired()
         {
-            m_FlushTemp.reserve(256);
+            return std::get<Batch<T>>(m_Batches).Retired;
         }
 
-        void Push(uint64_t frame, std::function<void()>&& deletor);
-        void Flush(uint64_t currentFrame);
-        void FlushAll();
-        inline bool IsEmpty() const { return m_Size == 0; }
+        void RunRetiredDeletors();
+
+        /**
+         * @brief Whether nothing is queued or pending, render thread only since it reads the pending arrays.
+         */
+        bool IsEmpty() const;
 
     private:
-        size_t m_Capacity;
-        std::vector<DeleteItem> m_Buffer;
-        size_t m_Head;  // Points to the next item to be processed.
-        size_t m_Tail;  // Points to the next free slot.
-        size_t m_Size;  // Number of elements currently in the buffer.
+        struct Entry
+        {
+            uint64_t Frame = 0;
+            uint32_t PackedHandle = 0;
+            DeletionKind Kind = DeletionKind::Count;
+        };
 
-        std::mutex m_Mutex;
-        std::vector<DeleteItem> m_FlushTemp;
+        struct DeleteItem
+        {
+            uint64_t Frame = 0;
+            Deletor Callback;
+        };
 
-    private:
-        void Resize();
+        template<typename T>
+        struct PendingHandle
+        {
+            uint64_t Frame = 0;
+            Handle<T> Resource;
+        };
+
+        template<typename T>
+        struct Batch
+        {
+            std::vector<PendingHandle<T>> Pending;
+            std::vector<Handle<T>> Retired;
+        };
+
+        static uint64_t RetireFrame(uint64_t frame)
+        {
+            // We mark the item to be deleted on frame ahead to ensure the GPU will be done with it.
+            // Thats because of the double buffering set up, on Renderer::BeginFrame we only wait for the new
+            // frame fence to be done, no the one that was just rendering.
+            return frame + 1;
+        }
+
+        void StageEntry(const Entry& entry);
+
+        template<typename T>
+        void Stage(const Entry& entry)
+        {
+            std::get<Batch<T>>(m_Batches).Pending.push_back({ entry.Frame, Handle<T>::UnPack(entry.PackedHandle) });
+        }
+
+        template<typename T>
+        static void Retire(Batch<T>& batch, uint64_t currentFrame)
+        {
+            batch.Retired.clear();
+
+            // Producers push in frame order but the queue interleaves them, so compact instead of popping a prefix.
+            size_t kept = 0;
+            for (size_t i = 0; i < batch.Pending.size(); ++i)
+            {
+                if (batch.Pending[i].Frame < currentFrame)
+                {
+                    batch.Retired.push_back(batch.Pending[i].Resource);
+                }
+                else
+                {
+                    batch.Pending[kept++] = batch.Pending[i];
+                }
+            }
+
+            batch.Pending.resize(kept);
+        }
+
+        moodycamel::ConcurrentQueue<Entry> m_Entries;
+        moodycamel::ConcurrentQueue<DeleteItem> m_Deletors;
+
+        // Render thread only.
+        std::tuple<
+            Batch<Texture>,
+            Batch<Buffer>,
+            Batch<Shader>,
+            Batch<BindGroup>,
+            Batch<BindGroupLayout>,
+            Batch<RenderPass>,
+            Batch<RenderPassLayout>> m_Batches;
+
+        std::vector<DeleteItem> m_PendingDeletors;
+        std::vector<DeleteItem> m_RetiredDeletors;
     };
 }
@@ -1,9 +1,55 @@
 #include "ResourceManager.h"
 
+#include "Utilities/Allocators/ScratchArena.h"
+
+#include <algorithm>
+
 namespace HBL2
 {
 	ResourceManager* ResourceManager::Instance = nullptr;
 
+	namespace
+	{
+		uint64_t BytesPerTexel(Format format)
+		{
+			switch (format)
+			{
+			case Format::RGBA32_FLOAT:
+				return 16;
+			case Format::RGB32_FLOAT:
+				return 12;
+			case Format::RGBA16_FLOAT:
+				return 8;
+			case Format::D16_FLOAT:
+				return 2;
+			case Format::D24_FLOAT:
+			case Format::D32_FLOAT:
+			case Format::RGBA8_UNORM:
+			case Format::BGRA8_UNORM:
+			case Format::RG16_FLOAT:
+			case Format::RGBA8_RGB:
+			case Format::R10G10B10A2_UNORM:
+				return 4;
+			}
+
+			return 4;
+		}
+
+		template<typename T>
+		Handle<T> MakeHandle(uint32_t index, uint8_t generation)
+		{
+			return Handle<T>::UnPack((index << Handle<T>::GenerationBits) | generation);
+		}
+
+		void UpdatePeak(std::atomic<uint64_t>& peak, uint64_t value)
+		{
+			uint64_t current = peak.load(std::memory_order_relaxed);
+			while (value > current && !peak.compare_exchange_weak(current, value, std::memory_order_relaxed))
+			{
+			}
+		}
+	}
+
 	void ResourceManager::InternalInitialize()
 	{
 		m_MeshPool.Initialize(m_Spec.Meshes);
@@ -12,6 +58,14 @@ namespace HBL2
 		m_ScriptPool.Initialize(m_Spec.Scripts);
 		m_SoundPool.Initialize(m_Spec.Sounds);
 		m_PrefabPool.Initialize(m_Spec.Prefabs);
+
+		m_TextureFootprints.Initialize("ResourceFootprintPool", m_Spec.Textures);
+		m_BufferFootprints.Initialize("ResourceFootprintPool", m_Spec.Buffers);
+		m_ShaderFootprints.Initialize("ResourceFootprintPool", m_Spec.Shaders);
+		m_SoundFootprints.Initialize("ResourceFootprintPool", m_Spec.Sounds);
+
+		m_TextureResidency.Initialize("ResourceResidencyPool", m_Spec.Textures);
+		m_MeshResidency.Initialize("ResourceResidencyPool", m_Spec.Meshes);
 	}
 
 	void ResourceManager::HashCombine(uint64_t& hash, uint64_t value)
@@ -32,22 +86,537 @@ namespace HBL2
 
 	void ResourceManager::Flush(uint64_t currentFrame)
 	{
-		m_DeletionQueue.Flush(currentFrame);
+		m_DeletionQueue.Collect(currentFrame);
+
+		// Bind groups go first since they reference layouts, buffers and textures.
+		DestroyBindGroups(m_DeletionQueue.GetRetired<BindGroup>());
+		DestroyBindGroupLayouts(m_DeletionQueue.GetRetired<BindGroupLayout>());
+		DestroyRenderPasses(m_DeletionQueue.GetRetired<RenderPass>());
+		DestroyRenderPassLayouts(m_DeletionQueue.GetRetired<RenderPassLayout>());
+		DestroyShaders(m_DeletionQueue.GetRetired<Shader>());
+		DestroyBuffers(m_DeletionQueue.GetRetired<Buffer>());
+		DestroyTextures(m_DeletionQueue.GetRetired<Texture>());
+
+		m_DeletionQueue.RunRetiredDeletors();
 	}
 
 	void ResourceManager::FlushAll()
 	{
-		m_DeletionQueue.FlushAll();
+		// Destroying a resource can queue more deletions (e.g. a bind group releasing its reflected layout), so drain until empty.
+		while (!m_DeletionQueue.IsEmpty())
+		{
+			Flush(UINT64_MAX);
+		}
+	}
+
+	// Memory budgets
+	const char* ResourceManager::GetBudgetCategoryName(ResourceBudgetCategory category)
+	{
+		switch (category)
+		{
+		case ResourceBudgetCategory::Textures:
+			return "Textures";
+		case ResourceBudgetCategory::Meshes:
+			return "Meshes";
+		case ResourceBudgetCategory::Buffers:
+			return "Buffers";
+		case ResourceBudgetCategory::Shaders:
+			return "Shaders";
+		case ResourceBudgetCategory::Sounds:
+			return "Sounds";
+		case ResourceBudgetCategory::Count:
+			break;
+		}
+
+		return "Unknown";
+	}
+	const ResourceBudget& ResourceManager::GetBudget(ResourceBudgetCategory category) const
+	{
+		switch (category)
+		{
+		case ResourceBudgetCategory::Textures:
+			return m_Spec.TextureBudget;
+		case ResourceBudgetCategory::Meshes:
+			return m_Spec.MeshBudget;
+		case ResourceBudgetCategory::Buffers:
+			return m_Spec.BufferBudget;
+		case ResourceBudgetCategory::Shaders:
+			return m_Spec.ShaderBudget;
+		case ResourceBudgetCategory::Sounds:
+			return m_Spec.SoundBudget;
+		case ResourceBudgetCategory::Count:
+			break;
+		}
+
+		static const ResourceBudget unlimited;
+		return unlimited;
+	}
+	ResourceBudgetUsage ResourceManager::GetBudgetUsage(ResourceBudgetCategory category) const
+	{
+		if (category >= ResourceBudgetCategory::Count)
+		{
+			return {};
+		}
+
+		const BudgetCounters& counters = m_BudgetCounters[(uint32_t)category];
+		const ResourceBudget& budget = GetBudget(category);
+
+		return {
+			.CPUBytes = counters.CPUBytes.load(std::memory_order_relaxed),
+			.GPUBytes = counters.GPUBytes.load(std::memory_order_relaxed),
+			.PeakCPUBytes = counters.PeakCPUBytes.load(std::memory_order_relaxed),
+			.PeakGPUBytes = counters.PeakGPUBytes.load(std::memory_order_relaxed),
+			.CPULimitBytes = (uint64_t)budget.CPU * 1024 * 1024,
+			.GPULimitBytes = (uint64_t)budget.GPU * 1024 * 1024,
+		};
+	}
+	void ResourceManager::AddBudgetCallback(ResourceBudgetCallback&& callback)
+	{
+		if (m_BudgetCallbacks.size() == m_BudgetCallbacks.Capacity)
+		{
+			HBL2_CORE_ERROR("Maximum number of resource budget callbacks ({}) reached, ignoring callback.", m_BudgetCallbacks.Capacity);
+			return;
+		}
+
+		m_BudgetCallbacks.emplace_back(std::move(callback));
+	}
+	void ResourceManager::DispatchBudgetCallbacks()
+	{
+		for (uint32_t i = 0; i < (uint32_t)ResourceBudgetCategory::Count; ++i)
+		{
+			if (!m_BudgetCounters[i].Exceeded.exchange(false, std::memory_order_acq_rel))
+			{
+				continue;
+			}
+
+			const ResourceBudgetCategory category = (ResourceBudgetCategory)i;
+			const ResourceBudgetUsage usage = GetBudgetUsage(category);
+
+			// Something may have been released in between, nothing to do then.
+			if (!usage.OverBudget())
+			{
+				continue;
+			}
+
+			HBL2_CORE_WARN("{} are over budget (CPU: {} / {} bytes, GPU: {} / {} bytes).",
+				GetBudgetCategoryName(category), usage.CPUBytes, usage.CPULimitBytes, usage.GPUBytes, usage.GPULimitBytes);
+
+			for (ResourceBudgetCallback& callback : m_BudgetCallbacks)
+			{
+				callback(category, usage);
+			}
+		}
+	}
+
+	// GPU residency
+	void ResourceManager::MarkUsed(Handle<Mesh> handle)
+	{
+		if (handle.IsValid())
+		{
+			MarkUsed(m_MeshResidency, handle.Index(), handle.Generation());
+		}
+	}
+	void ResourceManager::MarkUsed(Handle<Material> handle)
+	{
+		const Material* material = m_MaterialPool.Get(handle);
+		if (material == nullptr)
+		{
+			return;
+		}
+
+		for (Handle<Texture> texture : material->Textures)
+		{
+			MarkUsed(m_TextureResidency, texture.Index(), texture.Generation());
+		}
+	}
+	void ResourceManager::MarkReferenced(Handle<Mesh> handle)
+	{
+		if (handle.IsValid())
+		{
+			MarkReferenced(m_MeshResidency, handle.Index(), handle.Generation());
+		}
+	}
+	void ResourceManager::MarkReferenced(Handle<Material> handle)
+	{
+		const Material* material = m_MaterialPool.Get(handle);
+		if (material == nullptr)
+		{
+			return;
+		}
+
+		for (Handle<Texture> texture : material->Textures)
+		{
+			MarkReferenced(m_TextureResidency, texture.Index(), texture.Generation());
+		}
+	}
+	void ResourceManager::AddResidencyCallback(ResidencyEvictionCallback&& callback)
+	{
+		if (m_ResidencyCallbacks.size() == m_ResidencyCallbacks.Capacity)
+		{
+			HBL2_CORE_ERROR("Maximum number of residency callbacks ({}) reached, ignoring callback.", m_ResidencyCallbacks.Capacity);
+			return;
+		}
+
+		m_ResidencyCallbacks.emplace_back(std::move(callback));
+	}
+	ResidencyUsage ResourceManager::GetResidencyUsage()
+	{
+		uint64_t usage = 0;
+		uint64_t budget = 0;
+
+		if (m_Spec.ResidencyBudget == 0)
+		{
+			if (!QueryGPUMemoryBudget(usage, budget))
+			{
+				return {};
+			}
+
+			return { .GPUBytes = usage, .GPULimitBytes = budget, .DriverReported = true };
+		}
+
+		usage = m_BudgetCounters[(uint32_t)ResourceBudgetCategory::Textures].GPUBytes.load(std::memory_order_relaxed)
+			  + m_BudgetCounters[(uint32_t)ResourceBudgetCategory::Meshes].GPUBytes.load(std::memory_order_relaxed);
+
+		return { .GPUBytes = usage, .GPULimitBytes = (uint64_t)m_Spec.ResidencyBudget * 1024 * 1024 };
+	}
+	void ResourceManager::UpdateResidency()
+	{
+		const uint64_t currentFrame = m_ResidencyFrame.fetch_add(1, std::memory_order_relaxed) + 1;
+
+		if (!m_Spec.ResidencyManagement || m_ResidencyCallbacks.empty() || currentFrame < m_NextResidencyCheckFrame)
+		{
+			return;
+		}
+
+		const ResidencyUsage usage = GetResidencyUsage();
+		if (usage.GPULimitBytes == 0 || usage.GPUBytes <= usage.GPULimitBytes)
+		{
+			return;
+		}
+
+		struct Candidate
+		{
+			uint64_t LastUsedFrame;
+			uint32_t Index;
+			ResidencyKind Kind;
+		};
+
+		const uint32_t textureCount = m_TextureResidency.Capacity();
+		const uint32_t meshCount = m_MeshResidency.Capacity();
+
+		ScratchArena scratch(Allocator::FrameArenaMT);
+		Candidate* candidates = (Candidate*)scratch.Alloc(sizeof(Candidate) * (textureCount + meshCount), alignof(Candidate));
+		uint32_t candidateCount = 0;
+
+		auto gather = [&](PagedArray<ResidencySlot>& slots, uint32_t count, ResidencyKind kind)
+		{
+			for (uint32_t i = 0; i < count; ++i)
+			{
+				const ResidencySlot& slot = slots[i];
+				const uint64_t lastUsedFrame = std::atomic_ref<uint64_t>(slots[i].LastUsedFrame).load(std::memory_order_relaxed);
+				const uint64_t lastReferencedFrame = std::atomic_ref<uint64_t>(slots[i].LastReferencedFrame).load(std::memory_order_relaxed);
+
+				// A culled resource whose entity still exists gets a much longer grace period than one nothing holds anymore.
+				const uint64_t graceFrames = (lastReferencedFrame + ResidencyGraceFrames > currentFrame ? ResidencyReferencedGraceFrames : ResidencyGraceFrames);
+
+				if (slot.Generation == 0 || slot.Pinned || lastUsedFrame == 0 || lastUsedFrame + graceFrames > currentFrame)
+				{
+					continue;
+				}
+
+				candidates[candidateCount++] = { lastUsedFrame, i, kind };
+			}
+		};
+
+		gather(m_TextureResidency, textureCount, ResidencyKind::Texture);
+		gather(m_MeshResidency, meshCount, ResidencyKind::Mesh);
+
+		std::sort(candidates, candidates + candidateCount, [](const Candidate& a, const Candidate& b) { return a.LastUsedFrame < b.LastUsedFrame; });
+
+		const uint64_t target = (uint64_t)((double)usage.GPULimitBytes * ResidencyTargetRatio);
+		const uint64_t excess = usage.GPUBytes - std::min(target, usage.GPUBytes);
+
+		uint64_t evictedBytes = 0;
+		uint32_t evicted = 0;
+
+		for (uint32_t i = 0; i < candidateCount && evictedBytes < excess && evicted < MaxEvictionsPerFrame; ++i)
+		{
+			const Candidate& candidate = candidates[i];
+			PagedArray<ResidencySlot>& slots = (candidate.Kind == ResidencyKind::Texture ? m_TextureResidency : m_MeshResidency);
+
+			// Read the size first, evicting untracks it.
+			const uint64_t bytes = GetResidentBytes(candidate.Kind, candidate.Index);
+			const uint32_t packedHandle = (candidate.Kind == ResidencyKind::Texture)
+				? MakeHandle<Texture>(candidate.Index, slots[candidate.Index].Generation).Pack()
+				: MakeHandle<Mesh>(candidate.Index, slots[candidate.Index].Generation).Pack();
+
+			if (bytes == 0 || !Evict(candidate.Kind, packedHandle))
+			{
+				slots[candidate.Index].Pinned = true;
+				continue;
+			}
+
+			slots[candidate.Index].Generation = 0;
+			evictedBytes += bytes;
+			evicted++;
+		}
+
+		// Nothing old enough to evict, the next candidates appear once the grace period of the current ones runs out.
+		if (evicted == 0)
+		{
+			m_NextResidencyCheckFrame = currentFrame + ResidencyGraceFrames;
+			return;
+		}
+
+		m_NextResidencyCheckFrame = currentFrame + ResidencySettleFrames;
+
+		HBL2_CORE_INFO("GPU residency over budget ({} / {} bytes), evicted {} least recently drawn textures and meshes ({} bytes).",
+			usage.GPUBytes, usage.GPULimitBytes, evicted, evictedBytes);
+	}
+
+	void ResourceManager::TrackTexture(Handle<Texture> handle, const TextureDescriptor& desc)
+	{
+		uint64_t bytes = (uint64_t)desc.dimensions.x * std::max(desc.dimensions.y, 1u) * std::max(desc.dimensions.z, 1u) * std::max(desc.layerCount, 1u) * BytesPerTexel(desc.format);
+
+		// A full mip chain adds a third on top of the base level.
+		if (desc.mips > 1)
+		{
+			bytes += bytes / 3;
+		}
+
+		Track(m_TextureFootprints, handle.Index(), handle.Generation(), { .GPUBytes = bytes, .Category = ResourceBudgetCategory::Textures });
+		ResetResidency(m_TextureResidency, handle.Index(), handle.Generation());
+	}
+	void ResourceManager::TrackBuffer(Handle<Buffer> handle, const BufferDescriptor& desc)
+	{
+		const ResourceBudgetCategory category = (desc.usage == BufferUsage::VERTEX || desc.usage == BufferUsage::INDEX) ? ResourceBudgetCategory::Meshes : ResourceBudgetCategory::Buffers;
+
+		if (desc.memoryUsage == MemoryUsage::CPU_ONLY)
+		{
+			Track(m_BufferFootprints, handle.Index(), handle.Generation(), { .CPUBytes = desc.byteSize, .Category = category });
+		}
+		else
+		{
+			Track(m_BufferFootprints, handle.Index(), handle.Generation(), { .GPUBytes = desc.byteSize, .Category = category });
+		}
+	}
+	void ResourceManager::TrackShader(Handle<Shader> handle, const ShaderDescriptor& desc)
+	{
+		const uint64_t bytes = desc.VS.code.Size() + desc.FS.code.Size() + desc.CS.code.Size();
+		Track(m_ShaderFootprints, handle.Index(), handle.Generation(), { .CPUBytes = bytes, .Category = ResourceBudgetCategory::Shaders });
+	}
+	void ResourceManager::RetrackBuffer(Handle<Buffer> handle, uint64_t byteSize)
+	{
+		if (!handle.IsValid() || handle.Index() >= m_BufferFootprints.Capacity())
+		{
+			return;
+		}
+
+		ResourceFootprint footprint = m_BufferFootprints[handle.Index()];
+		if (footprint.Category == ResourceBudgetCategory::Count || footprint.Generation != handle.Generation())
+		{
+			return;
+		}
+
+		Untrack(m_BufferFootprints, handle.Index(), handle.Generation());
+
+		if (footprint.CPUBytes != 0)
+		{
+			footprint.CPUBytes = byteSize;
+		}
+		else
+		{
+			footprint.GPUBytes = byteSize;
+		}
+
+		Track(m_BufferFootprints, handle.Index(), handle.Generation(), footprint);
+	}
+	void ResourceManager::UntrackTexture(Handle<Texture> handle)
+	{
+		if (handle.IsValid())
+		{
+			Untrack(m_TextureFootprints, handle.Index(), handle.Generation());
+		}
+	}
+	void ResourceManager::UntrackBuffer(Handle<Buffer> handle)
+	{
+		if (handle.IsValid())
+		{
+			Untrack(m_BufferFootprints, handle.Index(), handle.Generation());
+		}
+	}
+	void ResourceManager::UntrackShader(Handle<Shader> handle)
+	{
+		if (handle.IsValid())
+		{
+			Untrack(m_ShaderFootprints, handle.Index(), handle.Generation());
+		}
+	}
+	void ResourceManager::Track(PagedArray<ResourceFootprint>& footprints, uint32_t index, uint8_t generation, const ResourceFootprint& footprint)
+	{
+		if (generation == 0 || footprint.Category >= ResourceBudgetCategory::Count)
+		{
+			return;
+		}
+
+		// The pool grew past the footprints, catch up.
+		if (index >= footprints.Capacity())
+		{
+			std::lock_guard<std::mutex> lock(m_FootprintGrowMutex);
+			while (index >= footprints.Capacity())
+			{
+				if (!footprints.Grow())
+				{
+					return;
+				}
+			}
+		}
+
+		footprints[index] = footprint;
+		footprints[index].Generation = generation;
+
+		BudgetCounters& counters = m_BudgetCounters[(uint32_t)footprint.Category];
+		const uint64_t cpuBytes = counters.CPUBytes.fetch_add(footprint.CPUBytes, std::memory_order_relaxed) + footprint.CPUBytes;
+		const uint64_t gpuBytes = counters.GPUBytes.fetch_add(footprint.GPUBytes, std::memory_order_relaxed) + footprint.GPUBytes;
+
+		UpdatePeak(counters.PeakCPUBytes, cpuBytes);
+		UpdatePeak(counters.PeakGPUBytes, gpuBytes);
+
+		const ResourceBudget& budget = GetBudget(footprint.Category);
+		if ((budget.CPU != 0 && cpuBytes > (uint64_t)budget.CPU * 1024 * 1024) || (budget.GPU != 0 && gpuBytes > (uint64_t)budget.GPU * 1024 * 1024))
+		{
+			counters.Exceeded.store(true, std::memory_order_release);
+		}
+	}
+	void ResourceManager::Untrack(PagedArray<ResourceFootprint>& footprints, uint32_t index, uint8_t generation)
+	{
+		// A stale handle must not debit the resource that reuses its slot.
+		if (index >= footprints.Capacity() || footprints[index].Generation != generation)
+		{
+			return;
+		}
+
+		// Reset the slot, so deleting the same handle twice does not debit twice.
+		const ResourceFootprint footprint = footprints[index];
+		footprints[index] = {};
+
+		if (footprint.Category >= ResourceBudgetCategory::Count)
+		{
+			return;
+		}
+
+		BudgetCounters& counters = m_BudgetCounters[(uint32_t)footprint.Category];
+		counters.CPUBytes.fetch_sub(footprint.CPUBytes, std::memory_order_relaxed);
+		counters.GPUBytes.fetch_sub(footprint.GPUBytes, std::memory_order_relaxed);
+	}
+
+	void ResourceManager::ResetResidency(PagedArray<ResidencySlot>& slots, uint32_t index, uint8_t generation)
+	{
+		if (generation == 0)
+		{
+			return;
+		}
+
+		if (index >= slots.Capacity())
+		{
+			std::lock_guard<std::mutex> lock(m_FootprintGrowMutex);
+			while (index >= slots.Capacity())
+			{
+				if (!slots.Grow())
+				{
+					return;
+				}
+			}
+		}
+
+		std::atomic_ref<uint64_t>(slots[index].LastUsedFrame).store(0, std::memory_order_relaxed);
+		std::atomic_ref<uint64_t>(slots[index].LastReferencedFrame).store(0, std::memory_order_relaxed);
+		slots[index].Pinned = false;
+		slots[index].Generation = generation;
+	}
+	void ResourceManager::MarkUsed(PagedArray<ResidencySlot>& slots, uint32_t index, uint8_t generation)
+	{
+		if (generation == 0 || index >= slots.Capacity() || slots[index].Generation != generation)
+		{
+			return;
+		}
+
+		std::atomic_ref<uint64_t>(slots[index].LastUsedFrame).store(m_ResidencyFrame.load(std::memory_order_relaxed), std::memory_order_relaxed);
+	}
+	void ResourceManager::MarkReferenced(PagedArray<ResidencySlot>& slots, uint32_t index, uint8_t generation)
+	{
+		if (generation == 0 || index >= slots.Capacity() || slots[index].Generation != generation)
+		{
+			return;
+		}
+
+		std::atomic_ref<uint64_t>(slots[index].LastReferencedFrame).store(m_ResidencyFrame.load(std::memory_order_relaxed), std::memory_order_relaxed);
+	}
+	uint64_t ResourceManager::GetResidentBytes(ResidencyKind kind, uint32_t index)
+	{
+		if (kind == ResidencyKind::Texture)
+		{
+			if (index >= m_TextureFootprints.Capacity() || m_TextureFootprints[index].Generation != m_TextureResidency[index].Generation)
+			{
+				return 0;
+			}
+
+			return m_TextureFootprints[index].GPUBytes;
+		}
+
+		const Mesh* mesh = m_MeshPool.Get(MakeHandle<Mesh>(index, m_MeshResidency[index].Generation));
+		if (mesh == nullptr)
+		{
+			return 0;
+		}
+
+		uint64_t bytes = 0;
+
+		auto addBuffer = [&](Handle<Buffer> buffer)
+		{
+			if (buffer.IsValid() && buffer.Index() < m_BufferFootprints.Capacity() && m_BufferFootprints[buffer.Index()].Generation == buffer.Generation())
+			{
+				bytes += m_BufferFootprints[buffer.Index()].GPUBytes;
+			}
+		};
+
+		for (const MeshPart& meshPart : mesh->Meshes)
+		{
+			addBuffer(meshPart.IndexBuffer);
+
+			for (Handle<Buffer> vertexBuffer : meshPart.VertexBuffers)
+			{
+				addBuffer(vertexBuffer);
+			}
+		}
+
+		return bytes;
+	}
+	bool ResourceManager::Evict(ResidencyKind kind, uint32_t packedHandle)
+	{
+		for (ResidencyEvictionCallback& callback : m_ResidencyCallbacks)
+		{
+			if (callback(kind, packedHandle))
+			{
+				return true;
+			}
+		}
+
+		return false;
 	}
 
 	// Mesh
 	Handle<Mesh> ResourceManager::CreateMesh(const MeshDescriptorEx&& desc)
 	{
-		return m_MeshPool.Insert(std::forward<const MeshDescriptorEx>(desc));
+		Handle<Mesh> handle = m_MeshPool.Insert(std::forward<const MeshDescriptorEx>(desc));
+		ResetResidency(m_MeshResidency, handle.Index(), handle.Generation());
+		return handle;
 	}
 	Handle<Mesh> ResourceManager::CreateMesh(const MeshDescriptor&& desc)
 	{
-		return m_MeshPool.Insert(std::forward<const MeshDescriptor>(desc));
+		Handle<Mesh> handle = m_MeshPool.Insert(std::forward<const MeshDescriptor>(desc));
+		ResetResidency(m_MeshResidency, handle.Index(), handle.Generation());
+		return handle;
 	}
 	void ResourceManager::ReimportMesh(Handle<Mesh> handle, const MeshDescriptor&& desc)
 	{
@@ -127,10 +696,25 @@ namespace HBL2
 	// Sounds
 	Handle<Sound> ResourceManager::CreateSound(const SoundDescriptor&& desc)
 	{
-		return m_SoundPool.Insert(std::forward<const SoundDescriptor>(desc));
+		Handle<Sound> handle = m_SoundPool.Insert(std::forward<const SoundDescriptor>(desc));
+
+		if (handle.IsValid())
+		{
+			// Sounds are streamed or decoded by the sound engine, the file size is the closest estimate of what they keep resident.
+			std::error_code ec;
+			const uintmax_t bytes = std::filesystem::file_size(desc.path, ec);
+			Track(m_SoundFootprints, handle.Index(), handle.Generation(), { .CPUBytes = ec ? 0 : (uint64_t)bytes, .Category = ResourceBudgetCategory::Sounds });
+		}
+
+		return handle;
 	}
 	void ResourceManager::DeleteSound(Handle<Sound> handle)
 	{
+		if (handle.IsValid())
+		{
+			Untrack(m_SoundFootprints, handle.Index(), handle.Generation());
+		}
+
 		m_SoundPool.Remove(handle);
 	}
 	Sound* ResourceManager::GetSound(Handle<Sound> handle) const
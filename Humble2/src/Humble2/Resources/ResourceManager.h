@@ -2,22 +2,29 @@
 
 #include "Handle.h"
 #include "Pool.h"
+#include "PagedArray.h"
 #include "Types.h"
 #include "TypeDescriptors.h"
 #include "ResourceDeletionQueue.h"
+#include "ResourceBudget.h"
 
 #include "Scene/Scene.h"
 #include "Sound/Sound.h"
 #include "Script/Script.h"
 #include "Prefab/Prefab.h"
 
+#include "Utilities/Collections/StaticDArray.h"
+
+#include <atomic>
 #include <cstring>
+#include <mutex>
 #include <stdint.h>
 
 namespace HBL2
 {
 	class CommandBuffer;
 
+	// Pool sizes are initial capacities, pools grow in pages on demand up to 2^24 - 1 slots.
 	struct ResourceManagerSpecification
 	{
 		uint32_t Textures = 128;
@@ -33,6 +40,18 @@ namespace HBL2
 		uint32_t Scripts = 32;
 		uint32_t Sounds = 32;
 		uint32_t Prefabs = 64;
+
+		ResourceBudget TextureBudget;
+		ResourceBudget MeshBudget;
+		ResourceBudget BufferBudget;
+		ResourceBudget ShaderBudget;
+		ResourceBudget SoundBudget;
+
+		// Residency management is opt-in. ResidencyBudget is the GPU memory in MB that textures and meshes drawn by the scene renderer
+		// may keep resident, 0 uses the budget the backend reports for its device local heaps (Vulkan only, residency management is
+		// off on backends that can not report one).
+		bool ResidencyManagement = false;
+		uint32_t ResidencyBudget = 0;
 	};
 
 	class HBL2_API ResourceManager
@@ -52,6 +71,28 @@ namespace HBL2
 		virtual const ResourceManagerSpecification GetUsageStats() = 0;
 		virtual void Clean() = 0;
 
+		// Memory budgets
+		static const char* GetBudgetCategoryName(ResourceBudgetCategory category);
+		const ResourceBudget& GetBudget(ResourceBudgetCategory category) const;
+		ResourceBudgetUsage GetBudgetUsage(ResourceBudgetCategory category) const;
+
+		// Callbacks fire from DispatchBudgetCallbacks on the main thread, once per category that went over its soft limit since the last dispatch.
+		void AddBudgetCallback(ResourceBudgetCallback&& callback);
+		void DispatchBudgetCallbacks();
+
+		// GPU residency
+		// MarkUsed is called for drawn resources and MarkReferenced for resources held by live entities while gathering draws (any
+		// thread), UpdateResidency once per frame on the main thread. When over the residency budget, the least recently drawn textures
+		// and meshes are offered to the eviction callbacks until usage is back under ResidencyTargetRatio of the budget. Owners release
+		// them and bring them back the next time they are requested.
+		void MarkUsed(Handle<Mesh> handle);
+		void MarkUsed(Handle<Material> handle);
+		void MarkReferenced(Handle<Mesh> handle);
+		void MarkReferenced(Handle<Material> handle);
+		void AddResidencyCallback(ResidencyEvictionCallback&& callback);
+		void UpdateResidency();
+		ResidencyUsage GetResidencyUsage();
+
 		// Textures
 		virtual Handle<Texture> CreateTexture(const TextureDescriptor&& desc) = 0;
 		virtual void DeleteTexture(Handle<Texture> handle) = 0;
@@ -139,6 +180,29 @@ namespace HBL2
 		void InternalInitialize();
 		void HashCombine(uint64_t& hash, uint64_t value);
 
+		// Called by the backends from Create* and Delete*. Deletes are debited immediately, not when the deletion queue flushes,
+		// so an eviction pass sees its effect on the budget right away.
+		void TrackTexture(Handle<Texture> handle, const TextureDescriptor& desc);
+		void TrackBuffer(Handle<Buffer> handle, const BufferDescriptor& desc);
+		void TrackShader(Handle<Shader> handle, const ShaderDescriptor& desc);
+		void RetrackBuffer(Handle<Buffer> handle, uint64_t byteSize);
+		void UntrackTexture(Handle<Texture> handle);
+		void UntrackBuffer(Handle<Buffer> handle);
+		void UntrackShader(Handle<Shader> handle);
+
+		// Fills in the GPU memory used and available on the device local heaps, false if the backend can not tell.
+		virtual bool QueryGPUMemoryBudget(uint64_t& usage, uint64_t& budget) { return false; }
+
+		// Batched deleters, called by Flush on the render thread with every handle whose deletion frame has retired.
+		// Handles may be stale (deleted twice), implementations skip the ones that no longer resolve.
+		virtual void DestroyTextures(Span<const Handle<Texture>> handles) = 0;
+		virtual void DestroyBuffers(Span<const Handle<Buffer>> handles) = 0;
+		virtual void DestroyShaders(Span<const Handle<Shader>> handles) = 0;
+		virtual void DestroyBindGroups(Span<const Handle<BindGroup>> handles) = 0;
+		virtual void DestroyBindGroupLayouts(Span<const Handle<BindGroupLayout>> handles) = 0;
+		virtual void DestroyRenderPasses(Span<const Handle<RenderPass>> handles) = 0;
+		virtual void DestroyRenderPassLayouts(Span<const Handle<RenderPassLayout>> handles) = 0;
+
 		ResourceDeletionQueue m_DeletionQueue;
 		ResourceManagerSpecification m_Spec;
 
@@ -148,5 +212,64 @@ namespace HBL2
 		Pool<Script, Script> m_ScriptPool;
 		Pool<Sound, Sound> m_SoundPool;
 		Pool<Prefab, Prefab> m_PrefabPool;
+
+	private:
+		struct ResourceFootprint
+		{
+			uint64_t CPUBytes = 0;
+			uint64_t GPUBytes = 0;
+			ResourceBudgetCategory Category = ResourceBudgetCategory::Count;
+			uint8_t Generation = 0;
+		};
+
+		struct BudgetCounters
+		{
+			std::atomic<uint64_t> CPUBytes = 0;
+			std::atomic<uint64_t> GPUBytes = 0;
+			std::atomic<uint64_t> PeakCPUBytes = 0;
+			std::atomic<uint64_t> PeakGPUBytes = 0;
+			std::atomic_bool Exceeded = false;
+		};
+
+		struct ResidencySlot
+		{
+			uint64_t LastUsedFrame = 0; // 0 until the resource is first drawn, only drawn resources are eviction candidates.
+			uint64_t LastReferencedFrame = 0; // Last frame a live entity held the resource, drawn or culled.
+			uint8_t Generation = 0;
+			bool Pinned = false;		// No callback could evict it, skip it until the slot is reused.
+		};
+
+		void Track(PagedArray<ResourceFootprint>& footprints, uint32_t index, uint8_t generation, const ResourceFootprint& footprint);
+		void Untrack(PagedArray<ResourceFootprint>& footprints, uint32_t index, uint8_t generation);
+
+		void ResetResidency(PagedArray<ResidencySlot>& slots, uint32_t index, uint8_t generation);
+		void MarkUsed(PagedArray<ResidencySlot>& slots, uint32_t index, uint8_t generation);
+		void MarkReferenced(PagedArray<ResidencySlot>& slots, uint32_t index, uint8_t generation);
+		uint64_t GetResidentBytes(ResidencyKind kind, uint32_t index);
+		bool Evict(ResidencyKind kind, uint32_t packedHandle);
+
+		static constexpr uint64_t ResidencyGraceFrames = 8;		// Resources drawn this recently are never evicted.
+		static constexpr uint64_t ResidencyReferencedGraceFrames = 600; // Same for resources of live entities, which are likely drawn again soon.
+		static constexpr uint64_t ResidencySettleFrames = 3;	// Evicted memory is released by the deletion queue a couple of frames later.
+		static constexpr uint32_t MaxEvictionsPerFrame = 64;
+		static constexpr float ResidencyTargetRatio = 0.9f;
+
+		BudgetCounters m_BudgetCounters[(uint32_t)ResourceBudgetCategory::Count];
+		StaticDArray<ResourceBudgetCallback, 8> m_BudgetCallbacks;
+
+		// Footprints are indexed by handle index, so a delete knows what to debit without asking the backend.
+		// They grow alongside the pools, growth is serialized by m_FootprintGrowMutex.
+		std::mutex m_FootprintGrowMutex;
+		PagedArray<ResourceFootprint> m_TextureFootprints;
+		PagedArray<ResourceFootprint> m_BufferFootprints;
+		PagedArray<ResourceFootprint> m_ShaderFootprints;
+		PagedArray<ResourceFootprint> m_SoundFootprints;
+
+		// Indexed by handle index like the footprints, reset when a texture or mesh is created in the slot.
+		PagedArray<ResidencySlot> m_TextureResidency;
+		PagedArray<ResidencySlot> m_MeshResidency;
+		StaticDArray<ResidencyEvictionCallback, 8> m_ResidencyCallbacks;
+		std::atomic<uint64_t> m_ResidencyFrame = 1;
+		uint64_t m_NextResidencyCheckFrame = 0;
 	};
 }
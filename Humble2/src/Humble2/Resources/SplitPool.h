@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Handle.h"
+#include "PagedArray.h"
 #include "LockFreeIndexStack.h"
 #include "Utilities/Collections/Span.h"
 
@@ -9,6 +10,7 @@
 
 #include <atomic>
 #include <cstdint>
+#include <mutex>
 #include <new>
 #include <type_traits>
 
@@ -18,7 +20,7 @@ namespace HBL2
     class SplitPool
     {
     public:
-        static constexpr uint16_t InvalidIndex = LockFreeIndexStack::InvalidIndex;
+        static constexpr uint32_t InvalidIndex = Handle<H>::InvalidIndex;
 
         SplitPool() = default;
 
@@ -31,58 +33,56 @@ namespace HBL2
         {
         }
 
+        /**
+         * @brief Sets up the first page of the pool.
+         *
+         * @param size The initial number of slots, the pool grows in pages when they run out (up to Handle<H>::MaxSlots).
+         */
         void Initialize(uint32_t size)
         {
-            m_Size = size;
-
-            if (m_Size == 0 || m_Size > 0xFFFEu)
+            if (size == 0 || size > Handle<H>::MaxSlots)
             {
-                m_Size = 32;
+                size = 32;
             }
 
-            size_t bytes = ArenaLayout::Create()
-                .Add<THot>(m_Size)
-                .template Add<TCold>(m_Size)
-                .template Add<std::atomic<uint16_t>>(m_Size)
-                .template Add<std::atomic<uint16_t>>(m_Size)
-                .Total();
-
-            m_Reservation = Allocator::Arena.Reserve("SplitPoolReservation", bytes);
-            m_PoolArena.Initialize(&Allocator::Arena, bytes, m_Reservation);
-
-            m_HotData = (THot*)m_PoolArena.Alloc(sizeof(THot) * m_Size, alignof(THot));
-            m_ColdData = (TCold*)m_PoolArena.Alloc(sizeof(TCold) * m_Size, alignof(TCold));
-
-            void* generationalCounterMem = m_PoolArena.Alloc(sizeof(std::atomic<uint16_t>) * m_Size, alignof(std::atomic<uint16_t>));
-            m_GenerationalCounter = m_PoolArena.ConstructArray<std::atomic<uint16_t>>(generationalCounterMem, m_Size, 0);
+            m_HotData.Initialize("SplitPoolReservation", size);
+            m_ColdData.Initialize("SplitPoolReservation", size);
+            m_GenerationalCounter.Initialize("SplitPoolReservation", size);
+            m_NextFree.Initialize("SplitPoolReservation", size);
 
-            void* nextFreeMem = m_PoolArena.Alloc(sizeof(std::atomic<uint16_t>) * m_Size, alignof(std::atomic<uint16_t>));
-            m_NextFree = m_PoolArena.ConstructArray<std::atomic<uint16_t>>(nextFreeMem, m_Size, 0);
+            const uint32_t capacity = std::min(m_HotData.Capacity(), Handle<H>::MaxSlots);
 
-            for (uint32_t i = 0; i < m_Size; ++i)
+            for (uint32_t i = 0; i < capacity; ++i)
             {
                 m_GenerationalCounter[i].store(1, std::memory_order_relaxed);
             }
 
-            m_FreeList.Initialize(m_NextFree, m_Size);
+            m_FreeList.Initialize(&m_NextFree, capacity);
         }
 
         Handle<H> Insert(THot** outHot, TCold** outCold)
         {
-            const uint16_t index = m_FreeList.Pop();
-            if (index == InvalidIndex)
+            uint32_t index = m_FreeList.Pop();
+            if (index == LockFreeIndexStack::InvalidIndex)
             {
-                HBL2_CORE_ASSERT(false, "Exhausted available Pool indeces!");
-                return {};
+                index = Grow();
+                if (index == LockFreeIndexStack::InvalidIndex)
+                {
+                    HBL2_CORE_ASSERT(false, "Exhausted available Pool indeces!");
+                    return {};
+                }
             }
 
-            new (&m_HotData[index]) THot;
-            new (&m_ColdData[index]) TCold;
+            THot* hot = &m_HotData[index];
+            TCold* cold = &m_ColdData[index];
 
-            *outHot = &m_HotData[index];
-            *outCold = &m_ColdData[index];
+            new (hot) THot;
+            new (cold) TCold;
 
-            const uint16_t gen = m_GenerationalCounter[index].load(std::memory_order_relaxed);
+            *outHot = hot;
+            *outCold = cold;
+
+            const uint8_t gen = m_GenerationalCounter[index].load(std::memory_order_relaxed);
             return { index, gen };
         }
 
@@ -93,19 +93,25 @@ namespace HBL2
                 return;
             }
 
-            const uint16_t idx = handle.m_ArrayIndex;
-            if (idx == InvalidIndex || idx >= m_Size)
+            const uint32_t idx = handle.m_ArrayIndex;
+            if (idx >= m_HotData.Capacity())
             {
                 return;
             }
 
-            const uint16_t cur = m_GenerationalCounter[idx].load(std::memory_order_acquire);
+            uint8_t cur = m_GenerationalCounter[idx].load(std::memory_order_acquire);
             if (cur != handle.m_GenerationalCounter)
             {
                 return;
             }
 
-            m_GenerationalCounter[idx].fetch_add(1, std::memory_order_acq_rel);
+            // Generation 0 marks invalid handles, skip it when wrapping around.
+            const uint8_t next = (cur == 0xFF) ? 1 : cur + 1;
+            if (!m_GenerationalCounter[idx].compare_exchange_strong(cur, next, std::memory_order_acq_rel))
+            {
+                return;
+            }
+
             m_FreeList.Push(idx);
         }
 
@@ -116,14 +122,14 @@ namespace HBL2
                 return nullptr;
             }
 
-            const uint16_t idx = handle.m_ArrayIndex;
-            if (idx == InvalidIndex || idx >= m_Size)
+            const uint32_t idx = handle.m_ArrayIndex;
+            if (idx >= m_HotData.Capacity())
             {
                 HBL2_CORE_ASSERT(false, "Exhausted available Pool indeces!");
                 return nullptr;
             }
 
-            const uint16_t gen = m_GenerationalCounter[idx].load(std::memory_order_acquire);
+            const uint8_t gen = m_GenerationalCounter[idx].load(std::memory_order_acquire);
             if (gen != handle.m_GenerationalCounter)
             {
                 return nullptr;
@@ -139,14 +145,14 @@ namespace HBL2
                 return nullptr;
             }
 
-            const uint16_t idx = handle.m_ArrayIndex;
-            if (idx == InvalidIndex || idx >= m_Size)
+            const uint32_t idx = handle.m_ArrayIndex;
+            if (idx >= m_HotData.Capacity())
             {
                 HBL2_CORE_ASSERT(false, "Exhausted available Pool indeces!");
                 return nullptr;
             }
 
-            const uint16_t gen = m_GenerationalCounter[idx].load(std::memory_order_acquire);
+            const uint8_t gen = m_GenerationalCounter[idx].load(std::memory_order_acquire);
             if (gen != handle.m_GenerationalCounter)
             {
                 return nullptr;
@@ -162,14 +168,14 @@ namespace HBL2
                 return false;
             }
 
-            const uint16_t idx = handle.m_ArrayIndex;
-            if (idx == InvalidIndex || idx >= m_Size)
+            const uint32_t idx = handle.m_ArrayIndex;
+            if (idx >= m_HotData.Capacity())
             {
                 HBL2_CORE_ASSERT(false, "Exhausted available Pool indeces!");
                 return false;
             }
 
-            const uint16_t gen = m_GenerationalCounter[idx].load(std::memory_order_acquire);
+            const uint8_t gen = m_GenerationalCounter[idx].load(std::memory_order_acquire);
             if (gen != handle.m_GenerationalCounter)
             {
                 return false;
@@ -181,19 +187,25 @@ namespace HBL2
             return true;
         }
 
-        const Span<THot> GetDataHotPool() const
+        /**
+         * @brief Returns the hot slot at the index, live or not, meant for linear scans over [0, Capacity()).
+         */
+        THot& GetHotAt(uint32_t index) const
         {
-            return { m_HotData, m_Size };
+            return m_HotData[index];
         }
 
-        const Span<TCold> GetDataColdPool() const
+        /**
+         * @brief Returns the cold slot at the index, live or not, meant for linear scans over [0, Capacity()).
+         */
+        TCold& GetColdAt(uint32_t index) const
         {
-            return { m_ColdData, m_Size };
+            return m_ColdData[index];
         }
 
-        Handle<H> GetHandleFromIndex(uint16_t index) const
+        Handle<H> GetHandleFromIndex(uint32_t index) const
         {
-            if (index == InvalidIndex || index >= m_Size)
+            if (index >= m_HotData.Capacity())
             {
                 return {};
             }
@@ -201,22 +213,59 @@ namespace HBL2
             return { index, m_GenerationalCounter[index].load(std::memory_order_acquire) };
         }
 
-        uint32_t Capacity() const { return m_Size; }
+        uint32_t Capacity() const { return std::min(m_HotData.Capacity(), Handle<H>::MaxSlots); }
 
         uint32_t FreeSlotCount() const { return m_FreeList.NonInvalidCount(); }
 
     private:
-        LockFreeIndexStack m_FreeList;
-        std::atomic<uint16_t>* m_NextFree = nullptr;
+        uint32_t Grow()
+        {
+            std::lock_guard<std::mutex> lock(m_GrowMutex);
 
-        THot* m_HotData = nullptr;
-        TCold* m_ColdData = nullptr;
+            // Another thread may have grown the pool while we were waiting.
+            const uint32_t index = m_FreeList.Pop();
+            if (index != LockFreeIndexStack::InvalidIndex)
+            {
+                return index;
+            }
 
-        std::atomic<uint16_t>* m_GenerationalCounter = nullptr;
+            const uint32_t oldCapacity = Capacity();
+            if (oldCapacity == Handle<H>::MaxSlots)
+            {
+                return LockFreeIndexStack::InvalidIndex;
+            }
+
+            // Everything else is published before the hot page, the getters bounds check against the hot capacity.
+            m_ColdData.Grow();
+            m_GenerationalCounter.Grow();
+            m_NextFree.Grow();
+
+            const uint32_t newCapacity = std::min(m_GenerationalCounter.Capacity(), Handle<H>::MaxSlots);
+            for (uint32_t i = oldCapacity; i < newCapacity; ++i)
+            {
+                m_GenerationalCounter[i].store(1, std::memory_order_relaxed);
+            }
+
+            m_HotData.Grow();
+
+            if (newCapacity == oldCapacity)
+            {
+                return LockFreeIndexStack::InvalidIndex;
+            }
+
+            // The first new slot goes straight to the caller, a Pop could lose it to another thread and find the list empty again.
+            m_FreeList.AddRange(oldCapacity + 1, newCapacity - oldCapacity - 1);
+
+            return oldCapacity;
+        }
+
+        LockFreeIndexStack m_FreeList;
 
-        uint32_t m_Size = 32;
+        PagedArray<THot> m_HotData;
+        PagedArray<TCold> m_ColdData;
+        PagedArray<std::atomic<uint8_t>> m_GenerationalCounter;
+        PagedArray<std::atomic<uint32_t>> m_NextFree;
 
-        PoolReservation* m_Reservation = nullptr;
-        Arena m_PoolArena;
+        std::mutex m_GrowMutex;
     };
 }
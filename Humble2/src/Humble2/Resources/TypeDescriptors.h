@@ -376,5 +376,6 @@ namespace HBL2
 		Handle<Shader> shader;
 		Handle<BindGroup> drawBindGroup;
 		Handle<BindGroup> materialBindGroup;
+		Span<const Handle<Texture>> textures;
 	};
 }
@@ -23,11 +23,13 @@ namespace HBL2
 	void Mesh::MarkAsEmpty()
 	{
 		m_HasItems.store(false, std::memory_order_release);
+		m_Version.fetch_add(1, std::memory_order_acq_rel);
 	}
 
 	void Mesh::Reimport(const MeshDescriptor&& desc)
 	{
 		Meshes.clear();
+		Extents = {};
 		DebugName = desc.debugName;
 
 		uint32_t* indeces = (uint32_t*)desc.indeces.Data();
@@ -50,6 +52,17 @@ namespace HBL2
 			.initialData = vertices,
 		});
 
+		// The vertices are interleaved Vertex structs, the bounds come from their positions.
+		constexpr uint32_t vertexStride = sizeof(Vertex) / sizeof(float);
+
+		MeshExtents vertexExtents;
+		for (uint32_t i = 0; i + 3 <= verticesCount; i += vertexStride)
+		{
+			const glm::vec3 position = { vertices[i], vertices[i + 1], vertices[i + 2] };
+			vertexExtents.Min = glm::min(vertexExtents.Min, position);
+			vertexExtents.Max = glm::max(vertexExtents.Max, position);
+		}
+
 		Meshes.emplace_back(MeshPartDescriptor{
 			.debugName = "mesh-part",
 			.subMeshes = {
@@ -57,6 +70,8 @@ namespace HBL2
 					.indexCount = indecesCount,
 					.vertexOffset = 0,
 					.vertexCount = verticesCount,
+					.minVertex = vertexExtents.Min,
+					.maxVertex = vertexExtents.Max,
 				}
 			},
 			.indexBuffer = indexBufferHandle,
@@ -74,12 +89,14 @@ namespace HBL2
 			Extents.Max.z = glm::max(meshPart.Extents.Max.z, Extents.Max.z);
 		}
 
+		m_Version.fetch_add(1, std::memory_order_acq_rel);
 		m_HasItems.store(true, std::memory_order_release);
 	}
 
 	void Mesh::Reimport(const MeshDescriptorEx&& desc)
 	{
 		Meshes.clear();
+		Extents = {};
 		DebugName = desc.debugName;
 
 		for (const MeshPartDescriptor& meshPartDescriptor : desc.meshes)
@@ -98,6 +115,7 @@ namespace HBL2
 			Extents.Max.z = glm::max(meshPart.Extents.Max.z, Extents.Max.z);
 		}
 
+		m_Version.fetch_add(1, std::memory_order_acq_rel);
 		m_HasItems.store(true, std::memory_order_release);
 	}
 
@@ -112,6 +130,15 @@ namespace HBL2
 		Shader = desc.shader;
 		DrawBindGroup = desc.drawBindGroup;
 		MaterialBindGroup = desc.materialBindGroup;
+
+		Textures.clear();
+		for (Handle<Texture> texture : desc.textures)
+		{
+			if (texture.IsValid() && Textures.size() < Textures.capacity())
+			{
+				Textures.push_back(texture);
+			}
+		}
 	}
 
 	void Material::SetGlobalShaderBuffer(uint32_t index, void* userData)
@@ -4,6 +4,8 @@
 #include "BaseTypeDefinitions.h"
 #include "TypeDescriptors.h"
 
+#include "Utilities/Collections/StaticDArray.h"
+
 #include <glm/glm.hpp>
 
 #include <string>
@@ -23,7 +25,13 @@ namespace HBL2
 	struct MeshExtents
 	{
 		glm::vec3 Min = { (std::numeric_limits<float>::max)(), (std::numeric_limits<float>::max)(), (std::numeric_limits<float>::max)() };
-		glm::vec3 Max = { (std::numeric_limits<float>::min)(), (std::numeric_limits<float>::min)(), (std::numeric_limits<float>::min)() };
+		glm::vec3 Max = { (std::numeric_limits<float>::lowest)(), (std::numeric_limits<float>::lowest)(), (std::numeric_limits<float>::lowest)() };
+
+		// Empty until a vertex is added, empty extents are never culled.
+		bool IsValid() const
+		{
+			return Min.x <= Max.x && Min.y <= Max.y && Min.z <= Max.z;
+		}
 	};
 
 	struct SubMesh
@@ -111,12 +119,18 @@ namespace HBL2
 		void Reimport(const MeshDescriptor&& desc);
 		void Reimport(const MeshDescriptorEx&& desc);
 
+		/**
+		 * @brief Changes every time the mesh parts are emptied or replaced, so data derived from them can tell it is stale.
+		 */
+		uint32_t GetVersion() const { return m_Version.load(std::memory_order_acquire); }
+
 		const char* DebugName = "";
 		std::vector<MeshPart> Meshes;
 		MeshExtents Extents;
 
 	private:
 		std::atomic<bool> m_HasItems{ false };
+		std::atomic<uint32_t> m_Version{ 0 };
 	};
 
 	struct HBL2_API Material
@@ -132,8 +146,10 @@ namespace HBL2
 		Handle<Shader> Shader;
 		Handle<BindGroup> DrawBindGroup;
 		Handle<BindGroup> MaterialBindGroup;
+		StaticDArray<Handle<Texture>, 8> Textures; // Bound through the material bind group, marked as used when the material is drawn.
 
 		ShaderDescriptor::RenderPipeline::PackedVariant VariantHash = {};
 		bool ReceiveShadows = true;
+		bool Instancing = false; // The shader reads its per draw data from the instance buffer, so identical draws can be merged.
 	};
 }
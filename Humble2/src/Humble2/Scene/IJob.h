@@ -115,7 +115,7 @@ namespace HBL2
 	{
 	public:
 		template<typename Q, typename Fn>
-		void Dispatch(Q&& q, Fn&& fn, uint32_t groupSize = 64)
+		void Dispatch(Q&& q, Fn&& fn, uint32_t grainSize = 0)
 		{
 			auto iterable = q.Each();
 
@@ -125,15 +125,14 @@ namespace HBL2
 				return;
 			}
 
-			JobContext ctx;
-			JobSystem::Get().Dispatch(ctx, count, groupSize, [&](JobDispatchArgs d)
+			// NOTE: A grain size of 0 lets the job system pick one and balance uneven per entity costs through work stealing.
+			JobSystem::Get().ParallelForRange(0, count, [&](uint32_t rangeBegin, uint32_t rangeEnd)
 			{
 				// find the start of this slice
 				auto it = iterable.begin();
-				std::advance(it, d.jobIndex);
+				std::advance(it, rangeBegin);
 
-				const uint32_t end = std::min(d.jobIndex + groupSize, count);
-				for (uint32_t i = d.jobIndex; i < end; ++i, ++it)
+				for (uint32_t i = rangeBegin; i < rangeEnd; ++i, ++it)
 				{
 					// Decompose tuple from .each()
 					std::apply([&]<typename E, typename... Cs>(E entity, Cs&... comps)
@@ -149,9 +148,7 @@ namespace HBL2
 
 					}, *it);
 				}
-			});
-
-			JobSystem::Get().Wait(ctx);
+			}, grainSize);
 		}
 	};
 
@@ -25,12 +25,16 @@ namespace HBL2
 
         m_Registry.Initialize(desc.maxEntities, desc.maxComponents);
 
+        // Entity map sized for 50% load at max entities, so it never has to grow.
+        const uint32_t entityMapCapacity = std::bit_ceil(std::max(desc.maxEntities * 2, HashMap<UUID, Entity>::GroupWidth));
+
         // Memory requirements for scene arena.
         uint64_t totalBytes = ArenaLayout::Create()
             .Add<ISystem*>(desc.maxSystems)                         // m_Systems
             .Add<ISystem*>(desc.maxSystems)                         // m_CoreSystems
             .Add<ISystem*>(desc.maxSystems)                         // m_RuntimeSystems
-            .Add<std::pair<UUID, Entity>>(desc.maxEntities * 2)     // m_EntityMap
+            .AddRaw(entityMapCapacity, 16)                          // m_EntityMap control bytes
+            .Add<std::pair<UUID, Entity>>(entityMapCapacity)        // m_EntityMap
             .Add<uint64_t>(desc.maxEntities * 2)                    // TODO: Investigate if needed!
             .Add<StructuralCommandBuffer>(1)                        // m_CmdBuffer
             .AddRaw(100_KB, 1)                                      // Extra headroom
@@ -70,7 +74,7 @@ namespace HBL2
         m_CoreSystems = MakeDArray<ISystem*>(m_SceneArena, desc.maxSystems);
         m_RuntimeSystems = MakeDArray<ISystem*>(m_SceneArena, desc.maxSystems);
 
-        m_EntityMap = HashMap<UUID, Entity>(&m_SceneArena, desc.maxEntities * 2);
+        m_EntityMap = HashMap<UUID, Entity>(&m_SceneArena, entityMapCapacity);
 
         // Create the StructuralCommandBuffer if is requested.
         // (This is optional since for example in prefabs, which have subscenes embeded in them, we dont need it)
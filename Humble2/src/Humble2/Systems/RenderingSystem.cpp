@@ -18,11 +18,13 @@ namespace HBL2
 		switch (projectSettings.Renderer)
 		{
 		case RendererType::Forward:
-		case RendererType::ForwardPlus:
 		case RendererType::Deferred:
 		case RendererType::Custom:
 			m_SceneRenderer = new ForwardSceneRenderer;
 			break;
+		case RendererType::ForwardPlus:
+			m_SceneRenderer = new ForwardSceneRenderer(true);
+			break;
 		}
 
 		m_SceneRenderer->Initialize(m_Context);
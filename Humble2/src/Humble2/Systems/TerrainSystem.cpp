@@ -467,7 +467,6 @@ namespace HBL2
 
 		float maxPossibleHeight = 0;
 		float amplitude = 1;
-		float frequency = 1;
 
 		Random::Seed(terrain.Seed);
 
@@ -481,56 +480,64 @@ namespace HBL2
 			amplitude *= terrain.Persistance;
 		}
 
-		float maxLocalNoiseHeight = std::numeric_limits<float>::min();
-		float minLocalNoiseHeight = std::numeric_limits<float>::max();
-
 		float halfWidth = size / 2.f;
 		float halfHeight = size / 2.f;
 
-		for (int y = 0; y < size; y++)
-		{
-			for (int x = 0; x < size; x++)
+		// Generate the rows in parallel, tracking the local min (x) and max (y) noise height.
+		const glm::vec2 localNoiseHeightRange = JobSystem::Get().ParallelReduce((uint32_t)0, (uint32_t)size,
+			glm::vec2(std::numeric_limits<float>::max(), std::numeric_limits<float>::lowest()),
+			[&](uint32_t rowBegin, uint32_t rowEnd)
 			{
-				amplitude = 1;
-				frequency = 1;
-				float noiseHeight = 0;
+				glm::vec2 range = { std::numeric_limits<float>::max(), std::numeric_limits<float>::lowest() };
 
-				for (int i = 0; i < terrain.Octaves; i++)
+				for (int y = (int)rowBegin; y < (int)rowEnd; y++)
 				{
-					float sampleX = (x - halfWidth + octaveOffsets[i].x) / terrain.NoiseScale * frequency;
-					float sampleY = (y - halfHeight + octaveOffsets[i].y) / terrain.NoiseScale * frequency;
+					for (int x = 0; x < size; x++)
+					{
+						float octaveAmplitude = 1;
+						float octaveFrequency = 1;
+						float noiseHeight = 0;
 
-					float perlinValue = Math::PerlinNoise(sampleX, sampleY) * 2 - 1;
-					noiseHeight += perlinValue * amplitude;
+						for (int i = 0; i < terrain.Octaves; i++)
+						{
+							float sampleX = (x - halfWidth + octaveOffsets[i].x) / terrain.NoiseScale * octaveFrequency;
+							float sampleY = (y - halfHeight + octaveOffsets[i].y) / terrain.NoiseScale * octaveFrequency;
 
-					amplitude *= terrain.Persistance;
-					frequency *= terrain.Lacunarity;
-				}
+							float perlinValue = Math::PerlinNoise(sampleX, sampleY) * 2 - 1;
+							noiseHeight += perlinValue * octaveAmplitude;
 
-				if (noiseHeight > maxLocalNoiseHeight)
-				{
-					maxLocalNoiseHeight = noiseHeight;
-				}
-				else if (noiseHeight < minLocalNoiseHeight)
-				{
-					minLocalNoiseHeight = noiseHeight;
-				}
+							octaveAmplitude *= terrain.Persistance;
+							octaveFrequency *= terrain.Lacunarity;
+						}
 
-				noiseMap[x + y * size] = noiseHeight;
+						range.x = glm::min(range.x, noiseHeight);
+						range.y = glm::max(range.y, noiseHeight);
 
-				// Normalise noise map values.
-				if (terrain.NormaliseMode == Component::Terrain::ENormaliseMode::GLOBAL)
-				{
-					float normalizedHeight = (noiseMap[x + y * size] + 1) / (maxPossibleHeight / 0.9f);
-					noiseMap[x + y * size] = glm::clamp(normalizedHeight, 0.f, std::numeric_limits<float>::max());
+						noiseMap[x + y * size] = noiseHeight;
+
+						// Normalise noise map values.
+						if (terrain.NormaliseMode == Component::Terrain::ENormaliseMode::GLOBAL)
+						{
+							float normalizedHeight = (noiseMap[x + y * size] + 1) / (maxPossibleHeight / 0.9f);
+							noiseMap[x + y * size] = glm::clamp(normalizedHeight, 0.f, std::numeric_limits<float>::max());
+						}
+					}
 				}
-			}
-		}
+
+				return range;
+			},
+			[](const glm::vec2& a, const glm::vec2& b)
+			{
+				return glm::vec2(glm::min(a.x, b.x), glm::max(a.y, b.y));
+			});
+
+		const float minLocalNoiseHeight = localNoiseHeightRange.x;
+		const float maxLocalNoiseHeight = localNoiseHeightRange.y;
 
 		// Normalise noise map values.
 		if (terrain.NormaliseMode == Component::Terrain::ENormaliseMode::LOCAL)
 		{
-			for (int y = 0; y < size; y++)
+			JobSystem::Get().ParallelFor(0, (uint32_t)size, [&](uint32_t y)
 			{
 				for (int x = 0; x < size; x++)
 				{
@@ -545,7 +552,7 @@ namespace HBL2
 						noiseMap[x + y * size] = noiseValue;
 					}
 				}
-			}
+			});
 		}
 
 		return noiseMap;
@@ -629,13 +636,17 @@ namespace HBL2
 		std::vector<glm::vec3> normals(vertexCount, glm::vec3(0.0f));
 
 		// Compute positions & uvs; build index list
-		uint32_t vi = 0;      // vertex index
-		uint32_t ii = 0;      // index index
 		float topLeftX = (width - 1) / -2.0f;
 		float topLeftZ = (height - 1) / 2.0f;
 
-		for (uint32_t y = 0; y < height; y += meshSimplificationIncrement)
+		// Each row writes a fixed slice of the vertex and index lists, so rows are generated in parallel.
+		JobSystem::Get().ParallelFor(0, verticesPerLine, [&](uint32_t row)
 		{
+			const uint32_t y = row * meshSimplificationIncrement;
+
+			uint32_t vi = row * verticesPerLine;          // vertex index
+			uint32_t ii = row * (verticesPerLine - 1) * 6; // index index
+
 			for (uint32_t x = 0; x < width; x += meshSimplificationIncrement, vi++)
 			{
 				// Position
@@ -664,7 +675,7 @@ namespace HBL2
 					indexBuffer[ii++] = d;
 				}
 			}
-		}
+		});
 
 		// Compute normals by accumulating face normals
 		for (uint32_t t = 0; t < indexCount; t += 3)
@@ -684,15 +695,13 @@ namespace HBL2
 			normals[i2] += faceNorm;
 		}
 
-		// Normalize all vertex normals
-		for (int i = 0; i < vertexCount; ++i)
+		// Normalize all vertex normals and merge into one vertex buffer.
+		JobSystem::Get().ParallelFor(0, vertexCount, [&](uint32_t i)
 		{
 			normals[i] = glm::normalize(normals[i]);
-		}
 
-		// Merge into one vertex buffer.
-		for (int i = 0, dst = 0; i < vertexCount; ++i)
-		{
+			uint32_t dst = i * 8;
+
 			// position
 			vertexBuffer[dst++] = positions[i].x;
 			vertexBuffer[dst++] = positions[i].y;
@@ -706,7 +715,7 @@ namespace HBL2
 			// uv
 			vertexBuffer[dst++] = uvs[i].x;
 			vertexBuffer[dst++] = uvs[i].y;
-		}
+		});
 
 		Handle<Mesh> chunkMesh = m_ResourceManager->CreateMesh({
 			.debugName = "terrain-mesh",
@@ -22,12 +22,26 @@ namespace HBL2
 
         m_Chunk = m_GlobalArena->AllocateChunkStruct(bytes, m_Reservation);
 
+#ifdef ARENA_TELEMETRY
+        m_Telemetry.Reset();
+        m_Reservation->Telemetry.AddArena(&m_Telemetry);
+#endif
+
         m_Used.store(0);
         m_HighWater.store(0);
+        m_LastUsed.store(0);
+        m_PeakUsed.store(0);
     }
 
     void Arena::Destroy()
     {
+#ifdef ARENA_TELEMETRY
+        if (m_Reservation != nullptr)
+        {
+            m_Reservation->Telemetry.RemoveArena(&m_Telemetry);
+        }
+#endif
+
         // Return chunk struct to per-reservation or global free lists
         m_GlobalArena->FreeChunkStruct(m_Chunk);
         m_Chunk = nullptr;
@@ -70,6 +84,9 @@ namespace HBL2
             uintptr_t aligned = AlignUp(cur, alignment);
             size_t offset = static_cast<size_t>(aligned - base);
             ch->Used = offset + size;
+#ifdef ARENA_TELEMETRY
+            m_Telemetry.OnAlloc(ch->Used);
+#endif
 #ifdef ARENA_DEBUG
             UpdateStats(size);
 #endif
@@ -97,7 +114,11 @@ namespace HBL2
     {
         if (m_Chunk != nullptr)
         {
+            UpdatePeak();
             m_Chunk->Used = m.UsedInLast;
+#ifdef ARENA_TELEMETRY
+            m_Telemetry.SetBytesUsed(m_Chunk->Used);
+#endif
         }
 
 #ifdef ARENA_DEBUG
@@ -109,7 +130,11 @@ namespace HBL2
     {
         if (m_Chunk != nullptr)
         {
+            UpdatePeak();
             m_Chunk->Used = 0;
+#ifdef ARENA_TELEMETRY
+            m_Telemetry.SetBytesUsed(0);
+#endif
         }
 
 #ifdef ARENA_DEBUG
@@ -117,6 +142,18 @@ namespace HBL2
 #endif
     }
 
+    void Arena::UpdatePeak()
+    {
+        // Cheap enough to track in all builds, happens once per reset instead of once per allocation.
+        const size_t used = m_Chunk->Used;
+        m_LastUsed.store(used, std::memory_order_relaxed);
+
+        if (used > m_PeakUsed.load(std::memory_order_relaxed))
+        {
+            m_PeakUsed.store(used, std::memory_order_relaxed);
+        }
+    }
+
     void Arena::UpdateStats(size_t delta)
     {
         size_t prev = m_Used.fetch_add(delta);
@@ -199,11 +199,28 @@ namespace HBL2
          */
         inline size_t HighWater() const { return m_HighWater.load(); }
 
+        /**
+         * @brief Bytes used right before the last reset or restore (tracked in all builds).
+         */
+        inline size_t LastUsedBytes() const { return m_LastUsed.load(std::memory_order_relaxed); }
+
+        /**
+         * @brief Peak bytes used observed at resets or restores (tracked in all builds).
+         */
+        inline size_t PeakBytes() const { return m_PeakUsed.load(std::memory_order_relaxed); }
+
+        /**
+         * @brief Clears the peak, used to measure peaks over a time window.
+         */
+        inline void ResetPeak() { m_PeakUsed.store(0, std::memory_order_relaxed); }
+
     private:
         bool AcquireChunk(size_t minCapacity);
 
         void UpdateStats(size_t delta);
 
+        void UpdatePeak();
+
         void RecalcStats();
 
     private:
@@ -216,5 +233,12 @@ namespace HBL2
         std::atomic<size_t> m_Used{ 0 };
         std::atomic<size_t> m_UsedBeforeReset{ 0 };
         std::atomic<size_t> m_HighWater{ 0 };
+
+        std::atomic<size_t> m_LastUsed{ 0 };
+        std::atomic<size_t> m_PeakUsed{ 0 };
+
+#ifdef ARENA_TELEMETRY
+        ArenaTelemetry m_Telemetry;
+#endif
     };
 }
\ No newline at end of file
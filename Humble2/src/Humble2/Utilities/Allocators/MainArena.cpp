@@ -1,5 +1,10 @@
 #include "MainArena.h"
 
+#ifdef __linux__
+    #include <sys/mman.h>
+    #include <unistd.h>
+#endif
+
 namespace HBL2
 {
     inline uint32_t lzcnt_nonzero(uint32_t v)
@@ -118,9 +123,9 @@ namespace HBL2
         return tzcnt_nonzero(bitsAfter);
     }
 
-    MainArena::MainArena(size_t totalBytes, size_t metaBytes)
+    MainArena::MainArena(size_t totalBytes, size_t metaBytes, HugePageMode hugePageMode)
     {
-        Initialize(totalBytes, metaBytes);
+        Initialize(totalBytes, metaBytes, hugePageMode);
     }
 
     MainArena::~MainArena()
@@ -144,23 +149,16 @@ namespace HBL2
         m_Reservations.clear();
         m_FreeReservations.clear();
 
-        if (m_Mem)
-        {
-            std::free(m_Mem);
-            m_Mem = nullptr;
-        }
+        FreeBackingMemory();
     }
 
-    void MainArena::Initialize(size_t totalBytes, size_t metaBytes)
+    void MainArena::Initialize(size_t totalBytes, size_t metaBytes, HugePageMode hugePageMode)
     {
         // Prevent leaks / re-init misuse
-        if (m_Mem)
-        {
-            std::free(m_Mem);
-            m_Mem = nullptr;
-        }
+        FreeBackingMemory();
 
         m_TotalBytes = totalBytes;
+        m_HugePageMode = hugePageMode;
 
         if (metaBytes == 0 || metaBytes >= totalBytes)
         {
@@ -168,7 +166,42 @@ namespace HBL2
             std::abort();
         }
 
+#ifdef __linux__
+        // Reserve address space only, physical pages are committed lazily on first touch.
+        if (m_HugePageMode == HugePageMode::Explicit)
+        {
+            // No MAP_NORESERVE here, so the huge pages are reserved from the hugetlb pool up front. Otherwise the mapping
+            // succeeds even when the pool cannot back it, and the first touch past the pool raises SIGBUS instead of
+            // falling back below.
+            const size_t mappedBytes = AlignUp(m_TotalBytes, HUGE_PAGE_SIZE);
+            void* mem = mmap(nullptr, mappedBytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+
+            if (mem != MAP_FAILED)
+            {
+                m_Mem = static_cast<uint8_t*>(mem);
+                m_MappedBytes = mappedBytes;
+            }
+            else
+            {
+                HBL2_CORE_WARN("MainArena: MAP_HUGETLB mapping of {} bytes failed, falling back to transparent huge pages.", mappedBytes);
+                m_HugePageMode = HugePageMode::Transparent;
+            }
+        }
+
+        if (!m_Mem)
+        {
+            void* mem = mmap(nullptr, m_TotalBytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+
+            if (mem != MAP_FAILED)
+            {
+                m_Mem = static_cast<uint8_t*>(mem);
+                m_MappedBytes = m_TotalBytes;
+            }
+        }
+#else
         m_Mem = static_cast<uint8_t*>(std::malloc(m_TotalBytes));
+#endif
+
         if (!m_Mem)
         {
             HBL2_CORE_FATAL("MainArena ERROR: could not allocate {} bytes.", m_TotalBytes);
@@ -216,7 +249,103 @@ namespace HBL2
         Reset();
     }
 
-    PoolReservation* MainArena::Reserve(std::string_view name, size_t bytes)
+    void MainArena::FreeBackingMemory()
+    {
+        if (!m_Mem)
+        {
+            return;
+        }
+
+#ifdef __linux__
+        if (m_MappedBytes != 0)
+        {
+            munmap(m_Mem, m_MappedBytes);
+        }
+#else
+        std::free(m_Mem);
+#endif
+
+        m_Mem = nullptr;
+        m_MappedBytes = 0;
+    }
+
+    void MainArena::AdviseHugePages(size_t dataStart, size_t bytes)
+    {
+#ifdef __linux__
+        if (m_MappedBytes == 0 || m_HugePageMode != HugePageMode::Transparent)
+        {
+            return;
+        }
+
+        const uintptr_t begin = AlignUp((uintptr_t)(m_DataBase + dataStart), HUGE_PAGE_SIZE);
+        const uintptr_t end = (uintptr_t)(m_DataBase + dataStart + bytes) & ~(uintptr_t)(HUGE_PAGE_SIZE - 1);
+
+        if (end > begin)
+        {
+            madvise((void*)begin, end - begin, MADV_HUGEPAGE);
+        }
+#endif
+    }
+
+    void MainArena::DecommitData(size_t dataStart, size_t bytes)
+    {
+#ifdef __linux__
+        if (m_MappedBytes == 0)
+        {
+            return;
+        }
+
+        // Only release the pages fully inside the range, the edges might be shared with neighbouring allocations.
+        const size_t pageSize = m_HugePageMode == HugePageMode::Explicit ? HUGE_PAGE_SIZE : (size_t)sysconf(_SC_PAGESIZE);
+        const uintptr_t begin = AlignUp((uintptr_t)(m_DataBase + dataStart), pageSize);
+        const uintptr_t end = (uintptr_t)(m_DataBase + dataStart + bytes) & ~(uintptr_t)(pageSize - 1);
+
+        if (end > begin)
+        {
+            madvise((void*)begin, end - begin, MADV_DONTNEED);
+        }
+#endif
+    }
+
+    void MainArena::UpdateTelemetry(float deltaTime)
+    {
+        std::lock_guard<std::mutex> lk_meta(m_MetaMutex);
+
+        for (PoolReservation* r : m_Reservations)
+        {
+            size_t bytesUsed = 0;
+            uint64_t allocationCount = 0;
+            r->Telemetry.Read(bytesUsed, allocationCount);
+
+            r->Telemetry.AllocationsPerSecond = deltaTime > 0.0f ? (float)(allocationCount - r->Telemetry.LastAllocationCount) / deltaTime : 0.0f;
+            r->Telemetry.LastAllocationCount = allocationCount;
+        }
+    }
+
+    std::vector<ReservationStats> MainArena::GetReservationStats()
+    {
+        std::lock_guard<std::mutex> lk_meta(m_MetaMutex);
+
+        std::vector<ReservationStats> stats;
+        stats.reserve(m_Reservations.size());
+
+        for (PoolReservation* r : m_Reservations)
+        {
+            ReservationStats& s = stats.emplace_back();
+            CopyName(s.Name, sizeof(s.Name), r->Name);
+            s.Size = r->Size;
+            s.Carved = r->Offset;
+            r->Telemetry.Read(s.BytesUsed, s.AllocationCount);
+            s.PeakBytesUsed = r->Telemetry.PeakBytesUsed;
+            s.ChunkCount = r->Telemetry.ChunkCount.load(std::memory_order_relaxed);
+            s.AllocationsPerSecond = r->Telemetry.AllocationsPerSecond;
+            s.HugePages = r->HugePages;
+        }
+
+        return stats;
+    }
+
+    PoolReservation* MainArena::Reserve(std::string_view name, size_t bytes, bool hugePages)
     {
         if (bytes == 0)
         {
@@ -242,6 +371,8 @@ namespace HBL2
                 r->Offset = 0;
                 r->BackingOffset = ArenaAllocation::NO_SPACE;
                 r->BackingMeta = ArenaAllocation::NO_SPACE;
+                r->HugePages = false;
+                r->Telemetry.Reset();
 
                 // Keep capacity, just clear contents
                 r->FreeChunks.clear();
@@ -265,8 +396,10 @@ namespace HBL2
         }
 
         // Allocate backing memory from DATA heap WITHOUT holding META lock.
-        size_t alignedByteSize = AlignUp(bytes, alignof(std::max_align_t));
-        if (!AllocateReservationBacking(r, alignedByteSize))
+        // Huge page reservations start on a huge page boundary, otherwise the first and last page can never be promoted.
+        const bool useHugePages = hugePages && m_HugePageMode != HugePageMode::None && bytes >= HUGE_PAGE_SIZE;
+        size_t alignedByteSize = AlignUp(bytes, useHugePages ? HUGE_PAGE_SIZE : alignof(std::max_align_t));
+        if (!AllocateReservationBacking(r, alignedByteSize, useHugePages ? HUGE_PAGE_SIZE : alignof(std::max_align_t)))
         {
             // Return object to free list so we don't leak reservation objects.
             std::lock_guard<std::mutex> lk_meta(m_MetaMutex);
@@ -274,6 +407,12 @@ namespace HBL2
             return nullptr;
         }
 
+        if (useHugePages)
+        {
+            r->HugePages = true;
+            AdviseHugePages(r->Start, r->Size);
+        }
+
         // Track live reservations.
         {
             std::lock_guard<std::mutex> lk_meta(m_MetaMutex);
@@ -335,6 +474,10 @@ namespace HBL2
 #endif
 
                 const size_t sizeFreed = (size_t)m_Nodes[r->BackingMeta].DataSize; // exact heap-used size
+
+                // Give the physical pages back to the OS, they will be committed again on first touch.
+                DecommitData(r->BackingOffset, sizeFreed);
+
                 IFree({ r->BackingOffset, r->BackingMeta });
 
                 // Always keep accounting consistent (not debug-only)
@@ -487,6 +630,9 @@ namespace HBL2
 #ifdef ARENA_DEBUG
                     candidate->ReservationGeneration = reservation->Generation;
                     reservation->LiveChunks.fetch_add(1, std::memory_order_relaxed);
+#endif
+#ifdef ARENA_TELEMETRY
+                    reservation->Telemetry.ChunkCount.fetch_add(1, std::memory_order_relaxed);
 #endif
                     return candidate;
                 }
@@ -509,6 +655,9 @@ namespace HBL2
         ArenaChunk* ch = ::new (structMem) ArenaChunk(payload, payload_capacity, reservation);
 #ifdef ARENA_DEBUG
         reservation->LiveChunks.fetch_add(1, std::memory_order_relaxed);
+#endif
+#ifdef ARENA_TELEMETRY
+        reservation->Telemetry.ChunkCount.fetch_add(1, std::memory_order_relaxed);
 #endif
         return ch;
     }
@@ -530,14 +679,20 @@ namespace HBL2
         {
 #ifdef ARENA_DEBUG
             ch->Reservation->LiveChunks.fetch_sub(1, std::memory_order_relaxed);
+#endif
+#ifdef ARENA_TELEMETRY
+            ch->Reservation->Telemetry.ChunkCount.fetch_sub(1, std::memory_order_relaxed);
 #endif
             std::lock_guard<std::mutex> lkRes(ch->Reservation->FreeChunksMutex);
             ch->Reservation->FreeChunks.push_back(ch);
         }
     }
-    bool MainArena::AllocateReservationBacking(PoolReservation* r, size_t bytes)
+    bool MainArena::AllocateReservationBacking(PoolReservation* r, size_t bytes, size_t alignment)
     {
-        ArenaAllocation alloc = IAllocate(bytes);
+        // The DATA heap only guarantees alignof(std::max_align_t), over-allocate to be able to align the start.
+        const size_t padding = alignment > alignof(std::max_align_t) ? alignment : 0;
+
+        ArenaAllocation alloc = IAllocate((uint32_t)(bytes + padding));
 
         if (alloc.offset == ArenaAllocation::NO_SPACE && alloc.metadata == ArenaAllocation::NO_SPACE)
         {
@@ -545,7 +700,7 @@ namespace HBL2
             return false;
         }
 
-        r->Start = (size_t)alloc.offset;
+        r->Start = padding != 0 ? AlignUp((uintptr_t)(m_DataBase + alloc.offset), alignment) - (uintptr_t)m_DataBase : (size_t)alloc.offset;
         r->Size = bytes;
         r->Offset = 0;
         r->BackingOffset = alloc.offset;
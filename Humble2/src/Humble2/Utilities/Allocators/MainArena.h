@@ -77,6 +77,20 @@ namespace HBL2
 
     static constexpr uint32_t INVALID32 = 0xFFFFFFFFu;
 
+    static constexpr size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+
+    /**
+     * @brief How the MainArena uses huge pages for its backing memory.
+     *
+     * @note Only has an effect on Linux, where the arena memory is mapped with mmap.
+     */
+    enum class HugePageMode : uint8_t
+    {
+        None = 0,    // Regular pages only.
+        Transparent, // Reservations created with hugePages = true are 2 MB aligned and advised with MADV_HUGEPAGE.
+        Explicit,    // The whole arena is mapped with MAP_HUGETLB, falls back to Transparent if no huge pages are available.
+    };
+
     static constexpr uint32_t NUM_TOP_BINS = 32;
     static constexpr uint32_t BINS_PER_LEAF = 8;
     static constexpr uint32_t TOP_BINS_INDEX_SHIFT = 3;
@@ -110,6 +124,127 @@ namespace HBL2
         Region freeRegions[NUM_LEAF_BINS];
     };
 
+    /**
+     * @brief Usage counters of a single arena (or of a single PoolArena magazine), summed into its reservation when read.
+     *
+     * Only the owner of the counters writes them, so they are updated with plain relaxed loads and stores
+     * instead of read-modify-writes on a counter every arena of the reservation shares.
+     */
+    struct ArenaTelemetry
+    {
+        std::atomic<size_t> BytesUsed{ 0 };
+        std::atomic<uint64_t> AllocationCount{ 0 };
+        ArenaTelemetry* Next = nullptr;
+
+        inline void OnAlloc(size_t bytesUsed)
+        {
+            BytesUsed.store(bytesUsed, std::memory_order_relaxed);
+            AllocationCount.store(AllocationCount.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        }
+
+        inline void SetBytesUsed(size_t bytesUsed)
+        {
+            BytesUsed.store(bytesUsed, std::memory_order_relaxed);
+        }
+
+        void Reset()
+        {
+            BytesUsed.store(0, std::memory_order_relaxed);
+            AllocationCount.store(0, std::memory_order_relaxed);
+            Next = nullptr;
+        }
+    };
+
+    /**
+     * @brief Usage counters of a reservation (when ARENA_TELEMETRY is defined).
+     *
+     * The chunk count is kept on chunk acquire and release, everything else is merged from the ArenaTelemetry
+     * of the arenas that allocate from the reservation, whenever the stats are read.
+     */
+    struct ReservationTelemetry
+    {
+        std::atomic<uint32_t> ChunkCount{ 0 };    // Live chunks carved from the reservation.
+
+        // Updated when the telemetry is read, under the MainArena meta lock.
+        size_t PeakBytesUsed = 0;                 // High-water mark of the bytes used, sampled on every read.
+        uint64_t LastAllocationCount = 0;
+        float AllocationsPerSecond = 0.0f;
+
+        void AddArena(ArenaTelemetry* arena)
+        {
+            std::lock_guard<std::mutex> lk(m_ArenasMutex);
+            arena->Next = m_Arenas;
+            m_Arenas = arena;
+        }
+
+        void RemoveArena(ArenaTelemetry* arena)
+        {
+            std::lock_guard<std::mutex> lk(m_ArenasMutex);
+
+            for (ArenaTelemetry** it = &m_Arenas; *it != nullptr; it = &(*it)->Next)
+            {
+                if (*it == arena)
+                {
+                    *it = arena->Next;
+                    arena->Next = nullptr;
+
+                    // Keep the allocation count monotonic, so the allocation rate never goes negative.
+                    m_RetiredAllocationCount += arena->AllocationCount.load(std::memory_order_relaxed);
+                    return;
+                }
+            }
+        }
+
+        void Read(size_t& bytesUsed, uint64_t& allocationCount)
+        {
+            std::lock_guard<std::mutex> lk(m_ArenasMutex);
+
+            bytesUsed = 0;
+            allocationCount = m_RetiredAllocationCount;
+
+            // Unsigned wrap around is intended, a PoolArena magazine can free more blocks than it allocated.
+            for (const ArenaTelemetry* arena = m_Arenas; arena != nullptr; arena = arena->Next)
+            {
+                bytesUsed += arena->BytesUsed.load(std::memory_order_relaxed);
+                allocationCount += arena->AllocationCount.load(std::memory_order_relaxed);
+            }
+
+            PeakBytesUsed = std::max(PeakBytesUsed, bytesUsed);
+        }
+
+        void Reset()
+        {
+            std::lock_guard<std::mutex> lk(m_ArenasMutex);
+            m_Arenas = nullptr;
+            m_RetiredAllocationCount = 0;
+            ChunkCount.store(0, std::memory_order_relaxed);
+            PeakBytesUsed = 0;
+            LastAllocationCount = 0;
+            AllocationsPerSecond = 0.0f;
+        }
+
+    private:
+        std::mutex m_ArenasMutex;
+        ArenaTelemetry* m_Arenas = nullptr;
+        uint64_t m_RetiredAllocationCount = 0;
+    };
+
+    /**
+     * @brief A snapshot of the state of a reservation.
+     */
+    struct ReservationStats
+    {
+        char Name[64]{};
+        size_t Size = 0;          // Total reserved bytes.
+        size_t Carved = 0;        // Bytes carved into chunks.
+        size_t BytesUsed = 0;
+        size_t PeakBytesUsed = 0;
+        uint32_t ChunkCount = 0;
+        uint64_t AllocationCount = 0;
+        float AllocationsPerSecond = 0.0f;
+        bool HugePages = false;
+    };
+
     /**
      * @brief ...
      *
@@ -127,6 +262,10 @@ namespace HBL2
 
         std::atomic<uint32_t> RefCount{ 0 };
 
+        bool HugePages = false; // Backed by huge pages when the arena supports it.
+
+        ReservationTelemetry Telemetry;
+
         // Chunk struct reuse list (structs live in META)
         std::vector<class ArenaChunk*> FreeChunks;
         std::mutex FreeChunksMutex;
@@ -225,11 +364,23 @@ namespace HBL2
     {
     public:
         MainArena() = default;
-        MainArena(size_t totalBytes, size_t metaBytes);
+        MainArena(size_t totalBytes, size_t metaBytes, HugePageMode hugePageMode = HugePageMode::Transparent);
 
         ~MainArena();
 
-        void Initialize(size_t totalBytes, size_t metaBytes);
+        /**
+         * @brief Allocates the backing memory of the arena.
+         *
+         * @note On Linux the memory is mapped with MAP_NORESERVE, so physical pages are only committed
+         *       once touched and are returned to the OS when a reservation is released.
+         *       HugePageMode::Explicit reserves the whole arena from the hugetlb pool instead, so a pool that is too small
+         *       fails here (and falls back to transparent huge pages) rather than on first touch.
+         *
+         * @param totalBytes The total size of the arena (META + DATA).
+         * @param metaBytes The size of the META region.
+         * @param hugePageMode How huge pages are used for the DATA region.
+         */
+        void Initialize(size_t totalBytes, size_t metaBytes, HugePageMode hugePageMode = HugePageMode::Transparent);
 
         /**
          * @brief Returns a reservation of the specified size.
@@ -238,9 +389,10 @@ namespace HBL2
          *
          * @param name Debug name.
          * @param bytes Number of bytes that reservation can hold.
+         * @param hugePages Back the reservation with huge pages, meant for large and frequently accessed reservations.
          * @return A pointer to the reservation.
          */
-        PoolReservation* Reserve(std::string_view name, size_t bytes);
+        PoolReservation* Reserve(std::string_view name, size_t bytes, bool hugePages = false);
 
         /**
          * @brief Releases the memory of the reservation and appends it in the free list.
@@ -264,7 +416,7 @@ namespace HBL2
 
         void FreeChunkStruct(ArenaChunk* ch);
 
-        bool AllocateReservationBacking(PoolReservation* r, size_t bytes);
+        bool AllocateReservationBacking(PoolReservation* r, size_t bytes, size_t alignment = alignof(std::max_align_t));
 
         // Debug helpers
         inline size_t MetaCarved() const { return m_MetaCarved.load(std::memory_order_relaxed); }
@@ -277,10 +429,28 @@ namespace HBL2
 
         StorageReport GetStorageReport() const;
         StorageReportFull GetStorageReportFull() const;
+
+        /**
+         * @brief Updates the allocation rate and peak usage of every live reservation, meant to be called once per frame.
+         *
+         * @param deltaTime The time since the last call in seconds.
+         */
+        void UpdateTelemetry(float deltaTime);
+
+        /**
+         * @brief Returns a snapshot of every live reservation.
+         */
+        std::vector<ReservationStats> GetReservationStats();
     private:
+        void FreeBackingMemory();
+        void AdviseHugePages(size_t dataStart, size_t bytes);
+        void DecommitData(size_t dataStart, size_t bytes);
+
         // Raw memory
         uint8_t* m_Mem = nullptr;
         size_t   m_TotalBytes = 0;
+        size_t   m_MappedBytes = 0; // Non zero when the memory was mapped with mmap instead of malloc.
+        HugePageMode m_HugePageMode = HugePageMode::None;
 
         // META region (monotonic)
         uint8_t* m_MetaBase = nullptr;
@@ -61,10 +61,22 @@ namespace HBL2
         m_HeapSize = size;
 
         Reset();
+
+#ifdef ARENA_TELEMETRY
+        m_Telemetry.Reset();
+        m_Reservation->Telemetry.AddArena(&m_Telemetry);
+#endif
     }
 
     void OffsetArena::Destroy()
     {
+#ifdef ARENA_TELEMETRY
+        if (m_Reservation)
+        {
+            m_Reservation->Telemetry.RemoveArena(&m_Telemetry);
+        }
+#endif
+
         if (m_Reservation)
         {
             m_Reservation->RefCount.fetch_sub(1, std::memory_order_relaxed);
@@ -107,6 +119,10 @@ namespace HBL2
 
         InsertNodeIntoBin(root);
         m_TotalFree = m_HeapSize;
+
+#ifdef ARENA_TELEMETRY
+        m_Telemetry.SetBytesUsed(0);
+#endif
     }
 
     void* OffsetArena::Alloc(size_t bytes, size_t alignment)
@@ -150,6 +166,10 @@ namespace HBL2
         h->magic = POINTER_MAGIC;
         h->alloc = a;
 
+#ifdef ARENA_TELEMETRY
+        m_Telemetry.OnAlloc(m_HeapSize - m_TotalFree);
+#endif
+
         return reinterpret_cast<void*>(aligned);
     }
 
@@ -171,6 +191,10 @@ namespace HBL2
 
         FreeInternal(h->alloc);
 
+#ifdef ARENA_TELEMETRY
+        m_Telemetry.SetBytesUsed(m_HeapSize - m_TotalFree);
+#endif
+
         // Poison header to catch double frees early.
         h->magic = 0;
         h->alloc.offset = INVALID;
@@ -477,6 +501,7 @@ namespace HBL2
         HBL2_CORE_ASSERT(n.offset == a.offset, "allocation handle mismatch");
 
         n.used = false;
+        m_TotalFree += n.size;
 
         // Coalesce with prev
         if (n.neighborPrev != INVALID && !m_Nodes[n.neighborPrev].used)
@@ -506,19 +531,5 @@ namespace HBL2
         }
 
         InsertNodeIntoBin(a.metadata);
-
-        // Recompute total free conservatively (simple + safe)
-        uint32_t total = 0;
-        uint32_t idx = m_Head;
-        while (idx != INVALID)
-        {
-            if (!m_Nodes[idx].used)
-            {
-                total += m_Nodes[idx].size;
-            }
-
-            idx = m_Nodes[idx].neighborNext;
-        }
-        m_TotalFree = total;
     }
 }
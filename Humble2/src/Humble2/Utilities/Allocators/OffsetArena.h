@@ -184,6 +184,10 @@ namespace HBL2
 
         uint32_t m_TotalFree = 0;
 
+#ifdef ARENA_TELEMETRY
+        ArenaTelemetry m_Telemetry;
+#endif
+
         uint32_t PopFreeNode();
 
         void PushFreeNode(uint32_t idx);
@@ -1,7 +1,13 @@
 #include "PoolArena.h"
 
+#include <algorithm>
+
 namespace HBL2
 {
+    // Process-wide thread slot, used to pick a magazine in every PoolArena.
+    static std::atomic<uint32_t> s_NextMagazineSlot{ 0 };
+    static thread_local uint32_t s_MagazineSlot = s_NextMagazineSlot.fetch_add(1, std::memory_order_relaxed);
+
     PoolArena::~PoolArena()
     {
         if (!m_Destructed)
@@ -77,6 +83,26 @@ namespace HBL2
 
         m_HeadTagged.store(PackTagged(0u, 0u), std::memory_order_release);
 
+        void* magazineMem = m_GlobalArena->AllocMeta(sizeof(Magazine) * MaxMagazines, alignof(Magazine));
+        if (!magazineMem)
+        {
+            HBL2_CORE_ERROR("PoolArena ERROR: meta exhausted allocating thread magazines\n");
+            throw std::bad_alloc();
+        }
+
+        m_Magazines = static_cast<Magazine*>(magazineMem);
+        for (uint32_t i = 0; i < MaxMagazines; ++i)
+        {
+            ::new (static_cast<void*>(m_Magazines + i)) Magazine();
+        }
+
+#ifdef ARENA_TELEMETRY
+        for (uint32_t i = 0; i < MaxMagazines; ++i)
+        {
+            m_Reservation->Telemetry.AddArena(&m_Magazines[i].Telemetry);
+        }
+#endif
+
 #ifdef ARENA_DEBUG
         m_InUse.store(0);
         m_HighWater.store(0);
@@ -85,6 +111,16 @@ namespace HBL2
 
     void PoolArena::Destroy()
     {
+#ifdef ARENA_TELEMETRY
+        if (m_Reservation && m_Magazines)
+        {
+            for (uint32_t i = 0; i < MaxMagazines; ++i)
+            {
+                m_Reservation->Telemetry.RemoveArena(&m_Magazines[i].Telemetry);
+            }
+        }
+#endif
+
         if (m_Reservation)
         {
             m_Reservation->RefCount.fetch_sub(1, std::memory_order_relaxed);
@@ -118,7 +154,41 @@ namespace HBL2
             throw std::bad_alloc();
         }
 
-        const uint32_t idx = PopIndex();
+        uint32_t idx = InvalidIndex;
+
+        Magazine& magazine = GetMagazine();
+        LockMagazine(magazine);
+
+        if (magazine.Count == 0)
+        {
+            magazine.Count = PopBatch(magazine.Blocks, MagazineBatch);
+        }
+
+        if (magazine.Count != 0)
+        {
+            idx = magazine.Blocks[--magazine.Count];
+#ifdef ARENA_TELEMETRY
+            RecordAlloc(magazine);
+#endif
+        }
+
+        UnlockMagazine(magazine);
+
+        // The shared list is empty, but other threads may still cache free blocks.
+        if (idx == InvalidIndex)
+        {
+            idx = StealIndex();
+
+#ifdef ARENA_TELEMETRY
+            if (idx != InvalidIndex)
+            {
+                LockMagazine(magazine);
+                RecordAlloc(magazine);
+                UnlockMagazine(magazine);
+            }
+#endif
+        }
+
         if (idx == InvalidIndex)
         {
             HBL2_CORE_ERROR("PoolArena ERROR: exhausted (blocks={}, blockSize={})", m_BlockCount, m_BlockSize);
@@ -160,13 +230,50 @@ namespace HBL2
             return;
         }
 
-        PushIndex(idx);
+        Magazine& magazine = GetMagazine();
+        LockMagazine(magazine);
+
+        if (magazine.Count == MagazineCapacity)
+        {
+            // Flush the oldest half, the most recently freed blocks stay cached since they are likely still hot.
+            PushBatch(magazine.Blocks, MagazineBatch);
+            std::copy(magazine.Blocks + MagazineBatch, magazine.Blocks + MagazineCapacity, magazine.Blocks);
+            magazine.Count -= MagazineBatch;
+        }
+
+        magazine.Blocks[magazine.Count++] = idx;
+#ifdef ARENA_TELEMETRY
+        RecordFree(magazine);
+#endif
+
+        UnlockMagazine(magazine);
 
 #ifdef ARENA_DEBUG
         UpdateStats(-1);
 #endif
     }
 
+    void PoolArena::FlushThreadCache()
+    {
+        if (!m_Magazines)
+        {
+            return;
+        }
+
+        Magazine& magazine = GetMagazine();
+        LockMagazine(magazine);
+
+        PushBatch(magazine.Blocks, magazine.Count);
+        magazine.Count = 0;
+
+        UnlockMagazine(magazine);
+    }
+
+    PoolArena::Magazine& PoolArena::GetMagazine()
+    {
+        return m_Magazines[s_MagazineSlot % MaxMagazines];
+    }
+
     uint32_t PoolArena::PopIndex()
     {
         // MPMC lock-free pop (Treiber with tag)
@@ -210,6 +317,94 @@ namespace HBL2
             }
         }
     }
+    uint32_t PoolArena::PopBatch(uint32_t* out, uint32_t maxCount)
+    {
+        // Pop a whole chain with a single CAS. If the tag is unchanged nobody popped (and therefore nobody
+        // relinked) any node we walked, so the chain we read is exactly what we detach.
+        for (;;)
+        {
+            uint64_t head = m_HeadTagged.load(std::memory_order_acquire);
+            const uint32_t first = UnpackIndex(head);
+            const uint32_t tag = UnpackTag(head);
+
+            if (first == InvalidIndex)
+            {
+                return 0;
+            }
+
+            uint32_t count = 0;
+            uint32_t cur = first;
+            while (cur != InvalidIndex && count < maxCount)
+            {
+                out[count++] = cur;
+                cur = m_Next[cur].load(std::memory_order_acquire);
+            }
+
+            const uint64_t desired = PackTagged(cur, tag + 1);
+
+            if (m_HeadTagged.compare_exchange_weak(head, desired, std::memory_order_acq_rel, std::memory_order_acquire))
+            {
+                // Keep the head of the list on top of the magazine, so single-thread allocation order is unchanged.
+                std::reverse(out, out + count);
+                return count;
+            }
+        }
+    }
+
+    void PoolArena::PushBatch(const uint32_t* indices, uint32_t count)
+    {
+        if (count == 0)
+        {
+            return;
+        }
+
+        // Link the batch privately (we own these blocks), then publish it with a single CAS.
+        for (uint32_t i = 0; i + 1 < count; ++i)
+        {
+            m_Next[indices[i]].store(indices[i + 1], std::memory_order_relaxed);
+        }
+
+        const uint32_t first = indices[0];
+        const uint32_t last = indices[count - 1];
+
+        for (;;)
+        {
+            uint64_t head = m_HeadTagged.load(std::memory_order_acquire);
+            const uint32_t cur = UnpackIndex(head);
+            const uint32_t tag = UnpackTag(head);
+
+            m_Next[last].store(cur, std::memory_order_release);
+            const uint64_t desired = PackTagged(first, tag + 1);
+
+            if (m_HeadTagged.compare_exchange_weak(head, desired, std::memory_order_acq_rel, std::memory_order_acquire))
+            {
+                return;
+            }
+        }
+    }
+
+    uint32_t PoolArena::StealIndex()
+    {
+        // Slow path, only taken when the shared list is empty.
+        for (uint32_t i = 0; i < MaxMagazines; ++i)
+        {
+            Magazine& magazine = m_Magazines[i];
+            LockMagazine(magazine);
+
+            if (magazine.Count != 0)
+            {
+                const uint32_t idx = magazine.Blocks[--magazine.Count];
+                UnlockMagazine(magazine);
+                return idx;
+            }
+
+            UnlockMagazine(magazine);
+        }
+
+        // A block may have been flushed to the shared list while we were scanning.
+        return PopIndex();
+    }
+
     void PoolArena::UpdateStats(int32_t delta)
     {
 #ifdef ARENA_DEBUG
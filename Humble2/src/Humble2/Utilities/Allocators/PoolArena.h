@@ -8,8 +8,10 @@ namespace HBL2
      * @brief PoolArena: fixed-size block allocator with lock-free free list (MPMC).
      *
      * - Thread-safe, lock-free allocations/frees (index-based tagged stack).
+     * - Each thread has a small magazine cache of free blocks, so the shared stack is only touched
+     *   in batches (refill when empty, flush half when full) instead of once per Alloc/Free.
      * - Memory comes from MainArena DATA from a PoolReservation.
-     * - Metadata (free-list "next" array) is placement-new'd in MainArena META.
+     * - Metadata (free-list "next" array and magazines) is placement-new'd in MainArena META.
      */
     class HBL2_API PoolArena
     {
@@ -47,6 +49,14 @@ namespace HBL2
          */
         void Free(void* p);
 
+        /**
+         * @brief Return the blocks cached in the calling thread's magazine to the shared free list.
+         *
+         * Not required for correctness (Alloc steals from other magazines before reporting exhaustion),
+         * but useful before a thread exits so its cached blocks are immediately available to others.
+         */
+        void FlushThreadCache();
+
         template<typename T, typename... Args>
         T* AllocConstruct(Args&&... args)
         {
@@ -77,6 +87,24 @@ namespace HBL2
     private:
         static constexpr uint32_t InvalidIndex = 0xFFFFFFFFu;
 
+        static constexpr uint32_t MagazineCapacity = 32;
+        static constexpr uint32_t MagazineBatch = MagazineCapacity / 2;
+        static constexpr uint32_t MaxMagazines = 64;
+
+        // Per-thread cache of free block indices. Threads map to a magazine by a process-wide thread slot,
+        // the lock is only contended when more than MaxMagazines threads use the same pool.
+        struct alignas(64) Magazine
+        {
+            std::atomic_flag Lock = ATOMIC_FLAG_INIT;
+            uint32_t Count = 0;
+            uint32_t Blocks[MagazineCapacity];
+
+#ifdef ARENA_TELEMETRY
+            // Written under Lock. Blocks freed through another magazine make BytesUsed wrap, only the sum of all magazines is meaningful.
+            ArenaTelemetry Telemetry;
+#endif
+        };
+
         // Tagged head: low 32 bits = index, high 32 bits = tag (ABA mitigation for index stack).
         static inline uint64_t PackTagged(uint32_t index, uint32_t tag)
         {
@@ -97,8 +125,32 @@ namespace HBL2
 
         void PushIndex(uint32_t idx);
 
+        uint32_t PopBatch(uint32_t* out, uint32_t maxCount);
+
+        void PushBatch(const uint32_t* indices, uint32_t count);
+
+        uint32_t StealIndex();
+
+        Magazine& GetMagazine();
+
+        static inline void LockMagazine(Magazine& magazine)
+        {
+            while (magazine.Lock.test_and_set(std::memory_order_acquire)) {}
+        }
+
+        static inline void UnlockMagazine(Magazine& magazine)
+        {
+            magazine.Lock.clear(std::memory_order_release);
+        }
+
         void UpdateStats(int32_t delta);
 
+#ifdef ARENA_TELEMETRY
+        // Both expect the magazine to be locked.
+        inline void RecordAlloc(Magazine& magazine) { magazine.Telemetry.OnAlloc(magazine.Telemetry.BytesUsed.load(std::memory_order_relaxed) + m_BlockSize); }
+        inline void RecordFree(Magazine& magazine) { magazine.Telemetry.SetBytesUsed(magazine.Telemetry.BytesUsed.load(std::memory_order_relaxed) - m_BlockSize); }
+#endif
+
     private:
         MainArena* m_GlobalArena = nullptr;
         PoolReservation* m_Reservation = nullptr;
@@ -117,6 +169,9 @@ namespace HBL2
         // Free list storage (indices)
         std::atomic<uint32_t>* m_Next = nullptr;
 
+        // Thread magazines (MaxMagazines entries)
+        Magazine* m_Magazines = nullptr;
+
         // Tagged head: index+tag to reduce ABA on head CAS
         std::atomic<uint64_t> m_HeadTagged{ PackTagged(InvalidIndex, 0u) };
 
@@ -0,0 +1,895 @@
+#pragma once
+
+// Allocator_Benchmarks.cpp
+//
+// Benchmarks for the engine allocators against malloc/new under engine-like workloads.
+// Style matches the allocator tests: simple macros, bool benchmarks, RUN_TEST runner.
+//
+// Workloads:
+//  - Per-frame bump-and-reset: many small allocations per frame, everything dies at the end of the frame
+//    (Arena, ScratchArena, PoolArena, OffsetArena vs malloc/new)
+//  - Cross-thread free: producer threads allocate, a single consumer thread frees (PoolArena vs malloc/new)
+//  - Fragmentation churn: random-size alloc/free around a steady live set (OffsetArena, PoolArena vs malloc/new)
+//  - Concurrent MainArena::Reserve/TryRelease from several threads (vs malloc/free of the same sizes)
+//
+// Columns:
+//  - M ops/s  : allocations per second, the frees/resets of the workload are part of the timed loop
+//  - p50/p99  : per-allocation latency in ns. Every 16th allocation is timed (every Reserve in the last workload),
+//               the clock read overhead is included for every allocator alike
+//  - overhead : 1 - requested bytes / bytes consumed by the allocator at the peak live set (alignment, headers, block rounding)
+//  - ext frag : 1 - largest free region / total free space, only for allocators that can report it
+//
+// Numbers are only comparable between rows of the same run, build in Release (ARENA_DEBUG poisons and validates).
+//
+
+#include "Utilities/Allocators/MainArena.h"
+#include "Utilities/Allocators/Arena.h"
+#include "Utilities/Allocators/ScratchArena.h"
+#include "Utilities/Allocators/PoolArena.h"
+#include "Utilities/Allocators/OffsetArena.h"
+
+#include <vector>
+#include <random>
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <cstdio>
+#include <cstdlib>
+#include <cstdint>
+#include <cmath>
+#include <algorithm>
+
+using namespace HBL2;
+
+// ----------------------------
+// Test framework macros
+// ----------------------------
+#define TEST_ASSERT(condition) \
+    do { \
+        if (!(condition)) { \
+            std::cout << "FAILED: " << #condition << " at line " << __LINE__ << std::endl; \
+            return false; \
+        } \
+    } while(0)
+
+#define RUN_TEST(test_func) \
+    do { \
+        std::cout << "Running " << #test_func << "... "; \
+        if (test_func()) { \
+            std::cout << "PASSED" << std::endl; \
+        } else { \
+            std::cout << "FAILED" << std::endl; \
+            return 1; \
+        } \
+    } while(0)
+
+// ----------------------------
+// Benchmark helpers
+// ----------------------------
+using BenchClock = std::chrono::steady_clock;
+
+static constexpr uint32_t BENCH_SAMPLE_EVERY = 16;
+
+struct BenchRow
+{
+    const char* Name = "";
+    double MOpsPerSec = 0.0;
+    double P50 = 0.0;
+    double P99 = 0.0;
+    double Overhead = -1.0; // < 0 means not available
+    double ExtFrag = -1.0;  // < 0 means not available
+};
+
+struct BenchContext
+{
+    MainArena Global;
+
+    BenchContext(size_t totalBytes = 1024ull * 1024 * 1024, size_t metaBytes = 64ull * 1024 * 1024)
+    {
+        Global.Initialize(totalBytes, metaBytes);
+    }
+};
+
+static inline uint32_t bench_elapsed_ns(BenchClock::time_point a, BenchClock::time_point b)
+{
+    return (uint32_t)std::min<int64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(b - a).count(), UINT32_MAX);
+}
+
+static inline double bench_seconds(BenchClock::time_point a, BenchClock::time_point b)
+{
+    return std::max(std::chrono::duration<double>(b - a).count(), 1e-9);
+}
+
+static inline double bench_percentile(std::vector<uint32_t>& samples, double p)
+{
+    if (samples.empty())
+    {
+        return 0.0;
+    }
+
+    const size_t idx = std::min(samples.size() - 1, (size_t)(p * (double)(samples.size() - 1) + 0.5));
+    std::nth_element(samples.begin(), samples.begin() + idx, samples.end());
+    return (double)samples[idx];
+}
+
+static inline void bench_fill_latency(BenchRow& row, std::vector<uint32_t>& samples)
+{
+    row.P50 = bench_percentile(samples, 0.50);
+    row.P99 = bench_percentile(samples, 0.99);
+}
+
+static inline std::string bench_percent(double value)
+{
+    if (value < 0.0)
+    {
+        return "n/a";
+    }
+
+    char buffer[16];
+    std::snprintf(buffer, sizeof(buffer), "%.1f%%", value * 100.0);
+    return buffer;
+}
+
+static inline void bench_print_header(const char* workload)
+{
+    std::cout << "\n  " << workload << "\n  "
+        << std::left << std::setw(16) << "allocator" << std::right
+        << std::setw(10) << "M ops/s"
+        << std::setw(10) << "p50 ns"
+        << std::setw(10) << "p99 ns"
+        << std::setw(10) << "overhead"
+        << std::setw(10) << "ext frag";
+}
+
+static inline void bench_print_row(const BenchRow& row)
+{
+    char line[160];
+    std::snprintf(line, sizeof(line), "%-16s%10.2f%10.0f%10.0f%10s%10s", row.Name, row.MOpsPerSec, row.P50, row.P99, bench_percent(row.Overhead).c_str(), bench_percent(row.ExtFrag).c_str());
+    std::cout << "\n  " << line;
+}
+
+static inline double bench_overhead(size_t requested, size_t consumed)
+{
+    return consumed > 0 ? 1.0 - (double)requested / (double)consumed : -1.0;
+}
+
+static inline double bench_ext_frag(uint32_t totalFree, uint32_t largestFree)
+{
+    return totalFree > 0 ? 1.0 - (double)largestFree / (double)totalFree : 0.0;
+}
+
+// Reservation with some slack, the pools align their base inside the reservation.
+static inline PoolReservation* bench_reserve(MainArena& global, const char* name, size_t bytes)
+{
+    return global.Reserve(name, bytes + 4096);
+}
+
+// -------------------------------------
+// Workload 1: per-frame bump-and-reset
+// -------------------------------------
+static constexpr uint32_t BENCH_FRAMES = 200;
+static constexpr uint32_t BENCH_ALLOCS_PER_FRAME = 10000;
+
+// Runs BENCH_FRAMES frames of alloc(size) for every size, then endFrame(live) at the end of the frame.
+// peak(live, requestedBytes, row) is called once at the end of the last frame, before it is released.
+template<typename AllocFn, typename EndFrameFn, typename PeakFn>
+static bool bench_run_frames(BenchRow& row, const std::vector<uint32_t>& sizes, AllocFn&& alloc, EndFrameFn&& endFrame, PeakFn&& peak)
+{
+    std::vector<void*> live;
+    live.reserve(sizes.size());
+
+    std::vector<uint32_t> latencies;
+    latencies.reserve(BENCH_FRAMES * sizes.size() / BENCH_SAMPLE_EVERY + 1);
+
+    size_t requestedBytes = 0;
+    for (uint32_t size : sizes) requestedBytes += size;
+
+    bool ok = true;
+
+    const auto start = BenchClock::now();
+
+    for (uint32_t frame = 0; frame < BENCH_FRAMES; ++frame)
+    {
+        for (uint32_t i = 0; i < (uint32_t)sizes.size(); ++i)
+        {
+            uint8_t* p;
+
+            if ((i % BENCH_SAMPLE_EVERY) == 0)
+            {
+                const auto t0 = BenchClock::now();
+                p = static_cast<uint8_t*>(alloc(sizes[i]));
+                latencies.push_back(bench_elapsed_ns(t0, BenchClock::now()));
+            }
+            else
+            {
+                p = static_cast<uint8_t*>(alloc(sizes[i]));
+            }
+
+            if (p == nullptr)
+            {
+                ok = false;
+                break;
+            }
+
+            p[0] = (uint8_t)i;
+            p[sizes[i] - 1] = (uint8_t)i;
+            live.push_back(p);
+        }
+
+        if (frame == BENCH_FRAMES - 1)
+        {
+            peak(live, requestedBytes, row);
+        }
+
+        endFrame(live);
+        live.clear();
+    }
+
+    const auto end = BenchClock::now();
+
+    row.MOpsPerSec = (double)BENCH_FRAMES * (double)sizes.size() / bench_seconds(start, end) / 1e6;
+    bench_fill_latency(row, latencies);
+
+    return ok;
+}
+
+bool bench_frame_bump_and_reset()
+{
+    BenchContext ctx;
+
+    std::mt19937 rng(1337);
+    std::uniform_int_distribution<uint32_t> sizeDist(16, 256);
+
+    std::vector<uint32_t> sizes(BENCH_ALLOCS_PER_FRAME);
+    for (auto& size : sizes) size = sizeDist(rng);
+
+    const size_t frameBytes = (256 + 16) * (size_t)BENCH_ALLOCS_PER_FRAME;
+    auto noPeak = [](const std::vector<void*>&, size_t, BenchRow&) {};
+
+    bench_print_header("Per-frame bump-and-reset (10000 allocs of 16-256B per frame, 200 frames)");
+
+    // Arena
+    {
+        PoolReservation* res = bench_reserve(ctx.Global, "BenchFrameArena", frameBytes);
+        TEST_ASSERT(res != nullptr);
+
+        Arena arena;
+        arena.Initialize(&ctx.Global, frameBytes, res);
+
+        BenchRow row{ "Arena" };
+        TEST_ASSERT(bench_run_frames(row, sizes,
+            [&](uint32_t size) { return arena.Alloc(size, 16); },
+            [&](std::vector<void*>&) { arena.Reset(); },
+            [&](const std::vector<void*>&, size_t requested, BenchRow& r) { r.Overhead = bench_overhead(requested, arena.Mark().UsedInLast); }));
+        bench_print_row(row);
+    }
+
+    // ScratchArena on top of a long-lived arena prefix
+    {
+        PoolReservation* res = bench_reserve(ctx.Global, "BenchFrameScratch", frameBytes + 64 * 1024);
+        TEST_ASSERT(res != nullptr);
+
+        Arena arena;
+        arena.Initialize(&ctx.Global, frameBytes + 64 * 1024, res);
+        (void)arena.Alloc(64 * 1024, 16);
+
+        const size_t prefix = arena.Mark().UsedInLast;
+
+        std::optional<ScratchArena> scratch;
+        scratch.emplace(arena);
+
+        BenchRow row{ "ScratchArena" };
+        TEST_ASSERT(bench_run_frames(row, sizes,
+            [&](uint32_t size) { return scratch->Alloc(size, 16); },
+            [&](std::vector<void*>&) { scratch.reset(); scratch.emplace(arena); },
+            [&](const std::vector<void*>&, size_t requested, BenchRow& r) { r.Overhead = bench_overhead(requested, arena.Mark().UsedInLast - prefix); }));
+        scratch.reset();
+
+        TEST_ASSERT(arena.Mark().UsedInLast == prefix);
+        bench_print_row(row);
+    }
+
+    // PoolArena (256B blocks)
+    {
+        const size_t poolBytes = 256 * (size_t)BENCH_ALLOCS_PER_FRAME * 2;
+        PoolReservation* res = bench_reserve(ctx.Global, "BenchFramePool", poolBytes);
+        TEST_ASSERT(res != nullptr);
+
+        PoolArena pool;
+        pool.Initialize(&ctx.Global, poolBytes, 256, res, 16);
+
+        BenchRow row{ "PoolArena" };
+        TEST_ASSERT(bench_run_frames(row, sizes,
+            [&](uint32_t size) { return pool.Alloc(size, 16); },
+            [&](std::vector<void*>& live) { for (void* p : live) pool.Free(p); },
+            [&](const std::vector<void*>& live, size_t requested, BenchRow& r) { r.Overhead = bench_overhead(requested, live.size() * 256); }));
+        pool.FlushThreadCache();
+        bench_print_row(row);
+    }
+
+    // OffsetArena
+    {
+        const uint32_t heapBytes = (uint32_t)(frameBytes * 2);
+        PoolReservation* res = bench_reserve(ctx.Global, "BenchFrameOffset", heapBytes);
+        TEST_ASSERT(res != nullptr);
+
+        OffsetArena offset;
+        offset.Initialize(&ctx.Global, heapBytes, res, BENCH_ALLOCS_PER_FRAME * 2);
+
+        BenchRow row{ "OffsetArena" };
+        TEST_ASSERT(bench_run_frames(row, sizes,
+            [&](uint32_t size) { return offset.Alloc(size, 16); },
+            [&](std::vector<void*>& live) { for (void* p : live) offset.Free(p); },
+            [&](const std::vector<void*>&, size_t requested, BenchRow& r)
+            {
+                const OffsetArena::StorageReport report = offset.GetStorageReport();
+                r.Overhead = bench_overhead(requested, offset.HeapSize() - report.totalFree);
+                r.ExtFrag = bench_ext_frag(report.totalFree, report.largestFree);
+            }));
+        TEST_ASSERT(offset.Validate());
+        bench_print_row(row);
+    }
+
+    // malloc/free
+    {
+        BenchRow row{ "malloc" };
+        TEST_ASSERT(bench_run_frames(row, sizes,
+            [&](uint32_t size) { return std::malloc(size); },
+            [&](std::vector<void*>& live) { for (void* p : live) std::free(p); },
+            noPeak));
+        bench_print_row(row);
+    }
+
+    // new/delete
+    {
+        BenchRow row{ "new" };
+        TEST_ASSERT(bench_run_frames(row, sizes,
+            [&](uint32_t size) { return (void*)new uint8_t[size]; },
+            [&](std::vector<void*>& live) { for (void* p : live) delete[] static_cast<uint8_t*>(p); },
+            noPeak));
+        bench_print_row(row);
+    }
+
+    std::cout << "\n";
+    return true;
+}
+
+// -------------------------------------
+// Workload 2: cross-thread free
+// -------------------------------------
+static constexpr uint32_t BENCH_XT_BATCH = 256;
+static constexpr uint32_t BENCH_XT_ALLOCS_PER_PRODUCER = BENCH_XT_BATCH * 800;
+static constexpr int64_t BENCH_XT_MAX_IN_FLIGHT = 64 * 1024;
+
+// Producers allocate batches and hand them to a single consumer thread that frees them (job results, render packets).
+// threadExit() is called on every thread before it finishes (PoolArena flushes its magazine there).
+template<typename AllocFn, typename FreeFn, typename ThreadExitFn>
+static bool bench_run_cross_thread(BenchRow& row, int producerCount, AllocFn&& alloc, FreeFn&& release, ThreadExitFn&& threadExit)
+{
+    std::mutex queueMutex;
+    std::vector<std::vector<void*>> queue;
+
+    std::atomic<int64_t> inFlight{ 0 };
+    std::atomic<bool> ok{ true };
+    std::atomic<bool> go{ false };
+
+    const uint64_t total = (uint64_t)producerCount * BENCH_XT_ALLOCS_PER_PRODUCER;
+
+    std::vector<std::vector<uint32_t>> latencies(producerCount);
+
+    auto producer = [&](int tid)
+    {
+        std::mt19937 rng(1000 + tid);
+        std::uniform_int_distribution<uint32_t> sizeDist(64, 256);
+
+        auto& samples = latencies[tid];
+        samples.reserve(BENCH_XT_ALLOCS_PER_PRODUCER / BENCH_SAMPLE_EVERY + 1);
+
+        while (!go.load(std::memory_order_acquire)) {}
+
+        try
+        {
+            for (uint32_t i = 0; i < BENCH_XT_ALLOCS_PER_PRODUCER; i += BENCH_XT_BATCH)
+            {
+                while (inFlight.load(std::memory_order_relaxed) > BENCH_XT_MAX_IN_FLIGHT)
+                {
+                    std::this_thread::yield();
+                }
+
+                std::vector<void*> batch;
+                batch.reserve(BENCH_XT_BATCH);
+
+                for (uint32_t j = 0; j < BENCH_XT_BATCH; ++j)
+                {
+                    const uint32_t size = sizeDist(rng);
+                    uint8_t* p;
+
+                    if ((j % BENCH_SAMPLE_EVERY) == 0)
+                    {
+                        const auto t0 = BenchClock::now();
+                        p = static_cast<uint8_t*>(alloc(size));
+                        samples.push_back(bench_elapsed_ns(t0, BenchClock::now()));
+                    }
+                    else
+                    {
+                        p = static_cast<uint8_t*>(alloc(size));
+                    }
+
+                    p[0] = (uint8_t)tid;
+                    batch.push_back(p);
+                }
+
+                inFlight.fetch_add(BENCH_XT_BATCH, std::memory_order_relaxed);
+
+                std::lock_guard<std::mutex> lock(queueMutex);
+                queue.push_back(std::move(batch));
+            }
+        }
+        catch (...)
+        {
+            ok.store(false, std::memory_order_relaxed);
+        }
+
+        threadExit();
+    };
+
+    uint64_t freed = 0;
+
+    auto consumer = [&]()
+    {
+        std::vector<std::vector<void*>> local;
+
+        while (!go.load(std::memory_order_acquire)) {}
+
+        while (freed < total && ok.load(std::memory_order_relaxed))
+        {
+            {
+                std::lock_guard<std::mutex> lock(queueMutex);
+                local.swap(queue);
+            }
+
+            if (local.empty())
+            {
+                std::this_thread::yield();
+                continue;
+            }
+
+            for (auto& batch : local)
+            {
+                for (void* p : batch)
+                {
+                    release(p);
+                }
+
+                freed += batch.size();
+                inFlight.fetch_sub((int64_t)batch.size(), std::memory_order_relaxed);
+            }
+
+            local.clear();
+        }
+
+        threadExit();
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(producerCount + 1);
+    for (int t = 0; t < producerCount; ++t)
+        threads.emplace_back(producer, t);
+    threads.emplace_back(consumer);
+
+    const auto start = BenchClock::now();
+    go.store(true, std::memory_order_release);
+
+    for (auto& th : threads) th.join();
+
+    const auto end = BenchClock::now();
+
+    std::vector<uint32_t> merged;
+    for (auto& samples : latencies) merged.insert(merged.end(), samples.begin(), samples.end());
+
+    row.MOpsPerSec = (double)total / bench_seconds(start, end) / 1e6;
+    bench_fill_latency(row, merged);
+
+    return ok.load() && freed == total;
+}
+
+bool bench_cross_thread_free()
+{
+    BenchContext ctx;
+
+    const int hw = (int)std::max(1u, std::thread::hardware_concurrency());
+    const int producerCount = std::clamp(hw - 1, 1, 7);
+
+    std::string title = "Cross-thread free (" + std::to_string(producerCount) + " producer(s) -> 1 consumer, 64-256B)";
+    bench_print_header(title.c_str());
+
+    auto noExit = []() {};
+
+    // PoolArena (256B blocks), room for the in-flight cap plus the thread magazines.
+    {
+        const size_t poolBytes = 256 * (size_t)(BENCH_XT_MAX_IN_FLIGHT * 2 + producerCount * BENCH_XT_BATCH * 2);
+        PoolReservation* res = bench_reserve(ctx.Global, "BenchCrossThreadPool", poolBytes);
+        TEST_ASSERT(res != nullptr);
+
+        PoolArena pool;
+        pool.Initialize(&ctx.Global, poolBytes, 256, res, 16);
+
+        BenchRow row{ "PoolArena" };
+        TEST_ASSERT(bench_run_cross_thread(row, producerCount,
+            [&](uint32_t size) { return pool.Alloc(size, 16); },
+            [&](void* p) { pool.Free(p); },
+            [&]() { pool.FlushThreadCache(); }));
+        bench_print_row(row);
+    }
+
+    // malloc/free
+    {
+        BenchRow row{ "malloc" };
+        TEST_ASSERT(bench_run_cross_thread(row, producerCount,
+            [&](uint32_t size) { return std::malloc(size); },
+            [&](void* p) { std::free(p); },
+            noExit));
+        bench_print_row(row);
+    }
+
+    // new/delete
+    {
+        BenchRow row{ "new" };
+        TEST_ASSERT(bench_run_cross_thread(row, producerCount,
+            [&](uint32_t size) { return (void*)new uint8_t[size]; },
+            [&](void* p) { delete[] static_cast<uint8_t*>(p); },
+            noExit));
+        bench_print_row(row);
+    }
+
+    std::cout << "\n";
+    return true;
+}
+
+// -------------------------------------
+// Workload 3: fragmentation churn
+// -------------------------------------
+static constexpr uint32_t BENCH_CHURN_OPS = 400000;
+static constexpr uint32_t BENCH_CHURN_TARGET_LIVE = 4096;
+static constexpr uint32_t BENCH_CHURN_MAX_SIZE = 4096;
+
+struct BenchChurnOp
+{
+    uint32_t Size = 0;      // > 0: allocate Size bytes
+    uint32_t FreeIndex = 0; // Size == 0: free live[FreeIndex] (swap-remove)
+};
+
+// Same op sequence for every allocator: log-uniform sizes 16B-4KB, the live set drifts around BENCH_CHURN_TARGET_LIVE.
+static inline std::vector<BenchChurnOp> bench_make_churn_ops()
+{
+    std::mt19937 rng(4242);
+    std::uniform_real_distribution<double> logSize(std::log2(16.0), std::log2((double)BENCH_CHURN_MAX_SIZE));
+    std::uniform_int_distribution<uint32_t> coin(0, 1);
+
+    std::vector<BenchChurnOp> ops;
+    ops.reserve(BENCH_CHURN_OPS);
+
+    uint32_t live = 0;
+    for (uint32_t i = 0; i < BENCH_CHURN_OPS; ++i)
+    {
+        bool doAlloc;
+        if (live < BENCH_CHURN_TARGET_LIVE / 2) doAlloc = true;
+        else if (live > BENCH_CHURN_TARGET_LIVE * 3 / 2) doAlloc = false;
+        else doAlloc = coin(rng) == 1;
+
+        if (doAlloc)
+        {
+            ops.push_back({ (uint32_t)std::exp2(logSize(rng)), 0 });
+            ++live;
+        }
+        else
+        {
+            ops.push_back({ 0, (uint32_t)(rng() % live) });
+            --live;
+        }
+    }
+
+    return ops;
+}
+
+template<typename AllocFn, typename FreeFn, typename PeakFn>
+static bool bench_run_churn(BenchRow& row, const std::vector<BenchChurnOp>& ops, AllocFn&& alloc, FreeFn&& release, PeakFn&& peak)
+{
+    std::vector<std::pair<void*, uint32_t>> live;
+    live.reserve(BENCH_CHURN_TARGET_LIVE * 2);
+
+    std::vector<uint32_t> latencies;
+    latencies.reserve(ops.size() / BENCH_SAMPLE_EVERY + 1);
+
+    size_t requestedBytes = 0;
+    uint32_t allocCount = 0;
+    bool ok = true;
+
+    const auto start = BenchClock::now();
+
+    for (const BenchChurnOp& op : ops)
+    {
+        if (op.Size == 0)
+        {
+            auto [p, size] = live[op.FreeIndex];
+            if (static_cast<uint8_t*>(p)[size - 1] != (uint8_t)size)
+            {
+                ok = false;
+            }
+
+            release(p);
+            requestedBytes -= size;
+
+            live[op.FreeIndex] = live.back();
+            live.pop_back();
+            continue;
+        }
+
+        uint8_t* p;
+        if ((allocCount++ % BENCH_SAMPLE_EVERY) == 0)
+        {
+            const auto t0 = BenchClock::now();
+            p = static_cast<uint8_t*>(alloc(op.Size));
+            latencies.push_back(bench_elapsed_ns(t0, BenchClock::now()));
+        }
+        else
+        {
+            p = static_cast<uint8_t*>(alloc(op.Size));
+        }
+
+        if (p == nullptr)
+        {
+            ok = false;
+            break;
+        }
+
+        p[op.Size - 1] = (uint8_t)op.Size;
+        live.push_back({ p, op.Size });
+        requestedBytes += op.Size;
+    }
+
+    const auto end = BenchClock::now();
+
+    row.MOpsPerSec = (double)allocCount / bench_seconds(start, end) / 1e6;
+    bench_fill_latency(row, latencies);
+
+    // Measured after the churn, when the live set has been shuffled the most.
+    peak(live.size(), requestedBytes, row);
+
+    for (auto& [p, size] : live)
+    {
+        release(p);
+    }
+
+    return ok;
+}
+
+bool bench_fragmentation_churn()
+{
+    BenchContext ctx;
+
+    const std::vector<BenchChurnOp> ops = bench_make_churn_ops();
+    auto noPeak = [](size_t, size_t, BenchRow&) {};
+
+    bench_print_header("Fragmentation churn (400k random alloc/free, 16B-4KB, ~4096 live)");
+
+    // OffsetArena
+    {
+        const uint32_t heapBytes = 64 * 1024 * 1024;
+        PoolReservation* res = bench_reserve(ctx.Global, "BenchChurnOffset", heapBytes);
+        TEST_ASSERT(res != nullptr);
+
+        OffsetArena offset;
+        offset.Initialize(&ctx.Global, heapBytes, res, BENCH_CHURN_TARGET_LIVE * 4);
+
+        BenchRow row{ "OffsetArena" };
+        TEST_ASSERT(bench_run_churn(row, ops,
+            [&](uint32_t size) { return offset.Alloc(size, 16); },
+            [&](void* p) { offset.Free(p); },
+            [&](size_t, size_t requested, BenchRow& r)
+            {
+                const OffsetArena::StorageReport report = offset.GetStorageReport();
+                r.Overhead = bench_overhead(requested, offset.HeapSize() - report.totalFree);
+                r.ExtFrag = bench_ext_frag(report.totalFree, report.largestFree);
+            }));
+        TEST_ASSERT(offset.Validate());
+        bench_print_row(row);
+    }
+
+    // PoolArena sized for the largest request (the classic fixed-block trade-off).
+    {
+        const size_t poolBytes = BENCH_CHURN_MAX_SIZE * (size_t)BENCH_CHURN_TARGET_LIVE * 2;
+        PoolReservation* res = bench_reserve(ctx.Global, "BenchChurnPool", poolBytes);
+        TEST_ASSERT(res != nullptr);
+
+        PoolArena pool;
+        pool.Initialize(&ctx.Global, poolBytes, BENCH_CHURN_MAX_SIZE, res, 16);
+
+        BenchRow row{ "PoolArena(4KB)" };
+        TEST_ASSERT(bench_run_churn(row, ops,
+            [&](uint32_t size) { return pool.Alloc(size, 16); },
+            [&](void* p) { pool.Free(p); },
+            [&](size_t liveCount, size_t requested, BenchRow& r) { r.Overhead = bench_overhead(requested, liveCount * BENCH_CHURN_MAX_SIZE); }));
+        pool.FlushThreadCache();
+        bench_print_row(row);
+    }
+
+    // malloc/free
+    {
+        BenchRow row{ "malloc" };
+        TEST_ASSERT(bench_run_churn(row, ops,
+            [&](uint32_t size) { return std::malloc(size); },
+            [&](void* p) { std::free(p); },
+            noPeak));
+        bench_print_row(row);
+    }
+
+    // new/delete
+    {
+        BenchRow row{ "new" };
+        TEST_ASSERT(bench_run_churn(row, ops,
+            [&](uint32_t size) { return (void*)new uint8_t[size]; },
+            [&](void* p) { delete[] static_cast<uint8_t*>(p); },
+            noPeak));
+        bench_print_row(row);
+    }
+
+    std::cout << "\n";
+    return true;
+}
+
+// -------------------------------------
+// Workload 4: concurrent Reserve/TryRelease
+// -------------------------------------
+static constexpr uint32_t BENCH_RESERVE_ITERS = 2000;
+static constexpr uint32_t BENCH_RESERVE_RING = 8;
+
+bool bench_concurrent_reserve_release()
+{
+    BenchContext ctx;
+
+    const int threadCount = (int)std::clamp(std::thread::hardware_concurrency(), 1u, 8u);
+
+    std::string title = "Concurrent MainArena::Reserve/TryRelease (" + std::to_string(threadCount) + " thread(s), 64KB-2MB, 8 live per thread)";
+    bench_print_header(title.c_str());
+
+    // Each thread keeps a ring of live reservations and releases the oldest one, so the DATA heap sees interleaved holes.
+    // The rings stay live after the timed section, so the main thread can report fragmentation before releasing them.
+    auto run = [&](BenchRow& row, auto&& reserve, auto&& release, std::vector<std::vector<std::pair<void*, size_t>>>& rings) -> bool
+    {
+        std::atomic<bool> ok{ true };
+        std::atomic<bool> go{ false };
+
+        std::vector<std::vector<uint32_t>> latencies(threadCount);
+        rings.assign(threadCount, {});
+
+        auto worker = [&](int tid)
+        {
+            std::mt19937 rng(77 + tid);
+            std::uniform_int_distribution<size_t> sizeDist(64 * 1024, 2 * 1024 * 1024);
+
+            auto& ring = rings[tid];
+            auto& samples = latencies[tid];
+            ring.reserve(BENCH_RESERVE_RING);
+            samples.reserve(BENCH_RESERVE_ITERS);
+
+            while (!go.load(std::memory_order_acquire)) {}
+
+            for (uint32_t i = 0; i < BENCH_RESERVE_ITERS; ++i)
+            {
+                if (ring.size() == BENCH_RESERVE_RING)
+                {
+                    release(ring.front().first);
+                    ring.erase(ring.begin());
+                }
+
+                const size_t size = sizeDist(rng);
+
+                const auto t0 = BenchClock::now();
+                void* r = reserve(size);
+                samples.push_back(bench_elapsed_ns(t0, BenchClock::now()));
+
+                if (r == nullptr)
+                {
+                    ok.store(false, std::memory_order_relaxed);
+                    return;
+                }
+
+                ring.push_back({ r, size });
+            }
+        };
+
+        std::vector<std::thread> threads;
+        threads.reserve(threadCount);
+        for (int t = 0; t < threadCount; ++t)
+            threads.emplace_back(worker, t);
+
+        const auto start = BenchClock::now();
+        go.store(true, std::memory_order_release);
+
+        for (auto& th : threads) th.join();
+
+        const auto end = BenchClock::now();
+
+        std::vector<uint32_t> merged;
+        for (auto& samples : latencies) merged.insert(merged.end(), samples.begin(), samples.end());
+
+        row.MOpsPerSec = (double)threadCount * BENCH_RESERVE_ITERS / bench_seconds(start, end) / 1e6;
+        bench_fill_latency(row, merged);
+
+        return ok.load();
+    };
+
+    std::vector<std::vector<std::pair<void*, size_t>>> rings;
+
+    // MainArena
+    {
+        BenchRow row{ "MainArena" };
+        const bool ok = run(row,
+            [&](size_t size) -> void* { return ctx.Global.Reserve("BenchReserve", size); },
+            [&](void* r) { ctx.Global.TryRelease(static_cast<PoolReservation*>(r)); },
+            rings);
+
+        size_t requested = 0;
+        size_t consumed = 0;
+        for (auto& ring : rings)
+        {
+            for (auto& [r, size] : ring)
+            {
+                requested += size;
+                consumed += static_cast<PoolReservation*>(r)->Size;
+            }
+        }
+
+        const StorageReport report = ctx.Global.GetStorageReport();
+        row.Overhead = bench_overhead(requested, consumed);
+        row.ExtFrag = bench_ext_frag(report.totalFreeSpace, report.largestFreeRegion);
+
+        for (auto& ring : rings)
+            for (auto& [r, size] : ring)
+                ctx.Global.TryRelease(static_cast<PoolReservation*>(r));
+
+        TEST_ASSERT(ok);
+        bench_print_row(row);
+    }
+
+    // malloc/free of the same sizes
+    {
+        BenchRow row{ "malloc" };
+        const bool ok = run(row,
+            [&](size_t size) -> void* { return std::malloc(size); },
+            [&](void* p) { std::free(p); },
+            rings);
+
+        for (auto& ring : rings)
+            for (auto& [p, size] : ring)
+                std::free(p);
+
+        TEST_ASSERT(ok);
+        bench_print_row(row);
+    }
+
+    std::cout << "\n";
+    return true;
+}
+
+// -------------------------------------
+// Runner
+// -------------------------------------
+inline int BenchmarkAllocators()
+{
+    std::cout << "Running Allocator Benchmarks (Arena, ScratchArena, PoolArena, OffsetArena, MainArena vs malloc/new)\n" << std::endl;
+
+    RUN_TEST(bench_frame_bump_and_reset);
+    RUN_TEST(bench_cross_thread_free);
+    RUN_TEST(bench_fragmentation_churn);
+    RUN_TEST(bench_concurrent_reserve_release);
+
+    std::cout << "\nAll benchmarks finished!" << std::endl;
+    return 0;
+}
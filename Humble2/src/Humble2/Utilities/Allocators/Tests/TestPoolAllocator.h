@@ -14,6 +14,7 @@
 //  - Multi-thread smoke test (MPMC), including cross-thread frees
 //  - Strict error cases: oversize request, too-large alignment
 //  - Stress test with random alloc/free within block constraints
+//  - Multi-thread throughput benchmark (thread magazine caches vs. shared free list contention)
 //
 // IMPORTANT:
 //  - PoolArena is fixed-block: Alloc(size) must be <= blockSize, align <= poolBlockAlign.
@@ -1003,6 +1004,108 @@ bool test_multithread_exhaust_refill_uniqueness()
     #endif
 }
 
+bool test_multithread_throughput_benchmark()
+{
+    MainArena g;
+    PoolReservation* res = nullptr;
+    PoolArena pool;
+
+    make_arena_and_pool(g, res, pool,
+        128 * 1024 * 1024, 2 * 1024 * 1024,
+        16 * 1024 * 1024, 256);
+
+    constexpr int OPS_PER_THREAD = 1000000;
+    constexpr int BURST = 64; // mimics a worker allocating a batch of tasks and retiring them
+
+    const int hw = (int)std::max(1u, std::thread::hardware_concurrency());
+
+    for (int threadCount = 1; threadCount <= std::min(hw, 16); threadCount *= 2)
+    {
+        std::atomic<bool> ok{ true };
+        std::atomic<int> ready{ 0 };
+        std::atomic<bool> go{ false };
+
+        auto worker = [&](int tid)
+        {
+            try
+            {
+                void* burst[BURST];
+
+                ready.fetch_add(1, std::memory_order_relaxed);
+                while (!go.load(std::memory_order_acquire)) {}
+
+                for (int i = 0; i < OPS_PER_THREAD; i += BURST)
+                {
+                    for (int j = 0; j < BURST; ++j)
+                    {
+                        burst[j] = pool.Alloc(64, 16);
+                        *(int*)burst[j] = tid;
+                    }
+
+                    for (int j = BURST - 1; j >= 0; --j)
+                    {
+                        if (*(int*)burst[j] != tid)
+                        {
+                            ok.store(false, std::memory_order_relaxed);
+                        }
+
+                        pool.Free(burst[j]);
+                    }
+                }
+
+                pool.FlushThreadCache();
+            }
+            catch (...)
+            {
+                ok.store(false, std::memory_order_relaxed);
+            }
+        };
+
+        std::vector<std::thread> threads;
+        threads.reserve(threadCount);
+        for (int t = 0; t < threadCount; ++t)
+            threads.emplace_back(worker, t);
+
+        while (ready.load(std::memory_order_acquire) != threadCount) {}
+
+        auto start = std::chrono::high_resolution_clock::now();
+        go.store(true, std::memory_order_release);
+
+        for (auto& th : threads) th.join();
+
+        auto end = std::chrono::high_resolution_clock::now();
+
+        TEST_ASSERT(ok.load(std::memory_order_acquire));
+
+        const double seconds = std::chrono::duration<double>(end - start).count();
+        const double opsPerSec = (2.0 * OPS_PER_THREAD * threadCount) / std::max(seconds, 1e-9);
+
+        std::cout << "\n  " << threadCount << " thread(s): " << (opsPerSec / 1e6) << " M alloc+free ops/s";
+    }
+
+    // No block lost in a magazine: the whole pool must still be allocatable.
+    std::vector<void*> all;
+    all.reserve(pool.BlockCount());
+    for (uint32_t i = 0; i < pool.BlockCount(); ++i)
+        all.push_back(pool.Alloc(64, 16));
+
+    bool threw = false;
+    try
+    {
+        (void)pool.Alloc(64, 16);
+    }
+    catch (const std::bad_alloc&)
+    {
+        threw = true;
+    }
+    TEST_ASSERT(threw);
+
+    for (void* p : all)
+        pool.Free(p);
+
+    return true;
+}
+
 // -------------------------------------
 // Runner
 // -------------------------------------
@@ -1021,6 +1124,7 @@ inline int TestPoolArena_GlobalArena()
     RUN_TEST(test_multithread_ownership_bitmap_stress);
     RUN_TEST(test_multithread_exhaust_refill_uniqueness);
     RUN_TEST(test_performance_sanity);
+    RUN_TEST(test_multithread_throughput_benchmark);
 
     std::cout << "\nAll tests passed!" << std::endl;
     return 0;
@@ -3,33 +3,68 @@
 #include "Base.h"
 #include "Utilities/Allocators/Arena.h"
 
+#include <bit>
 #include <cstdint>
 #include <cstring>
 #include <utility>
 #include <type_traits>
 #include <functional>
+#include <string>
+#include <string_view>
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define HBL2_HASHMAP_SSE2 1
+#else
+    #define HBL2_HASHMAP_SSE2 0
+#endif
 
 namespace HBL2
 {
     template<typename K>
     struct Hash { size_t operator()(const K& inKey) const { return std::hash<K>{}(inKey); } };
 
-    /// Fixed-capacity hash map backed by an arena.
-    /// Uses open addressing with linear probing and a separate control-byte array (Swiss Table layout).
-    /// Capacity must be a power of 2. Recommended: capacity >= expected_elements * 2.
-    template<typename K, typename V, typename Hasher = Hash<K>>
+    /// Transparent string hash, allows looking up std::string keys with std::string_view or const char* without a temporary string.
+    template<>
+    struct Hash<std::string>
+    {
+        using is_transparent = void;
+
+        size_t operator()(std::string_view inKey) const { return std::hash<std::string_view>{}(inKey); }
+        size_t operator()(const std::string& inKey) const { return std::hash<std::string_view>{}(inKey); }
+        size_t operator()(const char* inKey) const { return std::hash<std::string_view>{}(inKey); }
+    };
+
+    /// Swiss table hash map backed by an arena.
+    ///
+    /// Slots are split in groups of 16 control bytes. A lookup hashes the key once, then matches the 7-bit tag
+    /// of the hash against a whole group at once (a single SSE2 compare), only comparing keys on tag hits.
+    /// The table grows automatically at 87.5% load, the new storage is allocated from the same arena.
+    /// Since arenas never free individual allocations, the old storage is only reclaimed when the arena is reset,
+    /// so size the initial capacity for the expected element count when it is known.
+    /// Tombstones left by removals are cleaned in place, so insert/remove churn never allocates.
+    ///
+    /// Heterogeneous lookup (find/contains/remove with a different key type) is enabled when both the hasher and
+    /// the key equality define is_transparent.
+    template<typename K, typename V, typename Hasher = Hash<K>, typename KeyEqual = std::conditional_t<std::is_same_v<K, std::string>, std::equal_to<>, std::equal_to<K>>>
     class HashMap
     {
     public:
         using key_type = K;
+        using mapped_type = V;
         using value_type = std::pair<const K, V>;
         using size_type = uint32_t;
 
+        static constexpr size_type GroupWidth = 16;
+
     private:
-        // Control byte values (bottom 7 bits store part of the hash — filters false positives before key compare)
-        static constexpr uint8_t cEmpty = 0x00;
-        static constexpr uint8_t cDeleted = 0x7F;
-        static constexpr uint8_t cUsed = 0x80; // bit 7 set = occupied; bits 0-6 = low 7 bits of hash
+        // Control bytes: full slots store the 7-bit tag of the hash (high bit clear), special states have the high bit set.
+        static constexpr uint8_t cEmpty = 0x80;
+        static constexpr uint8_t cDeleted = 0xFE;
+
+        static constexpr bool IsTransparent = requires { typename Hasher::is_transparent; typename KeyEqual::is_transparent; };
+
+        static constexpr bool IsFull(uint8_t inControl) { return (inControl & 0x80) == 0; }
 
         struct alignas(value_type) Storage
         {
@@ -39,6 +74,46 @@ namespace HBL2
         static_assert(sizeof(value_type) == sizeof(Storage));
         static_assert(alignof(value_type) == alignof(Storage));
 
+        /// A group of 16 control bytes, every query returns a bitmask with one bit per matching slot.
+        struct Group
+        {
+#if HBL2_HASHMAP_SSE2
+            explicit Group(const uint8_t* inControl) : m_Control(_mm_load_si128(reinterpret_cast<const __m128i*>(inControl))) {}
+
+            uint32_t Match(uint8_t inTag) const { return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(m_Control, _mm_set1_epi8((char)inTag))); }
+            uint32_t MatchEmpty() const { return Match(cEmpty); }
+            uint32_t MatchEmptyOrDeleted() const { return (uint32_t)_mm_movemask_epi8(m_Control); }
+
+            __m128i m_Control;
+#else
+            explicit Group(const uint8_t* inControl) : m_Control(inControl) {}
+
+            uint32_t Match(uint8_t inTag) const
+            {
+                uint32_t mask = 0;
+                for (size_type i = 0; i < GroupWidth; ++i)
+                {
+                    mask |= uint32_t(m_Control[i] == inTag) << i;
+                }
+                return mask;
+            }
+
+            uint32_t MatchEmpty() const { return Match(cEmpty); }
+
+            uint32_t MatchEmptyOrDeleted() const
+            {
+                uint32_t mask = 0;
+                for (size_type i = 0; i < GroupWidth; ++i)
+                {
+                    mask |= uint32_t(m_Control[i] >> 7) << i;
+                }
+                return mask;
+            }
+
+            const uint8_t* m_Control;
+#endif
+        };
+
         value_type& GetElement(size_type inIdx) { return reinterpret_cast<value_type&>(m_Data[inIdx]); }
         const value_type& GetElement(size_type inIdx) const { return reinterpret_cast<const value_type&>(m_Data[inIdx]); }
 
@@ -64,7 +139,7 @@ namespace HBL2
 
             IteratorBase& operator++()
             {
-                do { ++m_Idx; } while (m_Idx < m_Table->m_Capacity && (m_Table->m_Control[m_Idx] & cUsed) == 0);
+                m_Idx = m_Table->NextFull(m_Idx + 1);
                 return *this;
             }
 
@@ -80,7 +155,7 @@ namespace HBL2
 
             bool operator==(const IteratorBase& inRHS) const { return m_Idx == inRHS.m_Idx && m_Table == inRHS.m_Table; }
             bool operator!=(const IteratorBase& inRHS) const { return !(*this == inRHS); }
-            bool IsValid() const { return m_Table && m_Idx < m_Table->m_Capacity && (m_Table->m_Control[m_Idx] & cUsed); }
+            bool IsValid() const { return m_Table && m_Idx < m_Table->m_Capacity && IsFull(m_Table->m_Control[m_Idx]); }
 
             template<bool> friend class IteratorBase;
             friend class HashMap;
@@ -95,11 +170,17 @@ namespace HBL2
 
         HashMap() = default;
 
+        /// Empty map, the first insert allocates the minimum capacity from the arena.
+        explicit HashMap(Arena* arena)
+            : m_Arena(arena)
+        {
+        }
+
+        /// Capacity is rounded up to a power of 2 (at least GroupWidth). Up to 7/8 of it can be filled before the map grows.
         explicit HashMap(Arena* arena, size_type inCapacity)
             : m_Arena(arena)
         {
-            HBL2_CORE_ASSERT(inCapacity > 0 && (inCapacity & (inCapacity - 1)) == 0, "HashMap capacity must be a power of 2.");
-            Allocate(inCapacity);
+            Allocate(NormalizeCapacity(inCapacity));
         }
 
         HashMap(const HashMap& inRHS)
@@ -115,13 +196,9 @@ namespace HBL2
         }
 
         HashMap(HashMap&& inRHS) noexcept
-            : m_Arena(inRHS.m_Arena), m_Capacity(inRHS.m_Capacity), m_Size(inRHS.m_Size), m_Data(inRHS.m_Data), m_Control(inRHS.m_Control)
+            : m_Arena(inRHS.m_Arena), m_Capacity(inRHS.m_Capacity), m_Size(inRHS.m_Size), m_GrowthLeft(inRHS.m_GrowthLeft), m_Data(inRHS.m_Data), m_Control(inRHS.m_Control)
         {
-            inRHS.m_Arena = nullptr;
-            inRHS.m_Capacity = 0;
-            inRHS.m_Size = 0;
-            inRHS.m_Data = nullptr;
-            inRHS.m_Control = nullptr;
+            inRHS.Release();
         }
 
         ~HashMap() { clear(); }
@@ -141,7 +218,7 @@ namespace HBL2
             {
                 for (size_type i = 0; i < m_Capacity; ++i)
                 {
-                    if (m_Control[i] & cUsed)
+                    if (IsFull(m_Control[i]))
                     {
                         GetElement(i).~value_type();
                     }
@@ -150,6 +227,19 @@ namespace HBL2
 
             std::memset(m_Control, cEmpty, m_Capacity);
             m_Size = 0;
+            m_GrowthLeft = MaxLoad(m_Capacity);
+        }
+
+        /// Make sure inCount elements fit without growing.
+        void reserve(size_type inCount)
+        {
+            if (inCount <= m_Size + m_GrowthLeft)
+            {
+                return;
+            }
+
+            // Smallest power of 2 whose 7/8 load holds inCount.
+            Rehash(NormalizeCapacity(inCount + inCount / 7 + 1));
         }
 
         /// Insert or overwrite. Returns {iterator, true} if inserted, {iterator, false} if already existed.
@@ -186,18 +276,10 @@ namespace HBL2
         }
 
         /// Remove by key. Returns true if the key was found and removed.
-        bool remove(const K& inKey)
-        {
-            size_type idx = ProbeFind(inKey);
-            if (idx == cInvalid)
-            {
-                return false;
-            }
+        bool remove(const K& inKey) { return RemoveImpl(inKey); }
 
-            EraseAt(idx);
-
-            return true;
-        }
+        template<typename Q> requires IsTransparent
+        bool remove(const Q& inKey) { return RemoveImpl(inKey); }
 
         void erase(const_iterator inIter)
         {
@@ -217,8 +299,25 @@ namespace HBL2
             return idx != cInvalid ? const_iterator(this, idx) : end();
         }
 
+        template<typename Q> requires IsTransparent
+        iterator find(const Q& inKey)
+        {
+            size_type idx = ProbeFind(inKey);
+            return idx != cInvalid ? iterator(this, idx) : end();
+        }
+
+        template<typename Q> requires IsTransparent
+        const_iterator find(const Q& inKey) const
+        {
+            size_type idx = ProbeFind(inKey);
+            return idx != cInvalid ? const_iterator(this, idx) : end();
+        }
+
         bool contains(const K& inKey) const { return ProbeFind(inKey) != cInvalid; }
 
+        template<typename Q> requires IsTransparent
+        bool contains(const Q& inKey) const { return ProbeFind(inKey) != cInvalid; }
+
         /// Returns value for key, default-constructing it if absent.
         V& operator[](const K& inKey)
         {
@@ -231,20 +330,9 @@ namespace HBL2
             return GetElement(idx).second;
         }
 
-        iterator begin()
-        {
-            size_type i = 0;
-            while (i < m_Capacity && (m_Control[i] & cUsed) == 0) ++i;
-            return iterator(this, i);
-        }
-
+        iterator begin() { return iterator(this, NextFull(0)); }
         iterator end() { return iterator(this, m_Capacity); }
-        const_iterator begin() const
-        {
-            size_type i = 0;
-            while (i < m_Capacity && (m_Control[i] & cUsed) == 0) ++i;
-            return const_iterator(this, i);
-        }
+        const_iterator begin() const { return const_iterator(this, NextFull(0)); }
         const_iterator end() const { return const_iterator(this, m_Capacity); }
         const_iterator cbegin() const { return begin(); }
         const_iterator cend() const { return end(); }
@@ -263,8 +351,6 @@ namespace HBL2
             {
                 if (m_Capacity != inRHS.m_Capacity)
                 {
-                    m_Data = nullptr;
-                    m_Control = nullptr;
                     Allocate(inRHS.m_Capacity);
                 }
 
@@ -286,13 +372,10 @@ namespace HBL2
             m_Arena = inRHS.m_Arena;
             m_Capacity = inRHS.m_Capacity;
             m_Size = inRHS.m_Size;
+            m_GrowthLeft = inRHS.m_GrowthLeft;
             m_Data = inRHS.m_Data;
             m_Control = inRHS.m_Control;
-            inRHS.m_Arena = nullptr;
-            inRHS.m_Capacity = 0;
-            inRHS.m_Size = 0;
-            inRHS.m_Data = nullptr;
-            inRHS.m_Control = nullptr;
+            inRHS.Release();
 
             return *this;
         }
@@ -300,129 +383,305 @@ namespace HBL2
     private:
         static constexpr size_type cInvalid = ~size_type(0);
 
-        /// Split hash: high bits → bucket index, low 7 bits → control tag
-        void HashToIndexAndControl(const K& inKey, size_type& outIdx, uint8_t& outControl) const
+        static constexpr size_type MaxLoad(size_type inCapacity) { return inCapacity - inCapacity / 8; }
+
+        static size_type NormalizeCapacity(size_type inCapacity)
+        {
+            return std::bit_ceil(inCapacity < GroupWidth ? GroupWidth : inCapacity);
+        }
+
+        /// Finalizer of MurmurHash3, std::hash is the identity for integers (UUIDs), so mix before splitting the hash.
+        static uint64_t Mix(uint64_t h)
         {
-            size_t h = Hasher{}(inKey);
-            outIdx = size_type((h >> 7) & (m_Capacity - 1)); // power-of-2 bitmask
-            outControl = cUsed | uint8_t(h & 0x7F);
+            h ^= h >> 33;
+            h *= 0xFF51AFD7ED558CCDull;
+            h ^= h >> 33;
+            h *= 0xC4CEB9FE1A85EC53ull;
+            h ^= h >> 33;
+            return h;
         }
 
+        /// Split hash: high bits → starting group (H1), low 7 bits → control tag (H2)
+        template<typename Q>
+        static uint64_t HashOf(const Q& inKey) { return Mix((uint64_t)Hasher{}(inKey)); }
+
+        static uint8_t H2(uint64_t inHash) { return uint8_t(inHash & 0x7F); }
+
+        size_type GroupMask() const { return m_Capacity / GroupWidth - 1; }
+        size_type FirstGroup(uint64_t inHash) const { return size_type(inHash >> 7) & GroupMask(); }
+
         /// Find an occupied slot by key. Returns cInvalid if not found.
-        size_type ProbeFind(const K& inKey) const
+        template<typename Q>
+        size_type ProbeFind(const Q& inKey) const
         {
-            if (!m_Data || m_Capacity == 0)
+            if (m_Size == 0)
             {
                 return cInvalid;
             }
 
-            size_type idx;
-            uint8_t ctrl;
-            HashToIndexAndControl(inKey, idx, ctrl);
+            const uint64_t hash = HashOf(inKey);
+            const uint8_t tag = H2(hash);
+            const size_type mask = GroupMask();
 
-            const size_type mask = m_Capacity - 1;
-            for (size_type i = 0; i < m_Capacity; ++i)
+            // Triangular probing over a power-of-2 number of groups visits every group exactly once.
+            size_type group = FirstGroup(hash);
+            for (size_type step = 1; step <= mask + 1; ++step)
             {
-                const uint8_t c = m_Control[idx];
-                if (c == cEmpty)
+                const Group g(m_Control + group * GroupWidth);
+
+                for (uint32_t match = g.Match(tag); match != 0; match &= match - 1)
                 {
-                    return cInvalid;   // true gap, key cannot be beyond this
+                    const size_type idx = group * GroupWidth + (size_type)std::countr_zero(match);
+                    if (KeyEqual{}(GetElement(idx).first, inKey))
+                    {
+                        return idx;
+                    }
                 }
 
-                if (c == ctrl && GetElement(idx).first == inKey)
+                if (g.MatchEmpty() != 0)
                 {
-                    return idx;
+                    return cInvalid;   // true gap, key cannot be beyond this group
                 }
 
-                idx = (idx + 1) & mask;
+                group = (group + step) & mask;
             }
 
             return cInvalid;
         }
 
+        /// First empty or deleted slot on the probe sequence of inHash.
+        size_type FindInsertSlot(uint64_t inHash) const
+        {
+            const size_type mask = GroupMask();
+
+            size_type group = FirstGroup(inHash);
+            for (size_type step = 1; ; ++step)
+            {
+                const uint32_t available = Group(m_Control + group * GroupWidth).MatchEmptyOrDeleted();
+                if (available != 0)
+                {
+                    return group * GroupWidth + (size_type)std::countr_zero(available);
+                }
+
+                group = (group + step) & mask;
+            }
+        }
+
         /// Find existing key or allocate a new slot. Returns {index, wasInserted}.
         std::pair<size_type, bool> FindOrAllocate(const K& inKey)
         {
-            HBL2_CORE_ASSERT(m_Data && m_Capacity > 0, "HashMap used before construction.");
-            HBL2_CORE_ASSERT(m_Size * 8 < m_Capacity * 7, "HashMap load factor exceeded 87.5% — increase capacity.");
-
-            size_type idx;
-            uint8_t ctrl;
-            HashToIndexAndControl(inKey, idx, ctrl);
+            const size_type existing = ProbeFind(inKey);
+            if (existing != cInvalid)
+            {
+                return { existing, false };  // already exists
+            }
 
-            const size_type mask = m_Capacity - 1;
-            size_type firstTombstone = cInvalid;
+            const uint64_t hash = HashOf(inKey);
+            size_type idx = m_Control ? FindInsertSlot(hash) : cInvalid;
 
-            for (size_type i = 0; i < m_Capacity; ++i)
+            // Reusing a tombstone never costs growth, only consuming an empty slot does.
+            if (idx == cInvalid || (m_GrowthLeft == 0 && m_Control[idx] == cEmpty))
             {
-                const uint8_t c = m_Control[idx];
-                if (c == cEmpty)
+                // Out of growth mostly because of tombstones: drop them in place, otherwise double.
+                if (m_Capacity != 0 && uint64_t(m_Size) * 32 <= uint64_t(m_Capacity) * 25)
                 {
-                    // Reuse tombstone if we passed one; it sits earlier in the probe chain
-                    size_type dst = (firstTombstone != cInvalid) ? firstTombstone : idx;
-                    m_Control[dst] = ctrl;
-                    ++m_Size;
-                    return { dst, true };
+                    DropDeletes();
                 }
-
-                if (c == cDeleted && firstTombstone == cInvalid)
+                else
                 {
-                    firstTombstone = idx;
+                    Rehash(m_Capacity == 0 ? GroupWidth : m_Capacity * 2);
                 }
 
-                if (c == ctrl && GetElement(idx).first == inKey)
-                {
-                    return { idx, false };  // already exists
-                }
+                idx = FindInsertSlot(hash);
+            }
 
-                idx = (idx + 1) & mask;
+            if (m_Control[idx] == cEmpty)
+            {
+                --m_GrowthLeft;
+            }
+
+            m_Control[idx] = H2(hash);
+            ++m_Size;
+
+            return { idx, true };
+        }
+
+        template<typename Q>
+        bool RemoveImpl(const Q& inKey)
+        {
+            size_type idx = ProbeFind(inKey);
+            if (idx == cInvalid)
+            {
+                return false;
             }
 
-            // Should never reach here if load-factor assert above is respected
-            HBL2_CORE_ASSERT(false, "HashMap is full.");
-            return { cInvalid, false };
+            EraseAt(idx);
+
+            return true;
         }
 
         void EraseAt(size_type inIdx)
         {
-            HBL2_CORE_ASSERT(m_Control[inIdx] & cUsed, "");
+            HBL2_CORE_ASSERT(IsFull(m_Control[inIdx]), "");
             GetElement(inIdx).~value_type();
 
-            // Mark as deleted (tombstone) unless the next slot is empty — then we can
-            // mark it empty too, shrinking the probe chain.
-            const size_type next = (inIdx + 1) & (m_Capacity - 1);
-            m_Control[inIdx] = (m_Control[next] == cEmpty) ? cEmpty : cDeleted;
+            // A group with an empty slot has never overflowed, so no probe chain goes through it and
+            // the slot can become empty again. Otherwise leave a tombstone so later lookups keep probing.
+            const size_type group = inIdx & ~(GroupWidth - 1);
+            if (Group(m_Control + group).MatchEmpty() != 0)
+            {
+                m_Control[inIdx] = cEmpty;
+                ++m_GrowthLeft;
+            }
+            else
+            {
+                m_Control[inIdx] = cDeleted;
+            }
+
             --m_Size;
         }
 
+        size_type NextFull(size_type inIdx) const
+        {
+            while (inIdx < m_Capacity && !IsFull(m_Control[inIdx])) ++inIdx;
+            return inIdx;
+        }
+
         void Allocate(size_type inCapacity)
         {
-            HBL2_CORE_ASSERT(m_Arena, "");
+            HBL2_CORE_ASSERT(m_Arena, "HashMap has no arena to allocate from.");
+            HBL2_CORE_ASSERT(inCapacity >= GroupWidth && (inCapacity & (inCapacity - 1)) == 0, "HashMap capacity must be a power of 2.");
+
             m_Capacity = inCapacity;
-            // Pack data + control into one allocation. Data first (aligned), control bytes after.
-            m_Data = static_cast<Storage*>(m_Arena->Alloc(sizeof(Storage) * inCapacity + inCapacity));
-            m_Control = reinterpret_cast<uint8_t*>(m_Data + inCapacity);
+            m_Size = 0;
+            m_GrowthLeft = MaxLoad(inCapacity);
+
+            // Pack control + data into one allocation. Control bytes first (16 byte aligned for the group loads), then the slots.
+            constexpr size_t alignment = alignof(Storage) > GroupWidth ? alignof(Storage) : GroupWidth;
+            const size_t controlBytes = (inCapacity + alignment - 1) & ~(alignment - 1);
+
+            m_Control = static_cast<uint8_t*>(m_Arena->Alloc(controlBytes + sizeof(Storage) * inCapacity, alignment));
+            m_Data = reinterpret_cast<Storage*>(m_Control + controlBytes);
             std::memset(m_Control, cEmpty, inCapacity);
         }
 
+        void Rehash(size_type inNewCapacity)
+        {
+            Storage* oldData = m_Data;
+            uint8_t* oldControl = m_Control;
+            const size_type oldCapacity = m_Capacity;
+
+            Allocate(inNewCapacity);
+
+            for (size_type i = 0; i < oldCapacity; ++i)
+            {
+                if (!IsFull(oldControl[i]))
+                {
+                    continue;
+                }
+
+                value_type& element = reinterpret_cast<value_type&>(oldData[i]);
+
+                const uint64_t hash = HashOf(element.first);
+                const size_type idx = FindInsertSlot(hash);
+
+                m_Control[idx] = H2(hash);
+                new (&m_Data[idx]) value_type(std::move(element));
+                element.~value_type();
+
+                ++m_Size;
+                --m_GrowthLeft;
+            }
+        }
+
+        /// Removes every tombstone without touching the arena, by reinserting the elements into the same storage.
+        ///
+        /// Tombstones become empty and full slots become deleted (still holding their element), then each of those is
+        /// moved to the first free slot on its probe sequence. When that slot is in the element's own group it stays put,
+        /// when it is another element still waiting to be placed the two swap and the displaced one is placed next.
+        void DropDeletes()
+        {
+            for (size_type i = 0; i < m_Capacity; ++i)
+            {
+                m_Control[i] = IsFull(m_Control[i]) ? cDeleted : cEmpty;
+            }
+
+            for (size_type i = 0; i < m_Capacity; ++i)
+            {
+                if (m_Control[i] != cDeleted)
+                {
+                    continue;
+                }
+
+                value_type& element = GetElement(i);
+
+                const uint64_t hash = HashOf(element.first);
+                const size_type target = FindInsertSlot(hash);
+
+                if (target / GroupWidth == i / GroupWidth)
+                {
+                    m_Control[i] = H2(hash);
+                    continue;
+                }
+
+                if (m_Control[target] == cEmpty)
+                {
+                    new (&m_Data[target]) value_type(std::move(element));
+                    element.~value_type();
+
+                    m_Control[target] = H2(hash);
+                    m_Control[i] = cEmpty;
+                    continue;
+                }
+
+                // The target holds an element that was not placed yet, swap and place that one from this slot.
+                Storage temp;
+                value_type& other = GetElement(target);
+
+                new (&temp) value_type(std::move(other));
+                other.~value_type();
+                new (&m_Data[target]) value_type(std::move(element));
+                element.~value_type();
+                new (&m_Data[i]) value_type(std::move(reinterpret_cast<value_type&>(temp)));
+                reinterpret_cast<value_type&>(temp).~value_type();
+
+                m_Control[target] = H2(hash);
+                --i;
+            }
+
+            m_GrowthLeft = MaxLoad(m_Capacity) - m_Size;
+        }
+
         void CopyFrom(const HashMap& inRHS)
         {
             std::memcpy(m_Control, inRHS.m_Control, m_Capacity);
             for (size_type i = 0; i < m_Capacity; ++i)
             {
-                if (m_Control[i] & cUsed)
+                if (IsFull(m_Control[i]))
                 {
                     new (&m_Data[i]) value_type(inRHS.GetElement(i));
                 }
             }
 
             m_Size = inRHS.m_Size;
+            m_GrowthLeft = inRHS.m_GrowthLeft;
+        }
+
+        void Release()
+        {
+            m_Arena = nullptr;
+            m_Capacity = 0;
+            m_Size = 0;
+            m_GrowthLeft = 0;
+            m_Data = nullptr;
+            m_Control = nullptr;
         }
 
         Arena* m_Arena = nullptr;
         size_type  m_Capacity = 0;
         size_type  m_Size = 0;
+        size_type  m_GrowthLeft = 0;
         Storage* m_Data = nullptr;
         uint8_t* m_Control = nullptr;
     };
-}
\ No newline at end of file
+}
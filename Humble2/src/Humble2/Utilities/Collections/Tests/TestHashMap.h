@@ -0,0 +1,376 @@
+#pragma once
+
+// HashMap_Tests.cpp
+//
+// Correctness tests and a lookup benchmark for HashMap (arena-backed Swiss table).
+// Style matches the allocator tests: simple macros, bool tests, RUN_TEST runner.
+//
+// Focus:
+//  - Basic insert/find/remove/overwrite
+//  - Growth from the minimum capacity (every key must survive rehashes)
+//  - Tombstone churn (insert/remove cycles must not grow unbounded, nor allocate from the arena)
+//  - Heterogeneous lookup (std::string keys looked up with std::string_view / const char*)
+//  - Non-trivial values are constructed/destructed exactly once
+//  - Benchmark vs std::unordered_map with UUID keys (Scene::m_EntityMap workload)
+//
+
+#include "Utilities/Allocators/MainArena.h"
+#include "Utilities/Allocators/Arena.h"
+#include "Utilities/Collections/HashMap.h"
+
+#include <vector>
+#include <random>
+#include <chrono>
+#include <iostream>
+#include <unordered_map>
+#include <string>
+#include <string_view>
+#include <cstdint>
+
+using namespace HBL2;
+
+// ----------------------------
+// Test framework macros
+// ----------------------------
+#define TEST_ASSERT(condition) \
+    do { \
+        if (!(condition)) { \
+            std::cout << "FAILED: " << #condition << " at line " << __LINE__ << std::endl; \
+            return false; \
+        } \
+    } while(0)
+
+#define RUN_TEST(test_func) \
+    do { \
+        std::cout << "Running " << #test_func << "... "; \
+        if (test_func()) { \
+            std::cout << "PASSED" << std::endl; \
+        } else { \
+            std::cout << "FAILED" << std::endl; \
+            return 1; \
+        } \
+    } while(0)
+
+struct HashMapTestContext
+{
+    MainArena Global;
+    PoolReservation* Reservation = nullptr;
+    Arena MapArena;
+
+    HashMapTestContext(size_t arenaBytes = 64 * 1024 * 1024)
+    {
+        Global.Initialize(arenaBytes * 2, 16 * 1024 * 1024);
+        Reservation = Global.Reserve("HashMapTests", arenaBytes);
+        MapArena.Initialize(&Global, arenaBytes, Reservation);
+    }
+};
+
+struct LifetimeCounter
+{
+    static inline int Alive = 0;
+
+    int Value = 0;
+
+    LifetimeCounter() { ++Alive; }
+    LifetimeCounter(int value) : Value(value) { ++Alive; }
+    LifetimeCounter(const LifetimeCounter& other) : Value(other.Value) { ++Alive; }
+    LifetimeCounter(LifetimeCounter&& other) noexcept : Value(other.Value) { ++Alive; }
+    LifetimeCounter& operator=(const LifetimeCounter& other) { Value = other.Value; return *this; }
+    ~LifetimeCounter() { --Alive; }
+};
+
+// -------------------------------------
+// Tests
+// -------------------------------------
+
+bool test_hashmap_basic_insert_find_remove()
+{
+    HashMapTestContext ctx;
+    HashMap<UUID, uint32_t> map(&ctx.MapArena, 64);
+
+    TEST_ASSERT(map.empty());
+    TEST_ASSERT(map.find(42) == map.end());
+
+    auto [it, inserted] = map.insert(42, 1);
+    TEST_ASSERT(inserted);
+    TEST_ASSERT(it->first == 42 && it->second == 1);
+
+    auto [it2, inserted2] = map.insert(42, 2);
+    TEST_ASSERT(!inserted2);
+    TEST_ASSERT(it2->second == 2);
+    TEST_ASSERT(map.size() == 1);
+
+    map[7] = 70;
+    TEST_ASSERT(map.contains(7));
+    TEST_ASSERT(map.find(7)->second == 70);
+
+    TEST_ASSERT(map.remove(42));
+    TEST_ASSERT(!map.remove(42));
+    TEST_ASSERT(!map.contains(42));
+    TEST_ASSERT(map.size() == 1);
+
+    map.erase(map.find(7));
+    TEST_ASSERT(map.empty());
+    TEST_ASSERT(map.begin() == map.end());
+
+    return true;
+}
+
+bool test_hashmap_growth_keeps_all_keys()
+{
+    HashMapTestContext ctx;
+    HashMap<UUID, uint64_t> map(&ctx.MapArena);
+
+    constexpr uint32_t N = 100000;
+
+    std::mt19937_64 rng(1234);
+    std::vector<UUID> keys(N);
+    for (uint32_t i = 0; i < N; ++i)
+    {
+        keys[i] = rng();
+        map[keys[i]] = (uint64_t)i;
+    }
+
+    TEST_ASSERT(map.size() == N);
+    TEST_ASSERT(map.capacity() >= N);
+
+    for (uint32_t i = 0; i < N; ++i)
+    {
+        auto it = map.find(keys[i]);
+        TEST_ASSERT(it != map.end());
+        TEST_ASSERT(it->second == (uint64_t)i);
+    }
+
+    uint32_t iterated = 0;
+    for (auto& [key, value] : map)
+    {
+        TEST_ASSERT(keys[value] == key);
+        ++iterated;
+    }
+    TEST_ASSERT(iterated == N);
+
+    // Sequential keys hash to the identity with std::hash, the table must still spread them.
+    HashMap<UUID, uint32_t> sequential(&ctx.MapArena, 16);
+    for (uint32_t i = 0; i < 50000; ++i)
+    {
+        sequential.insert((UUID)i << 32, i);
+    }
+    for (uint32_t i = 0; i < 50000; ++i)
+    {
+        TEST_ASSERT(sequential.contains((UUID)i << 32));
+    }
+
+    return true;
+}
+
+bool test_hashmap_tombstone_churn()
+{
+    HashMapTestContext ctx;
+    HashMap<UUID, uint32_t> map(&ctx.MapArena, 1024);
+
+    std::mt19937_64 rng(99);
+    std::vector<UUID> live;
+
+    for (int round = 0; round < 200; ++round)
+    {
+        for (int i = 0; i < 500; ++i)
+        {
+            UUID key = rng();
+            map.insert(key, (uint32_t)i);
+            live.push_back(key);
+        }
+
+        for (UUID key : live)
+        {
+            TEST_ASSERT(map.remove(key));
+        }
+
+        live.clear();
+        TEST_ASSERT(map.empty());
+    }
+
+    // 500 live keys never need more than 1024 slots, rehashes must have cleaned tombstones instead of growing.
+    TEST_ASSERT(map.capacity() == 1024);
+
+    return true;
+}
+
+bool test_hashmap_churn_arena_bounded()
+{
+    HashMapTestContext ctx;
+    HashMap<UUID, uint32_t> map(&ctx.MapArena, 1024);
+
+    std::mt19937_64 rng(7);
+    std::vector<UUID> live(800);
+
+    for (uint32_t i = 0; i < (uint32_t)live.size(); ++i)
+    {
+        live[i] = rng();
+        map.insert(live[i], i);
+    }
+
+    const size_t usedBefore = ctx.MapArena.Mark().UsedInLast;
+
+    // Steady state churn at ~78% load: every remove leaves a tombstone sooner or later, so the same size rehash runs often.
+    for (uint32_t op = 0; op < 1000000; ++op)
+    {
+        const uint32_t victim = (uint32_t)(rng() % live.size());
+        TEST_ASSERT(map.remove(live[victim]));
+
+        live[victim] = rng();
+        map.insert(live[victim], victim);
+    }
+
+    TEST_ASSERT(ctx.MapArena.Mark().UsedInLast == usedBefore);
+    TEST_ASSERT(map.capacity() == 1024);
+    TEST_ASSERT(map.size() == (uint32_t)live.size());
+
+    for (uint32_t i = 0; i < (uint32_t)live.size(); ++i)
+    {
+        auto it = map.find(live[i]);
+        TEST_ASSERT(it != map.end());
+        TEST_ASSERT(it->second == i);
+    }
+
+    return true;
+}
+
+bool test_hashmap_heterogeneous_lookup()
+{
+    HashMapTestContext ctx;
+    HashMap<std::string, uint32_t> map(&ctx.MapArena, 16);
+
+    map.insert("Player", 1);
+    map.insert("Camera", 2);
+    map.insert(std::string(64, 'x'), 3);
+
+    std::string_view view = "Camera";
+    TEST_ASSERT(map.contains(view));
+    TEST_ASSERT(map.find(view)->second == 2);
+    TEST_ASSERT(map.find("Player")->second == 1);
+    TEST_ASSERT(map.contains(std::string_view(std::string(64, 'x'))));
+    TEST_ASSERT(!map.contains(std::string_view("Light")));
+
+    TEST_ASSERT(map.remove(std::string_view("Player")));
+    TEST_ASSERT(!map.contains("Player"));
+    TEST_ASSERT(map.size() == 2);
+
+    return true;
+}
+
+bool test_hashmap_value_lifetimes()
+{
+    LifetimeCounter::Alive = 0;
+
+    {
+        HashMapTestContext ctx;
+        HashMap<UUID, LifetimeCounter> map(&ctx.MapArena);
+
+        for (int i = 0; i < 1000; ++i)
+        {
+            map.emplace((UUID)i, i);
+        }
+        TEST_ASSERT(LifetimeCounter::Alive == 1000);
+
+        for (int i = 0; i < 1000; i += 2)
+        {
+            map.remove((UUID)i);
+        }
+        TEST_ASSERT(LifetimeCounter::Alive == 500);
+
+        HashMap<UUID, LifetimeCounter> copy = map;
+        TEST_ASSERT(LifetimeCounter::Alive == 1000);
+        TEST_ASSERT(copy.find(1)->second.Value == 1);
+
+        HashMap<UUID, LifetimeCounter> moved = std::move(copy);
+        TEST_ASSERT(LifetimeCounter::Alive == 1000);
+        TEST_ASSERT(copy.empty());
+        TEST_ASSERT(moved.size() == 500);
+
+        moved.clear();
+        TEST_ASSERT(LifetimeCounter::Alive == 500);
+    }
+
+    TEST_ASSERT(LifetimeCounter::Alive == 0);
+
+    return true;
+}
+
+bool test_hashmap_benchmark_vs_unordered_map()
+{
+    HashMapTestContext ctx(256 * 1024 * 1024);
+
+    constexpr uint32_t N = 200000;
+    constexpr uint32_t LOOKUPS = 2000000;
+
+    std::mt19937_64 rng(0xC0FFEE);
+    std::vector<UUID> keys(N);
+    for (auto& key : keys) key = rng();
+
+    std::vector<UUID> misses(N);
+    for (auto& key : misses) key = rng();
+
+    std::vector<uint32_t> order(LOOKUPS);
+    for (auto& index : order) index = (uint32_t)(rng() % N);
+
+    using Clock = std::chrono::high_resolution_clock;
+    auto ms = [](Clock::time_point a, Clock::time_point b) { return std::chrono::duration<double, std::milli>(b - a).count(); };
+
+    // HashMap
+    HashMap<UUID, uint32_t> map(&ctx.MapArena, 16);
+
+    auto t0 = Clock::now();
+    for (uint32_t i = 0; i < N; ++i) map.insert(keys[i], i);
+    auto t1 = Clock::now();
+
+    uint64_t checksum = 0;
+    for (uint32_t i = 0; i < LOOKUPS; ++i) checksum += map.find(keys[order[i]])->second;
+    auto t2 = Clock::now();
+
+    uint32_t found = 0;
+    for (uint32_t i = 0; i < N; ++i) found += map.contains(misses[i]) ? 1 : 0;
+    auto t3 = Clock::now();
+
+    // std::unordered_map
+    std::unordered_map<UUID, uint32_t> stdMap;
+
+    auto s0 = Clock::now();
+    for (uint32_t i = 0; i < N; ++i) stdMap.emplace(keys[i], i);
+    auto s1 = Clock::now();
+
+    uint64_t stdChecksum = 0;
+    for (uint32_t i = 0; i < LOOKUPS; ++i) stdChecksum += stdMap.find(keys[order[i]])->second;
+    auto s2 = Clock::now();
+
+    uint32_t stdFound = 0;
+    for (uint32_t i = 0; i < N; ++i) stdFound += stdMap.contains(misses[i]) ? 1 : 0;
+    auto s3 = Clock::now();
+
+    TEST_ASSERT(checksum == stdChecksum);
+    TEST_ASSERT(found == stdFound);
+
+    std::cout << "\n  " << N << " UUID keys, " << LOOKUPS << " hits, " << N << " misses";
+    std::cout << "\n  HashMap:            insert " << ms(t0, t1) << " ms, hit " << ms(t1, t2) << " ms, miss " << ms(t2, t3) << " ms";
+    std::cout << "\n  std::unordered_map: insert " << ms(s0, s1) << " ms, hit " << ms(s1, s2) << " ms, miss " << ms(s2, s3) << " ms\n";
+
+    return true;
+}
+
+// -------------------------------------
+// Runner
+// -------------------------------------
+inline int TestHashMap()
+{
+    std::cout << "Running HashMap (arena-backed Swiss table) Tests\n" << std::endl;
+
+    RUN_TEST(test_hashmap_basic_insert_find_remove);
+    RUN_TEST(test_hashmap_growth_keeps_all_keys);
+    RUN_TEST(test_hashmap_tombstone_churn);
+    RUN_TEST(test_hashmap_churn_arena_bounded);
+    RUN_TEST(test_hashmap_heterogeneous_lookup);
+    RUN_TEST(test_hashmap_value_lifetimes);
+    RUN_TEST(test_hashmap_benchmark_vs_unordered_map);
+
+    std::cout << "\nAll tests passed!" << std::endl;
+    return 0;
+}
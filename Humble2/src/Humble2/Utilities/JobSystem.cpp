@@ -2,6 +2,13 @@
 
 #include "Renderer/Device.h"
 
+#ifdef __linux__
+    #include <pthread.h>
+    #include <sched.h>
+    #include <fstream>
+    #include <filesystem>
+#endif
+
 namespace HBL2
 {
     JobSystem* JobSystem::s_Instance = nullptr;
@@ -55,29 +62,18 @@ namespace HBL2
 
         m_Workers = MakeDArray<std::thread>(m_JobSystemArena, m_NumThreads);
 
+        BuildCoreOrder(spec.AffinityPolicy);
+
         for (uint32_t threadID = 0; threadID < m_NumThreads; ++threadID)
         {
             std::thread& worker = m_Workers.emplace_back([this, threadID] { WorkerThreadFunc(threadID); });
 
-            auto handle = worker.native_handle();
-
-            // Put threads on increasing cores starting from 3rd.
-            int core = threadID + 2;
-#ifdef _WIN32
-            // Put each thread on to dedicated core.
-            DWORD_PTR affinityMask = 1ull << core;
-            DWORD_PTR affinity_result = SetThreadAffinityMask(handle, affinityMask);
-            assert(affinity_result > 0);
-
-            // Set priority to normal.
-            BOOL priority_result = SetThreadPriority(handle, THREAD_PRIORITY_NORMAL);
-            assert(priority_result != 0);
+            // Put threads on increasing cores starting from 3rd, the first two are for the main and render thread.
+            SetThreadAffinity(worker, GetCoreForSlot(threadID + 2));
 
             // Give a name to each thread for easier debugging.
-            std::wstring wthreadname = L"HBL2::Job_" + std::to_wstring(threadID);
-            HRESULT hr = SetThreadDescription(handle, wthreadname.c_str());
-            assert(SUCCEEDED(hr));
-#endif
+            const std::string threadName = "HBL2::Job_" + std::to_string(threadID);
+            SetThreadName(worker, threadName.c_str());
         }
 
         // Set the worker id for the main thread.
@@ -111,6 +107,8 @@ namespace HBL2
 
         auto wrappedJob = [this, job, &ctx]()
         {
+            HBL2_TRACE_ZONE("Job");
+
             Device::Instance->SetContext(ContextType::FETCH);
 
             job();
@@ -140,6 +138,8 @@ namespace HBL2
         {
             auto task = [=, &ctx]()
             {
+                HBL2_TRACE_ZONE("JobGroup");
+
                 if (Device::Instance != nullptr)
                 {
                     Device::Instance->SetContext(ContextType::FETCH);
@@ -165,6 +165,45 @@ namespace HBL2
         m_WakeCondition.notify_all();
     }
 
+    void JobSystem::Spawn(JobContext& ctx, std::function<void()>&& job)
+    {
+        ctx.counter.fetch_add(1, std::memory_order_relaxed);
+
+        // NOTE: Unlike Execute, the worker arena is not reset here, since these jobs can run nested
+        //       inside another job (while waiting) that still holds allocations from the same arena.
+        auto wrappedJob = [job = std::move(job), &ctx]()
+        {
+            HBL2_TRACE_ZONE("ParallelFor");
+
+            if (Device::Instance != nullptr)
+            {
+                Device::Instance->SetContext(ContextType::FETCH);
+            }
+
+            job();
+
+            ctx.counter.fetch_sub(1, std::memory_order_release);
+        };
+
+        // Push to our own queue when called from a worker, so the split halves stay local unless stolen.
+        const uint32_t workerIndex = s_WorkerIndex;
+        const uint32_t threadID = (workerIndex < m_NumThreads) ? workerIndex : m_NextQueue.fetch_add(1, std::memory_order_relaxed) % m_NumThreads;
+        m_LocalJobQueues[threadID].enqueue(std::move(wrappedJob));
+
+        m_WakeCondition.notify_one();
+    }
+
+    uint32_t JobSystem::GetGrainSize(uint32_t count, uint32_t grainSize) const
+    {
+        if (grainSize != 0)
+        {
+            return grainSize;
+        }
+
+        // Aim for a few leaf ranges per thread, enough to balance uneven costs without drowning in tiny jobs.
+        return std::max(1u, count / ((m_NumThreads + 1) * 4));
+    }
+
     bool JobSystem::Busy(const JobContext& ctx)
     {
         return ctx.counter.load(std::memory_order_acquire) > 0;
@@ -174,28 +213,38 @@ namespace HBL2
     {
         if (Busy(ctx))
         {
+            HBL2_TRACE_ZONE("JobSystem::Wait");
+
             // Wake up all worker threads to ensure work is being processed.
             m_WakeCondition.notify_all();
 
             std::function<void()> job;
 
-            // Try to pick up jobs from other threads while waiting.
-            for (uint32_t i = 0; i < m_NumThreads; ++i)
+            // Help with queued jobs until the context is done. Keep looking on every pass, jobs of this context can be
+            // queued after the wait started (split halves of nested ParallelFor calls running on other threads).
+            // Start from this thread's own queue, that is where the jobs it spawned are.
+            const uint32_t workerIndex = s_WorkerIndex;
+            const uint32_t firstQueue = (workerIndex < m_NumThreads) ? workerIndex : 0;
+
+            while (Busy(ctx))
             {
-                while (m_LocalJobQueues[i].try_dequeue(job))
+                bool ranJob = false;
+
+                for (uint32_t i = 0; i < m_NumThreads && !ranJob; ++i)
                 {
-                    job();
+                    if (m_LocalJobQueues[(firstQueue + i) % m_NumThreads].try_dequeue(job))
+                    {
+                        job();
+                        ranJob = true;
+                    }
                 }
-            }
 
-            // This thread did not find any available jobs to pick up.
-            while (Busy(ctx))
-            {
-                // If we are here, then there are still remaining jobs that this thread couldn't pick up.
-                //	In this case those jobs are not standing by on a queue but currently executing
-                //	on other threads, so they cannot be picked up by this thread.
-                //	Allow to swap out this thread by OS to not spin endlessly for nothing.
-                std::this_thread::yield();
+                if (!ranJob)
+                {
+                    // The remaining jobs are executing on other threads, so they cannot be picked up by this thread.
+                    // Allow to swap out this thread by OS to not spin endlessly for nothing.
+                    std::this_thread::yield();
+                }
             }
         }
     }
@@ -233,6 +282,165 @@ namespace HBL2
         return !IsMainThread() && !IsRenderThread();
     }
 
+    uint32_t JobSystem::GetCoreForSlot(uint32_t slot) const
+    {
+        if (m_CoreOrder.empty())
+        {
+            return UINT32_MAX;
+        }
+
+        return m_CoreOrder[slot % m_CoreOrder.size()];
+    }
+
+    void JobSystem::SetThreadAffinity(std::thread& thread, uint32_t core)
+    {
+        if (core == UINT32_MAX)
+        {
+            return;
+        }
+
+        auto handle = thread.native_handle();
+
+#ifdef _WIN32
+        // Put the thread on to dedicated core.
+        DWORD_PTR affinityMask = 1ull << core;
+        DWORD_PTR affinity_result = SetThreadAffinityMask(handle, affinityMask);
+        assert(affinity_result > 0);
+
+        // Set priority to normal.
+        BOOL priority_result = SetThreadPriority(handle, THREAD_PRIORITY_NORMAL);
+        assert(priority_result != 0);
+#elif defined(__linux__)
+        cpu_set_t cpuset;
+        CPU_ZERO(&cpuset);
+        CPU_SET(core, &cpuset);
+
+        int result = pthread_setaffinity_np(handle, sizeof(cpu_set_t), &cpuset);
+        if (result != 0)
+        {
+            HBL2_CORE_WARN("JobSystem: Failed to set the affinity of a thread to core {} (error {}).", core, result);
+        }
+#endif
+    }
+
+    void JobSystem::SetThreadName(std::thread& thread, const char* name)
+    {
+        auto handle = thread.native_handle();
+
+#ifdef _WIN32
+        std::string threadName = name;
+        std::wstring wthreadname(threadName.begin(), threadName.end());
+        HRESULT hr = SetThreadDescription(handle, wthreadname.c_str());
+        assert(SUCCEEDED(hr));
+#elif defined(__linux__)
+        // NOTE: Linux thread names are limited to 16 characters including the null terminator.
+        char threadName[16];
+        CopyName(threadName, sizeof(threadName), name);
+        pthread_setname_np(handle, threadName);
+#endif
+    }
+
+#ifdef __linux__
+    static bool ReadSysfsValue(const std::filesystem::path& path, int& value)
+    {
+        std::ifstream file(path);
+        return (bool)(file >> value);
+    }
+#endif
+
+    void JobSystem::BuildCoreOrder(ThreadAffinityPolicy policy)
+    {
+        m_CoreOrder.clear();
+
+        if (policy == ThreadAffinityPolicy::None)
+        {
+            return;
+        }
+
+        const uint32_t logicalCoreCount = std::max(1u, std::thread::hardware_concurrency());
+
+        struct CoreInfo
+        {
+            uint32_t LogicalCore;
+            int Package;
+            int CoreId;
+            uint32_t SiblingIndex; // 0 for the first hardware thread of a physical core, 1 for its SMT sibling, etc.
+        };
+
+        std::vector<CoreInfo> cores;
+        cores.reserve(logicalCoreCount);
+
+#ifdef __linux__
+        // Only consider the cores the process is allowed to run on.
+        cpu_set_t allowed;
+        CPU_ZERO(&allowed);
+        const bool hasAllowedSet = sched_getaffinity(0, sizeof(cpu_set_t), &allowed) == 0;
+
+        for (uint32_t cpu = 0; cpu < CPU_SETSIZE; ++cpu)
+        {
+            const std::filesystem::path topology = "/sys/devices/system/cpu/cpu" + std::to_string(cpu) + "/topology";
+
+            if (!std::filesystem::exists(topology))
+            {
+                if (cpu >= logicalCoreCount)
+                {
+                    break;
+                }
+
+                continue;
+            }
+
+            if (hasAllowedSet && !CPU_ISSET(cpu, &allowed))
+            {
+                continue;
+            }
+
+            int package = 0;
+            int coreId = (int)cpu;
+            ReadSysfsValue(topology / "physical_package_id", package);
+            ReadSysfsValue(topology / "core_id", coreId);
+
+            cores.push_back({ cpu, package, coreId, 0 });
+        }
+#endif
+
+        // Fallback when the topology is unknown, treat every logical core as a physical one.
+        if (cores.empty())
+        {
+            for (uint32_t cpu = 0; cpu < logicalCoreCount; ++cpu)
+            {
+                cores.push_back({ cpu, 0, (int)cpu, 0 });
+            }
+        }
+
+        if (policy == ThreadAffinityPolicy::PhysicalCoresFirst)
+        {
+            // Number the hardware threads of each physical core in logical core order.
+            for (size_t i = 0; i < cores.size(); ++i)
+            {
+                for (size_t j = 0; j < i; ++j)
+                {
+                    if (cores[j].Package == cores[i].Package && cores[j].CoreId == cores[i].CoreId)
+                    {
+                        cores[i].SiblingIndex++;
+                    }
+                }
+            }
+
+            std::stable_sort(cores.begin(), cores.end(), [](const CoreInfo& a, const CoreInfo& b)
+            {
+                return a.SiblingIndex < b.SiblingIndex;
+            });
+        }
+
+        m_CoreOrder.reserve(cores.size());
+
+        for (const CoreInfo& core : cores)
+        {
+            m_CoreOrder.push_back(core.LogicalCore);
+        }
+    }
+
     void JobSystem::WorkerThreadFunc(uint32_t threadIndex)
     {
         s_WorkerIndex = threadIndex;
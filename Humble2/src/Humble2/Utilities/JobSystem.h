@@ -7,7 +7,9 @@
 
 #include "Core/Allocators.h"
 #include "Allocators/Arena.h"
+#include "Allocators/ScratchArena.h"
 #include "Collections/Collections.h"
+#include "Tracer.h"
 
 #include "moodycamel/concurrentqueue.h"
 
@@ -16,13 +18,22 @@
 #include <thread>
 #include <algorithm>
 #include <functional>
+#include <vector>
 #include <condition_variable>
 
 namespace HBL2
 {
+    enum class ThreadAffinityPolicy
+    {
+        None = 0,           // Threads are not pinned and float freely.
+        LogicalCores,       // Threads are pinned to consecutive logical cores.
+        PhysicalCoresFirst, // Threads are spread across physical cores first, SMT siblings are used last.
+    };
+
     struct JobSystemSpecification
     {
         uint32_t MaxWorkerMemory = 2; // In MB
+        ThreadAffinityPolicy AffinityPolicy = ThreadAffinityPolicy::PhysicalCoresFirst;
     };
 
     struct HBL2_API JobDispatchArgs
@@ -56,6 +67,112 @@ namespace HBL2
         bool Busy(const JobContext& ctx);
         void Wait(const JobContext& ctx);
 
+        /**
+         * @brief Calls fn(i) for every i in [begin, end) in parallel and waits for completion.
+         *
+         * The range is split recursively in halves, the calling thread keeps the left half and
+         * the right half is pushed as a job that idle workers can steal, so uneven per-item costs balance out.
+         *
+         * @param begin The first index.
+         * @param end One past the last index.
+         * @param fn The function to call for each index.
+         * @param grainSize The range size under which no more splitting happens, 0 picks one based on the thread count.
+         */
+        template<typename Fn>
+        void ParallelFor(uint32_t begin, uint32_t end, const Fn& fn, uint32_t grainSize = 0)
+        {
+            ParallelForRange(begin, end, [&fn](uint32_t rangeBegin, uint32_t rangeEnd)
+            {
+                for (uint32_t i = rangeBegin; i < rangeEnd; ++i)
+                {
+                    fn(i);
+                }
+            }, grainSize);
+        }
+
+        /**
+         * @brief Same as ParallelFor, but fn(rangeBegin, rangeEnd) is called once per leaf range.
+         */
+        template<typename Fn>
+        void ParallelForRange(uint32_t begin, uint32_t end, const Fn& fn, uint32_t grainSize = 0)
+        {
+            if (begin >= end)
+            {
+                return;
+            }
+
+            grainSize = GetGrainSize(end - begin, grainSize);
+
+            // Worker arena allocations of a leaf range live until it returns. Spawned leaves never reach the job reset and the
+            // calling thread may not be a worker (main or render thread), so without this the arenas would grow every call.
+            const auto runLeaf = [this, &fn](uint32_t rangeBegin, uint32_t rangeEnd)
+            {
+                ScratchArena scratch(*GetWorkerArena());
+                fn(rangeBegin, rangeEnd);
+            };
+
+            if (end - begin <= grainSize)
+            {
+                runLeaf(begin, end);
+                return;
+            }
+
+            JobContext ctx;
+
+            std::function<void(uint32_t, uint32_t)> split = [&](uint32_t rangeBegin, uint32_t rangeEnd)
+            {
+                while (rangeEnd - rangeBegin > grainSize)
+                {
+                    const uint32_t mid = rangeBegin + (rangeEnd - rangeBegin) / 2;
+                    Spawn(ctx, [&split, mid, rangeEnd]() { split(mid, rangeEnd); });
+                    rangeEnd = mid;
+                }
+
+                runLeaf(rangeBegin, rangeEnd);
+            };
+
+            split(begin, end);
+
+            Wait(ctx);
+        }
+
+        /**
+         * @brief Reduces the range [begin, end) in parallel.
+         *
+         * @note The reduce function must be associative and commutative, partial results are combined per thread in no particular order.
+         *
+         * @param begin The first index.
+         * @param end One past the last index.
+         * @param identity The identity value of the reduction.
+         * @param map Computes the partial result of a range, T map(uint32_t rangeBegin, uint32_t rangeEnd).
+         * @param reduce Combines two partial results, T reduce(const T& a, const T& b).
+         * @param grainSize The range size under which no more splitting happens, 0 picks one based on the thread count.
+         * @return The reduced value.
+         */
+        template<typename T, typename MapFn, typename ReduceFn>
+        T ParallelReduce(uint32_t begin, uint32_t end, const T& identity, const MapFn& map, const ReduceFn& reduce, uint32_t grainSize = 0)
+        {
+            // NOTE: One partial per JobSystem thread (workers, main and render), so no synchronization is needed.
+            std::vector<T> partials(m_NumThreads + 2, identity);
+
+            ParallelForRange(begin, end, [&](uint32_t rangeBegin, uint32_t rangeEnd)
+            {
+                const uint32_t workerIndex = GetWorkerIndex();
+                HBL2_CORE_ASSERT(workerIndex < partials.size(), "ParallelReduce can only be used from within JobSystem threads!");
+
+                partials[workerIndex] = reduce(partials[workerIndex], map(rangeBegin, rangeEnd));
+            }, grainSize);
+
+            T result = identity;
+
+            for (const T& partial : partials)
+            {
+                result = reduce(result, partial);
+            }
+
+            return result;
+        }
+
         void SetupWorkerRT();
         inline uint32_t GetThreadCount() const { return m_NumThreads; }
         uint32_t GetWorkerIndex();
@@ -66,21 +183,41 @@ namespace HBL2
         // They get automotically freed when the job ends.
         Arena* GetWorkerArena();
 
+        // Returns the arena of the worker with the provided index (see GetWorkerIndex), meant for stats.
+        inline Arena* GetWorkerArena(uint32_t workerIndex) const { return m_WorkerArenas[workerIndex]; }
+
         bool IsMainThread();
         bool IsRenderThread();
         bool IsWorkerThread();
 
+        /**
+         * @brief Returns the logical core a thread slot should be pinned to, based on the affinity policy.
+         *
+         * @note Slot 0 is the main thread, slot 1 the render thread and slots [2, N + 2) the workers.
+         *
+         * @param slot The thread slot.
+         * @return The logical core index, or UINT32_MAX if the thread should not be pinned.
+         */
+        uint32_t GetCoreForSlot(uint32_t slot) const;
+
+        static void SetThreadAffinity(std::thread& thread, uint32_t core);
+        static void SetThreadName(std::thread& thread, const char* name);
+
     private:
         JobSystem() {}
 
         void InternalInitialize(const JobSystemSpecification&& spec);
         void InternalShutdown();
         void WorkerThreadFunc(uint32_t threadIndex);
+        void Spawn(JobContext& ctx, std::function<void()>&& job);
+        uint32_t GetGrainSize(uint32_t count, uint32_t grainSize) const;
+        void BuildCoreOrder(ThreadAffinityPolicy policy);
 
         PoolReservation* m_Reservation = nullptr;
         Arena m_JobSystemArena;
 
         uint32_t m_NumThreads = 0;
+        std::vector<uint32_t> m_CoreOrder;
 
         DArray<std::thread> m_Workers = MakeEmptyDArray<std::thread>();
         DArray<Arena*> m_WorkerArenas = MakeEmptyDArray<Arena*>();
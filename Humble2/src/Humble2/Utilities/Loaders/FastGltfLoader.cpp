@@ -890,6 +890,8 @@ namespace HBL2
 	{
 		SubMeshDescriptor subMeshDescriptor{};
 		subMeshDescriptor.debugName = strdup(mesh.name.c_str());
+		subMeshDescriptor.minVertex = { (std::numeric_limits<float>::max)(), (std::numeric_limits<float>::max)(), (std::numeric_limits<float>::max)() };
+		subMeshDescriptor.maxVertex = { (std::numeric_limits<float>::lowest)(), (std::numeric_limits<float>::lowest)(), (std::numeric_limits<float>::lowest)() };
 
 		const fastgltf::Primitive& primitive = mesh.primitives[subMeshIndex];
 
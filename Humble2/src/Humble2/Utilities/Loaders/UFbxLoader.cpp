@@ -800,7 +800,7 @@ namespace HBL2
         SubMeshDescriptor subMeshDescriptor{};
         subMeshDescriptor.debugName = node->materials.count > 0 ? strdup(node->materials[subMeshIndex]->name.data) : strdup(node->name.data);
         subMeshDescriptor.minVertex = { (std::numeric_limits<float>::max)(), (std::numeric_limits<float>::max)(), (std::numeric_limits<float>::max)() };
-        subMeshDescriptor.maxVertex = { (std::numeric_limits<float>::min)(), (std::numeric_limits<float>::min)(), (std::numeric_limits<float>::min)() };
+        subMeshDescriptor.maxVertex = { (std::numeric_limits<float>::lowest)(), (std::numeric_limits<float>::lowest)(), (std::numeric_limits<float>::lowest)() };
 
         ufbx_mesh& fbxMesh = *node->mesh; // mesh for this node, contains submeshes
         const ufbx_mesh_part& fbxSubmesh = node->mesh->material_parts[subMeshIndex];
@@ -0,0 +1,154 @@
+#include "MemoryTelemetry.h"
+
+#include "Utilities/JobSystem.h"
+#include "Renderer/Renderer.h"
+
+#include <fstream>
+
+namespace HBL2
+{
+	void MemoryTelemetry::Update(float deltaTime)
+	{
+		Allocator::Arena.UpdateTelemetry(deltaTime);
+	}
+
+	std::vector<ReservationStats> MemoryTelemetry::GetReservationStats()
+	{
+		return Allocator::Arena.GetReservationStats();
+	}
+
+	static ArenaPeakStats GetArenaPeakStats(const char* name, const Arena& arena)
+	{
+		ArenaPeakStats stats;
+		CopyName(stats.Name, sizeof(stats.Name), name);
+		stats.TotalBytes = arena.TotalBytes();
+		stats.LastUsedBytes = arena.LastUsedBytes();
+		stats.PeakBytes = arena.PeakBytes();
+		return stats;
+	}
+
+	std::vector<ArenaPeakStats> MemoryTelemetry::GetFrameArenaStats()
+	{
+		std::vector<ArenaPeakStats> stats;
+
+		stats.push_back(GetArenaPeakStats("FrameArenaMT", Allocator::FrameArenaMT));
+		stats.push_back(GetArenaPeakStats("FrameArenaRT", Allocator::FrameArenaRT));
+
+		if (Renderer::Instance != nullptr)
+		{
+			for (uint32_t i = 0; i < Renderer::FrameCount; ++i)
+			{
+				const std::string name = "FrameSlotArena_" + std::to_string(i);
+				stats.push_back(GetArenaPeakStats(name.c_str(), Renderer::Instance->GetFrameArena(i)));
+			}
+		}
+
+		// NOTE: The '+2' are the worker arenas of the main and render thread.
+		const uint32_t threadCount = JobSystem::Get().GetThreadCount();
+
+		for (uint32_t i = 0; i < threadCount + 2; ++i)
+		{
+			const std::string name = (i < threadCount) ? "WorkerArena_" + std::to_string(i) : (i == threadCount ? "WorkerArena_Main" : "WorkerArena_Render");
+			stats.push_back(GetArenaPeakStats(name.c_str(), *JobSystem::Get().GetWorkerArena(i)));
+		}
+
+		return stats;
+	}
+
+	void MemoryTelemetry::ResetPeaks()
+	{
+		Allocator::FrameArenaMT.ResetPeak();
+		Allocator::FrameArenaRT.ResetPeak();
+
+		if (Renderer::Instance != nullptr)
+		{
+			for (uint32_t i = 0; i < Renderer::FrameCount; ++i)
+			{
+				Renderer::Instance->GetFrameArena(i).ResetPeak();
+			}
+		}
+
+		const uint32_t threadCount = JobSystem::Get().GetThreadCount();
+
+		for (uint32_t i = 0; i < threadCount + 2; ++i)
+		{
+			JobSystem::Get().GetWorkerArena(i)->ResetPeak();
+		}
+	}
+
+	// Names are user provided (reservation and arena names), quotes and backslashes would break the JSON.
+	static void WriteEscaped(std::ofstream& out, const char* str)
+	{
+		for (const char* c = str; *c != '\0'; ++c)
+		{
+			if (*c == '"' || *c == '\\')
+			{
+				out << '\\';
+			}
+
+			out << ((unsigned char)*c < 0x20 ? ' ' : *c);
+		}
+	}
+
+	bool MemoryTelemetry::DumpJson(const std::filesystem::path& path)
+	{
+		std::ofstream out(path, std::ios::out | std::ios::trunc);
+
+		if (!out.is_open())
+		{
+			HBL2_CORE_ERROR("MemoryTelemetry: Could not open file {} for writing!", path.string());
+			return false;
+		}
+
+		out << "{\n";
+		out << "  \"arena\": { \"dataSize\": " << Allocator::Arena.DataSize() << ", \"dataInUse\": " << Allocator::Arena.DataInUse()
+			<< ", \"metaSize\": " << Allocator::Arena.MetaSize() << ", \"metaCarved\": " << Allocator::Arena.MetaCarved() << " },\n";
+
+		out << "  \"reservations\": [\n";
+
+		const std::vector<ReservationStats> reservations = GetReservationStats();
+
+		for (size_t i = 0; i < reservations.size(); ++i)
+		{
+			const ReservationStats& r = reservations[i];
+
+			out << "    { \"name\": \"";
+			WriteEscaped(out, r.Name);
+			out << "\""
+				<< ", \"size\": " << r.Size
+				<< ", \"carved\": " << r.Carved
+				<< ", \"bytesUsed\": " << r.BytesUsed
+				<< ", \"peakBytesUsed\": " << r.PeakBytesUsed
+				<< ", \"chunkCount\": " << r.ChunkCount
+				<< ", \"allocationCount\": " << r.AllocationCount
+				<< ", \"allocationsPerSecond\": " << r.AllocationsPerSecond
+				<< ", \"hugePages\": " << (r.HugePages ? "true" : "false")
+				<< " }" << (i + 1 < reservations.size() ? ",\n" : "\n");
+		}
+
+		out << "  ],\n";
+		out << "  \"frameArenas\": [\n";
+
+		const std::vector<ArenaPeakStats> arenas = GetFrameArenaStats();
+
+		for (size_t i = 0; i < arenas.size(); ++i)
+		{
+			const ArenaPeakStats& a = arenas[i];
+
+			out << "    { \"name\": \"";
+			WriteEscaped(out, a.Name);
+			out << "\""
+				<< ", \"totalBytes\": " << a.TotalBytes
+				<< ", \"lastUsedBytes\": " << a.LastUsedBytes
+				<< ", \"peakBytes\": " << a.PeakBytes
+				<< " }" << (i + 1 < arenas.size() ? ",\n" : "\n");
+		}
+
+		out << "  ]\n";
+		out << "}\n";
+
+		HBL2_CORE_INFO("MemoryTelemetry: Dumped memory report to {}.", path.string());
+
+		return true;
+	}
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "Base.h"
+
+#include "Core/Allocators.h"
+
+#include <vector>
+#include <filesystem>
+
+namespace HBL2
+{
+	/**
+	 * @brief Peak usage of a per frame (or per job) arena.
+	 */
+	struct ArenaPeakStats
+	{
+		char Name[32]{};
+		size_t TotalBytes = 0;
+		size_t LastUsedBytes = 0; // Usage right before the last reset.
+		size_t PeakBytes = 0;     // Peak since startup or the last ResetPeaks call.
+	};
+
+	/**
+	 * @brief Memory telemetry report, gathers per reservation stats and frame / worker arena peaks.
+	 *
+	 * Useful to size MaxWorkerMemory, MaxMainThreadFrameArenaMemory, maxEntities, etc from real data.
+	 */
+	class HBL2_API MemoryTelemetry
+	{
+	public:
+		/**
+		 * @brief Updates the allocation rates, should be called once per frame from the main thread.
+		 *
+		 * @param deltaTime The frame time in seconds.
+		 */
+		static void Update(float deltaTime);
+
+		/**
+		 * @brief Returns a snapshot of every live reservation in the global arena.
+		 */
+		static std::vector<ReservationStats> GetReservationStats();
+
+		/**
+		 * @brief Returns the peaks of FrameArenaMT, FrameArenaRT, the renderer frame slot arenas and every JobSystem worker arena.
+		 */
+		static std::vector<ArenaPeakStats> GetFrameArenaStats();
+
+		/**
+		 * @brief Clears the peaks of the frame and worker arenas.
+		 */
+		static void ResetPeaks();
+
+		/**
+		 * @brief Writes the current report as JSON.
+		 *
+		 * @param path The output file path.
+		 * @return True if the file was written successfully.
+		 */
+		static bool DumpJson(const std::filesystem::path& path);
+	};
+}
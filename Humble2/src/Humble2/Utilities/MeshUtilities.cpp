@@ -46,8 +46,8 @@ namespace HBL2
 		m_Arena.Initialize(&Allocator::Arena, 128_KB, m_Reservation);
 
 		m_BuiltInMeshAssets = MakeDArray<Handle<Asset>>(m_Arena, 1024);
-		m_LoadedBuiltInMeshAssets = MakeHMap<BuiltInMesh, Handle<Asset>>(m_Arena, 1024);
-		m_LoadedBuiltInMeshes = MakeHMap<BuiltInMesh, Handle<Mesh>>(m_Arena, 1024);
+		m_LoadedBuiltInMeshAssets = HashMap<BuiltInMesh, Handle<Asset>>(&m_Arena, 16);
+		m_LoadedBuiltInMeshes = HashMap<BuiltInMesh, Handle<Mesh>>(&m_Arena, 16);
 	}
 
 	Handle<Mesh> MeshUtilities::Load(const std::filesystem::path& path)
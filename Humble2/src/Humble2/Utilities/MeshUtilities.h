@@ -6,6 +6,8 @@
 #include "Loaders/UFbxLoader.h"
 #include "Loaders/FastGltfLoader.h"
 
+#include "Utilities/Collections/HashMap.h"
+
 #include <filesystem>
 
 namespace HBL2
@@ -53,8 +55,8 @@ namespace HBL2
 		Arena m_Arena;
 
 		DArray<Handle<Asset>> m_BuiltInMeshAssets = MakeEmptyDArray<Handle<Asset>>();
-		HMap<BuiltInMesh, Handle<Asset>> m_LoadedBuiltInMeshAssets = MakeEmptyHMap<BuiltInMesh, Handle<Asset>>();
-		HMap<BuiltInMesh, Handle<Mesh>> m_LoadedBuiltInMeshes = MakeEmptyHMap<BuiltInMesh, Handle<Mesh>>();
+		HashMap<BuiltInMesh, Handle<Asset>> m_LoadedBuiltInMeshAssets;
+		HashMap<BuiltInMesh, Handle<Mesh>> m_LoadedBuiltInMeshes;
 
 		static MeshUtilities* s_Instance;
 	};
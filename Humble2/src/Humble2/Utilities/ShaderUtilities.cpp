@@ -85,7 +85,7 @@ namespace HBL2
         m_Arena.Initialize(&Allocator::Arena, 16_MB, m_Reservation);
 
         m_ShaderAssets = MakeDArray<Handle<Asset>>(m_Arena, 1024);
-        m_Shaders = MakeHMap<BuiltInShader, Handle<Shader>>(m_Arena, 1024);
+        m_Shaders = HashMap<BuiltInShader, Handle<Shader>>(&m_Arena, 16);
 
         uint32_t globalSessionNum = std::thread::hardware_concurrency();
 
@@ -119,7 +119,7 @@ namespace HBL2
 		PoolReservation* m_Reservation = nullptr;
 		Arena m_Arena;
 
-		HMap<BuiltInShader, Handle<Shader>> m_Shaders = MakeEmptyHMap<BuiltInShader, Handle<Shader>>();
+		HashMap<BuiltInShader, Handle<Shader>> m_Shaders;
 		DArray<Handle<Asset>> m_ShaderAssets = MakeEmptyDArray<Handle<Asset>>();
 
 		static ShaderUtilities* s_Instance;
@@ -298,6 +298,19 @@ namespace HBL2
         return findBinding(name) != nullptr;
     }
 
+    bool ShaderReflectionData::hasInstanceBuffer() const
+    {
+        const DescriptorSetLayout* drawSet = findSet(3);
+
+        if (drawSet == nullptr)
+        {
+            return false;
+        }
+
+        const DescriptorBinding* binding = drawSet->findByBinding(1);
+        return binding != nullptr && (binding->type == ResourceType::StorageBufferReadOnly || binding->type == ResourceType::StorageBuffer);
+    }
+
     void ShaderReflectionData::print() const
     {
         printf("=== Shader Reflection: %s ===\n\n", sourcePath.c_str());
@@ -117,6 +117,9 @@ namespace HBL2
         // True if any descriptor binding exists with this name
         bool hasBinding(const std::string& name) const;
 
+        // True if the draw bind group (set 3) declares the instance buffer on slot 1, so the shader can be drawn instanced
+        bool hasInstanceBuffer() const;
+
         void print() const; // dumps a human-readable summary to stdout
 
         void Clear();
@@ -0,0 +1,259 @@
+#include "Tracer.h"
+
+#include "Utilities/JobSystem.h"
+
+#include <fstream>
+
+namespace HBL2
+{
+	Tracer* Tracer::s_Instance = nullptr;
+	std::atomic<bool> Tracer::s_Enabled{ false };
+
+	Tracer& Tracer::Get()
+	{
+		HBL2_CORE_ASSERT(s_Instance != nullptr, "Tracer::s_Instance is null! Call Tracer::Initialize before use.");
+		return *s_Instance;
+	}
+
+	void Tracer::Initialize(const TracerSpecification&& spec)
+	{
+		HBL2_CORE_ASSERT(s_Instance == nullptr, "Tracer::s_Instance is not null! Tracer::Initialize has been called twice.");
+		s_Instance = new Tracer;
+
+		Get().InternalInitialize(std::forward<const TracerSpecification>(spec));
+	}
+
+	void Tracer::Shutdown()
+	{
+		HBL2_CORE_ASSERT(s_Instance != nullptr, "Tracer::s_Instance is null!");
+
+		s_Enabled.store(false, std::memory_order_release);
+
+		Get().InternalShutdown();
+
+		delete s_Instance;
+		s_Instance = nullptr;
+	}
+
+	void Tracer::SetEnabled(bool enabled)
+	{
+		if (s_Instance == nullptr)
+		{
+			return;
+		}
+
+		s_Enabled.store(enabled, std::memory_order_release);
+	}
+
+	void Tracer::InternalInitialize(const TracerSpecification&& spec)
+	{
+		// NOTE: One buffer per worker thread plus the main and render thread, matching JobSystem::GetWorkerIndex().
+		m_BufferCount = JobSystem::Get().GetThreadCount() + 2;
+		m_Capacity = std::max(1u, spec.MaxZonesPerThread);
+
+		const uint64_t bytes = ArenaLayout::Create()
+			.Add<ThreadBuffer*>(m_BufferCount)
+			.Add<ThreadBuffer>(m_BufferCount)
+			.Add<ZoneSlot>((uint64_t)m_Capacity * m_BufferCount)
+			.Total();
+
+		m_Reservation = Allocator::Arena.Reserve("TracerPool", bytes);
+		m_Arena.Initialize(&Allocator::Arena, bytes, m_Reservation);
+
+		m_Buffers = (ThreadBuffer**)m_Arena.Alloc(sizeof(ThreadBuffer*) * m_BufferCount, alignof(ThreadBuffer*));
+
+		for (uint32_t i = 0; i < m_BufferCount; ++i)
+		{
+			m_Buffers[i] = m_Arena.AllocConstruct<ThreadBuffer>();
+			m_Buffers[i]->Zones = m_Arena.ConstructArray<ZoneSlot>(m_Arena.Alloc(sizeof(ZoneSlot) * m_Capacity, alignof(ZoneSlot)), m_Capacity);
+		}
+
+		m_StartTicks = Now();
+		m_StartTime = std::chrono::steady_clock::now();
+
+		s_Enabled.store(spec.EnabledOnStartup, std::memory_order_release);
+	}
+
+	void Tracer::InternalShutdown()
+	{
+		// Also releases the reservation, since the arena was its only user.
+		m_Arena.Destroy();
+		m_Reservation = nullptr;
+
+		m_Buffers = nullptr;
+		m_BufferCount = 0;
+	}
+
+	Tracer::ThreadBuffer* Tracer::GetThreadBuffer()
+	{
+		const uint32_t workerIndex = JobSystem::Get().GetWorkerIndex();
+
+		if (workerIndex >= m_BufferCount)
+		{
+			return nullptr;
+		}
+
+		return m_Buffers[workerIndex];
+	}
+
+	void Tracer::RecordZone(const char* name, uint64_t begin, uint64_t end)
+	{
+		if (s_Instance == nullptr || !IsEnabled())
+		{
+			return;
+		}
+
+		ThreadBuffer* buffer = s_Instance->GetThreadBuffer();
+
+		if (buffer == nullptr)
+		{
+			return;
+		}
+
+		// Single producer, so a relaxed load of our own head is enough.
+		const uint64_t head = buffer->Head.load(std::memory_order_relaxed);
+
+		ZoneSlot& slot = buffer->Zones[head % s_Instance->m_Capacity];
+
+		// Invalidate the slot before overwriting it, so an exporter copying it concurrently discards the torn copy.
+		slot.Sequence.store(0, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);
+
+		slot.Zone.Begin = begin;
+		slot.Zone.End = end;
+		CopyName(slot.Zone.Name, sizeof(slot.Zone.Name), name != nullptr ? name : "Unknown");
+
+		// Publish the zone to the exporter.
+		slot.Sequence.store(head + 1, std::memory_order_release);
+		buffer->Head.store(head + 1, std::memory_order_release);
+	}
+
+	void Tracer::MarkFrame(const char* name)
+	{
+		if (!IsEnabled())
+		{
+			return;
+		}
+
+		const uint64_t now = Now();
+		RecordZone(name, now, now);
+	}
+
+	static void WriteEscaped(std::ofstream& out, const char* str)
+	{
+		for (const char* c = str; *c != '\0'; ++c)
+		{
+			if (*c == '"' || *c == '\\')
+			{
+				out << '\\';
+			}
+
+			out << ((unsigned char)*c < 0x20 ? ' ' : *c);
+		}
+	}
+
+	bool Tracer::ExportChromeTrace(const std::filesystem::path& path)
+	{
+		std::ofstream out(path, std::ios::out | std::ios::trunc);
+
+		if (!out.is_open())
+		{
+			HBL2_CORE_ERROR("Tracer: Could not open file {} for writing!", path.string());
+			return false;
+		}
+
+		// Calibrate raw ticks against the steady clock, so the export stays correct regardless of TSC frequency.
+		const uint64_t nowTicks = Now();
+		const double elapsedUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - m_StartTime).count();
+		const double ticksPerUs = elapsedUs > 0.0 ? (double)(nowTicks - m_StartTicks) / elapsedUs : 1.0;
+
+		const uint32_t threadCount = JobSystem::Get().GetThreadCount();
+
+		std::vector<TraceZone> snapshot;
+		snapshot.reserve(m_Capacity);
+
+		out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+
+		bool first = true;
+
+		for (uint32_t tid = 0; tid < m_BufferCount; ++tid)
+		{
+			ThreadBuffer* buffer = m_Buffers[tid];
+
+			if (!first)
+			{
+				out << ",\n";
+			}
+			first = false;
+
+			const std::string threadName = (tid < threadCount) ? "HBL2::Job_" + std::to_string(tid) : (tid == threadCount ? "Main Thread" : "Render Thread");
+
+			out << "{\"ph\":\"M\",\"pid\":1,\"tid\":" << tid << ",\"name\":\"thread_name\",\"args\":{\"name\":\"";
+			WriteEscaped(out, threadName.c_str());
+			out << "\"}}";
+
+			// Copy the live window of the ring, keeping only the slots that still held the same zone before and after the copy.
+			const uint64_t head = buffer->Head.load(std::memory_order_acquire);
+			const uint64_t tail = std::max(buffer->Tail.load(std::memory_order_relaxed), head > m_Capacity ? head - m_Capacity : 0);
+
+			snapshot.clear();
+			for (uint64_t i = tail; i < head; ++i)
+			{
+				const ZoneSlot& slot = buffer->Zones[i % m_Capacity];
+
+				if (slot.Sequence.load(std::memory_order_acquire) != i + 1)
+				{
+					continue;
+				}
+
+				TraceZone zone = slot.Zone;
+
+				std::atomic_thread_fence(std::memory_order_acquire);
+				if (slot.Sequence.load(std::memory_order_relaxed) != i + 1)
+				{
+					continue;
+				}
+
+				snapshot.push_back(zone);
+			}
+
+			for (const TraceZone& zone : snapshot)
+			{
+				if (zone.Begin < m_StartTicks)
+				{
+					continue;
+				}
+
+				const double ts = (double)(zone.Begin - m_StartTicks) / ticksPerUs;
+
+				out << ",\n{\"name\":\"";
+				WriteEscaped(out, zone.Name);
+
+				if (zone.Begin == zone.End)
+				{
+					out << "\",\"ph\":\"i\",\"s\":\"g\",\"pid\":1,\"tid\":" << tid << ",\"ts\":" << ts << "}";
+				}
+				else
+				{
+					const double dur = (double)(zone.End - zone.Begin) / ticksPerUs;
+					out << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << tid << ",\"ts\":" << ts << ",\"dur\":" << dur << "}";
+				}
+			}
+		}
+
+		out << "\n]}\n";
+		out.close();
+
+		HBL2_CORE_INFO("Tracer: Exported trace to {}.", path.string());
+
+		return true;
+	}
+
+	void Tracer::Clear()
+	{
+		for (uint32_t i = 0; i < m_BufferCount; ++i)
+		{
+			m_Buffers[i]->Tail.store(m_Buffers[i]->Head.load(std::memory_order_acquire), std::memory_order_relaxed);
+		}
+	}
+}
@@ -0,0 +1,170 @@
+#pragma once
+
+#include "Base.h"
+
+#include "Core/Allocators.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+	#include <intrin.h>
+#endif
+
+#define HBL2_TRACE_CONCAT_IMPL(a, b) a##b
+#define HBL2_TRACE_CONCAT(a, b) HBL2_TRACE_CONCAT_IMPL(a, b)
+
+// NOTE: Tracing is compiled in all configurations (including DIST) so that production captures are possible.
+//       When the tracer is disabled, a zone costs a single relaxed atomic load.
+#define HBL2_TRACE_ZONE(name) HBL2::TraceScope HBL2_TRACE_CONCAT(traceScope, __LINE__) = HBL2::TraceScope(name)
+#define HBL2_TRACE_FUNC() HBL2_TRACE_ZONE(__FUNCTION__)
+#define HBL2_TRACE_FRAME(name) HBL2::Tracer::MarkFrame(name)
+
+namespace HBL2
+{
+	/**
+	 * @brief A completed zone (or an instant frame marker when Begin == End).
+	 */
+	struct TraceZone
+	{
+		uint64_t Begin = 0;
+		uint64_t End = 0;
+		char Name[48]{};
+	};
+
+	struct TracerSpecification
+	{
+		uint32_t MaxZonesPerThread = 16384;
+		bool EnabledOnStartup = false;
+	};
+
+	/**
+	 * @brief Low overhead tracer that records zones in per-thread lock-free ring buffers.
+	 *
+	 * There is one ring buffer per JobSystem worker (including the main and render thread),
+	 * each buffer has exactly one producer (its owning thread), so recording a zone never takes a lock.
+	 * The buffers can be exported at any time in the Chrome trace event format (chrome://tracing, Perfetto).
+	 */
+	class HBL2_API Tracer
+	{
+	public:
+		Tracer(const Tracer&) = delete;
+
+		static Tracer& Get();
+
+		static void Initialize(const TracerSpecification&& spec);
+
+		/**
+		 * @brief Destroys the tracer.
+		 *
+		 * @note The JobSystem must be shut down before, so no worker can still be recording a zone.
+		 */
+		static void Shutdown();
+
+		/**
+		 * @brief Returns a raw timestamp in ticks (TSC on x86, steady clock elsewhere).
+		 */
+		static inline uint64_t Now()
+		{
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+			return __rdtsc();
+#elif defined(__x86_64__) || defined(__i386__)
+			return __builtin_ia32_rdtsc();
+#else
+			return (uint64_t)std::chrono::steady_clock::now().time_since_epoch().count();
+#endif
+		}
+
+		static inline bool IsEnabled() { return s_Enabled.load(std::memory_order_relaxed); }
+		static void SetEnabled(bool enabled);
+
+		/**
+		 * @brief Records a completed zone in the ring buffer of the calling thread.
+		 *
+		 * @note Threads that are not part of the JobSystem are ignored.
+		 */
+		static void RecordZone(const char* name, uint64_t begin, uint64_t end);
+
+		/**
+		 * @brief Records an instant frame marker in the ring buffer of the calling thread.
+		 */
+		static void MarkFrame(const char* name);
+
+		/**
+		 * @brief Writes the currently buffered zones of all threads to a Chrome trace JSON file.
+		 *
+		 * @param path The output file path.
+		 * @return True if the file was written successfully.
+		 */
+		bool ExportChromeTrace(const std::filesystem::path& path);
+
+		/**
+		 * @brief Discards all the buffered zones.
+		 */
+		void Clear();
+
+	private:
+		Tracer() = default;
+
+		void InternalInitialize(const TracerSpecification&& spec);
+		void InternalShutdown();
+
+		/**
+		 * @brief A ring buffer entry, Sequence is the index + 1 of the zone it holds once it is fully written and 0 while it is being written.
+		 */
+		struct ZoneSlot
+		{
+			std::atomic<uint64_t> Sequence{ 0 };
+			TraceZone Zone;
+		};
+
+		struct ThreadBuffer
+		{
+			ZoneSlot* Zones = nullptr;
+			std::atomic<uint64_t> Head{ 0 };
+			std::atomic<uint64_t> Tail{ 0 }; // Everything before this index has been cleared.
+		};
+
+		ThreadBuffer* GetThreadBuffer();
+
+		PoolReservation* m_Reservation = nullptr;
+		Arena m_Arena;
+
+		ThreadBuffer** m_Buffers = nullptr;
+		uint32_t m_BufferCount = 0;
+		uint32_t m_Capacity = 0;
+
+		uint64_t m_StartTicks = 0;
+		std::chrono::steady_clock::time_point m_StartTime;
+
+		static std::atomic<bool> s_Enabled;
+		static Tracer* s_Instance;
+	};
+
+	/**
+	 * @brief RAII zone, records its lifetime on destruction if tracing was enabled when it was opened.
+	 */
+	class TraceScope
+	{
+	public:
+		TraceScope(const char* name)
+			: m_Name(name), m_Begin(Tracer::IsEnabled() ? Tracer::Now() : 0)
+		{
+		}
+
+		~TraceScope()
+		{
+			if (m_Begin != 0)
+			{
+				Tracer::RecordZone(m_Name, m_Begin, Tracer::Now());
+			}
+		}
+
+	private:
+		const char* m_Name;
+		uint64_t m_Begin;
+	};
+}
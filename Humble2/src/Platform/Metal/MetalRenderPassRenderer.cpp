@@ -45,7 +45,12 @@ namespace HBL2
             for (const auto& bufferEntry : globalBindGroupCold->Buffers)
             {
                 MetalBufferHot* buffer = rm->GetBufferHot(bufferEntry.buffer);
-                memcpy(buffer->Buffer->contents(), buffer->Data, buffer->ByteSize);
+                
+                // Nothing set this frame (e.g.: the light clusters when clustered lighting is off), keep the old contents.
+                if (buffer->Data != nullptr)
+                {
+                    memcpy(buffer->Buffer->contents(), buffer->Data, buffer->ByteSize);
+                }
                 
                 if (globalDraw.GlobalBufferOffset != UINT32_MAX)
                 {
@@ -1,6 +1,7 @@
 #include "MetalRenderer.h"
 
 #include "Platform/Metal/MetalResourceManager.h"
+#include "Renderer/LightClusters.h"
 
 namespace HBL2
 {
@@ -177,6 +178,42 @@ namespace HBL2
                 .initialData = nullptr,
             });
 
+            auto clusterGridBuffer = m_ResourceManager->CreateBuffer({
+                .debugName = "cluster-grid-uniform-buffer",
+                .usage = BufferUsage::UNIFORM,
+                .usageHint = BufferUsageHint::DYNAMIC,
+                .memoryUsage = MemoryUsage::GPU_CPU,
+                .byteSize = sizeof(ClusterGridData),
+                .initialData = nullptr,
+            });
+
+            auto clusterLightBuffer = m_ResourceManager->CreateBuffer({
+                .debugName = "cluster-light-storage-buffer",
+                .usage = BufferUsage::STORAGE,
+                .usageHint = BufferUsageHint::DYNAMIC,
+                .memoryUsage = MemoryUsage::GPU_CPU,
+                .byteSize = LightClusters::MaxLights * sizeof(ClusterLight),
+                .initialData = nullptr,
+            });
+
+            auto clusterRangeBuffer = m_ResourceManager->CreateBuffer({
+                .debugName = "cluster-range-storage-buffer",
+                .usage = BufferUsage::STORAGE,
+                .usageHint = BufferUsageHint::DYNAMIC,
+                .memoryUsage = MemoryUsage::GPU_CPU,
+                .byteSize = LightClusters::ClusterCount * sizeof(glm::uvec2),
+                .initialData = nullptr,
+            });
+
+            auto clusterIndexBuffer = m_ResourceManager->CreateBuffer({
+                .debugName = "cluster-index-storage-buffer",
+                .usage = BufferUsage::STORAGE,
+                .usageHint = BufferUsageHint::DYNAMIC,
+                .memoryUsage = MemoryUsage::GPU_CPU,
+                .byteSize = LightClusters::MaxLightIndices * sizeof(uint32_t),
+                .initialData = nullptr,
+            });
+
             m_MtlFrames[i].GlobalBindings3D = m_ResourceManager->CreateBindGroup({
                 .debugName = "global-bind-group",
                 .layout = m_GlobalBindingsLayout3D,
@@ -184,6 +221,10 @@ namespace HBL2
                 .buffers = {
                     { .buffer = cameraBuffer3D },
                     { .buffer = lightBuffer },
+                    { .buffer = clusterGridBuffer },
+                    { .buffer = clusterLightBuffer },
+                    { .buffer = clusterRangeBuffer },
+                    { .buffer = clusterIndexBuffer },
                 }
             });
         }
@@ -331,6 +372,10 @@ namespace HBL2
         delete TempUniformRingBuffer;
         TempUniformRingBuffer = nullptr;
 
+        TempInstanceRingBuffer->Free();
+        delete TempInstanceRingBuffer;
+        TempInstanceRingBuffer = nullptr;
+
         m_ResourceManager->FlushAll();
     }
 
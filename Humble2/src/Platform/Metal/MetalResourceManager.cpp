@@ -46,19 +46,15 @@ namespace HBL2
     // Textures
     Handle<Texture> MetalResourceManager::CreateTexture(const TextureDescriptor&& desc)
     {
-        return m_TexturePool.Insert(std::forward<const TextureDescriptor>(desc));
+        Handle<Texture> handle = m_TexturePool.Insert(std::forward<const TextureDescriptor>(desc));
+        TrackTexture(handle, desc);
+        return handle;
     }
     void MetalResourceManager::DeleteTexture(Handle<Texture> handle)
     {
-        m_DeletionQueue.Push(Renderer::Instance->GetFrameNumber(), [=, this]()
-        {
-            MetalTexture* texture = GetTexture(handle);
-            if (texture != nullptr)
-            {
-                texture->Destroy();
-                m_TexturePool.Remove(handle);
-            }
-        });
+        UntrackTexture(handle);
+
+        m_DeletionQueue.Push(Renderer::Instance->GetFrameNumber(), handle);
     }
     void MetalResourceManager::UpdateTexture(Handle<Texture> handle, const Span<const std::byte>& bytes)
     {
@@ -110,19 +106,14 @@ namespace HBL2
         MetalBuffer buffer;
         Handle<Buffer> bufferHandle = m_BufferSplitPool.Insert(&buffer.Hot, &buffer.Cold);
         buffer.Initialize(std::forward<const BufferDescriptor>(desc));
+        TrackBuffer(bufferHandle, desc);
         return bufferHandle;
     }
     void MetalResourceManager::DeleteBuffer(Handle<Buffer> handle)
     {
-        m_DeletionQueue.Push(Renderer::Instance->GetFrameNumber(), [=, this]()
-        {
-            MetalBuffer buffer = GetBuffer(handle);
-            if (buffer.IsValid())
-            {
-                buffer.Destroy();
-                m_BufferSplitPool.Remove(handle);
-            }
-        });
+        UntrackBuffer(handle);
+
+        m_DeletionQueue.Push(Renderer::Instance->GetFrameNumber(), handle);
     }
     void MetalResourceManager::ReAllocateBuffer(Handle<Buffer> handle, uint32_t currentOffset)
     {
@@ -200,10 +191,14 @@ namespace HBL2
         MetalShader shader;
         Handle<Shader> shaderHandle = m_ShaderSplitPool.Insert(&shader.Hot, &shader.Cold);
         shader.Initialize(std::forward<const ShaderDescriptor>(desc));
+        TrackShader(shaderHandle, desc);
         return shaderHandle;
     }
     void MetalResourceManager::RecompileShader(Handle<Shader> handle, const ShaderDescriptor&& desc)
     {
+        UntrackShader(handle);
+        TrackShader(handle, desc);
+
         MetalShader shader = GetShader(handle);
         shader.Recompile(std::forward<const ShaderDescriptor>(desc), true);
 
@@ -218,15 +213,9 @@ namespace HBL2
     }
     void MetalResourceManager::DeleteShader(Handle<Shader> handle)
     {
-        m_DeletionQueue.Push(Renderer::Instance->GetFrameNumber(), [=, this]()
-        {
-            MetalShader shader = GetShader(handle);
-            if (shader.IsValid())
-            {
-                shader.Destroy();
-                m_ShaderSplitPool.Remove(handle);
-            }
-        });
+        UntrackShader(handle);
+
+        m_DeletionQueue.Push(Renderer::Instance->GetFrameNumber(), handle);
     }
     uint64_t MetalResourceManager::GetOrAddShaderVariant(Handle<Shader> handle, const ShaderDescriptor::RenderPipeline::PackedVariant& variantDesc)
     {
@@ -277,11 +266,11 @@ namespace HBL2
     Handle<BindGroup> MetalResourceManager::CreateBindGroup(const BindGroupDescriptor&& desc)
     {
         // Caching mechanism so that materials with the same resources, use the same bind group.
-        uint16_t index = 0;
         uint64_t descriptorHash = ResourceManager::Instance->GetBindGroupHash(std::move(desc));
 
-        for (const auto& bindGroup : m_BindGroupSplitPool.GetDataColdPool())
+        for (uint32_t index = 0; index < m_BindGroupSplitPool.Capacity(); ++index)
         {
+            const auto& bindGroup = m_BindGroupSplitPool.GetColdAt(index);
             uint64_t hash = CalculateBindGroupHash(&bindGroup);
 
             if (descriptorHash == hash && bindGroup.DebugName != nullptr)
@@ -294,8 +283,6 @@ namespace HBL2
 
                 break;
             }
-
-            index++;
         }
 
         MetalBindGroup bindgroup;
@@ -325,15 +312,7 @@ namespace HBL2
 
         if (bindGroupCold->ReleaseRefAndMaybeDelete())
         {
-            m_DeletionQueue.Push(Renderer::Instance->GetFrameNumber(), [=, this]()
-            {
-                MetalBindGroupCold* bindGroupCold = GetBindGroupCold(handle);
-                if (bindGroupCold != nullptr)
-                {
-                    bindGroupCold->Destroy();
-                    m_BindGroupSplitPool.Remove(handle);
-                }
-            });
+            m_DeletionQueue.Push(Renderer::Instance->GetFrameNumber(), handle);
         }
     }
     void MetalResourceManager::UpdateBindGroup(Handle<BindGroup> handle)
@@ -399,11 +378,11 @@ namespace HBL2
     Handle<BindGroupLayout> MetalResourceManager::CreateBindGroupLayout(const BindGroupLayoutDescriptor&& desc)
     {
         // Caching mechanism so that bind groups and shaders with the same layout, use the same bind group layout object.
-        uint16_t index = 0;
         uint64_t layoutHash = ResourceManager::Instance->GetBindGroupLayoutHash(std::move(desc));
 
-        for (const auto& bindGroupLayout : m_BindGroupLayoutPool.GetDataPool())
+        for (uint32_t index = 0; index < m_BindGroupLayoutPool.Capacity(); ++index)
         {
+            const auto& bindGroupLayout = m_BindGroupLayoutPool.GetAt(index);
             uint64_t hash = CalculateBindGroupLayoutHash(&bindGroupLayout);
 
             if (layoutHash == hash && bindGroupLayout.DebugName != nullptr)
@@ -416,8 +395,6 @@ namespace HBL2
 
                 break;
             }
-
-            index++;
         }
 
         Handle<BindGroupLayout> layoutHandle = m_BindGroupLayoutPool.Insert(std::move(desc));
@@ -440,15 +417,7 @@ namespace HBL2
 
         if (bindGroupLayout->ReleaseRefAndMaybeDelete())
         {
-            m_DeletionQueue.Push(Renderer::Instance->GetFrameNumber(), [=, this]()
-            {
-                MetalBindGroupLayout* bindGroupLayout = GetBindGroupLayout(handle);
-                if (bindGroupLayout != nullptr)
-                {
-                    bindGroupLayout->Destroy();
-                    m_BindGroupLayoutPool.Remove(handle);
-                }
-            });
+            m_DeletionQueue.Push(Renderer::Instance->GetFrameNumber(), handle);
         }
     }
     uint64_t MetalResourceManager::GetBindGroupLayoutHash(Handle<BindGroupLayout> handle)
@@ -498,15 +467,7 @@ namespace HBL2
     }
     void MetalResourceManager::DeleteRenderPass(Handle<RenderPass> handle)
     {
-        m_DeletionQueue.Push(Renderer::Instance->GetFrameNumber(), [=, this]()
-        {
-            MetalRenderPass* renderPass = GetRenderPass(handle);
-            if (renderPass != nullptr)
-            {
-                renderPass->Destroy();
-                m_RenderPassPool.Remove(handle);
-            }
-        });
+        m_DeletionQueue.Push(Renderer::Instance->GetFrameNumber(), handle);
     }
     MetalRenderPass* MetalResourceManager::GetRenderPass(Handle<RenderPass> handle) const
     {
@@ -520,10 +481,7 @@ namespace HBL2
     }
     void MetalResourceManager::DeleteRenderPassLayout(Handle<RenderPassLayout> handle)
     {
-        m_DeletionQueue.Push(Renderer::Instance->GetFrameNumber(), [=, this]()
-        {
-            m_RenderPassLayoutPool.Remove(handle);
-        });
+        m_DeletionQueue.Push(Renderer::Instance->GetFrameNumber(), handle);
     }
     void MetalResourceManager::RecreateRenderPassFrameBuffer(Handle<RenderPass> handle, const FrameBufferDescriptor&& desc)
     {
@@ -538,6 +496,85 @@ namespace HBL2
     {
         return m_RenderPassLayoutPool.Get(handle);
     }
-}
-
 
+    // Batched deleters
+    void MetalResourceManager::DestroyTextures(Span<const Handle<Texture>> handles)
+    {
+        for (Handle<Texture> handle : handles)
+        {
+            MetalTexture* texture = GetTexture(handle);
+            if (texture != nullptr)
+            {
+                texture->Destroy();
+                m_TexturePool.Remove(handle);
+            }
+        }
+    }
+    void MetalResourceManager::DestroyBuffers(Span<const Handle<Buffer>> handles)
+    {
+        for (Handle<Buffer> handle : handles)
+        {
+            MetalBuffer buffer = GetBuffer(handle);
+            if (buffer.IsValid())
+            {
+                buffer.Destroy();
+                m_BufferSplitPool.Remove(handle);
+            }
+        }
+    }
+    void MetalResourceManager::DestroyShaders(Span<const Handle<Shader>> handles)
+    {
+        for (Handle<Shader> handle : handles)
+        {
+            MetalShader shader = GetShader(handle);
+            if (shader.IsValid())
+            {
+                shader.Destroy();
+                m_ShaderSplitPool.Remove(handle);
+            }
+        }
+    }
+    void MetalResourceManager::DestroyBindGroups(Span<const Handle<BindGroup>> handles)
+    {
+        for (Handle<BindGroup> handle : handles)
+        {
+            MetalBindGroupCold* bindGroupCold = GetBindGroupCold(handle);
+            if (bindGroupCold != nullptr)
+            {
+                bindGroupCold->Destroy();
+                m_BindGroupSplitPool.Remove(handle);
+            }
+        }
+    }
+    void MetalResourceManager::DestroyBindGroupLayouts(Span<const Handle<BindGroupLayout>> handles)
+    {
+        for (Handle<BindGroupLayout> handle : handles)
+        {
+            MetalBindGroupLayout* bindGroupLayout = GetBindGroupLayout(handle);
+            if (bindGroupLayout != nullptr)
+            {
+                bindGroupLayout->Destroy();
+                m_BindGroupLayoutPool.Remove(handle);
+            }
+        }
+    }
+    void MetalResourceManager::DestroyRenderPasses(Span<const Handle<RenderPass>> handles)
+    {
+        for (Handle<RenderPass> handle : handles)
+        {
+            MetalRenderPass* renderPass = GetRenderPass(handle);
+            if (renderPass != nullptr)
+            {
+                renderPass->Destroy();
+                m_RenderPassPool.Remove(handle);
+            }
+        }
+    }
+    void MetalResourceManager::DestroyRenderPassLayouts(Span<const Handle<RenderPassLayout>> handles)
+    {
+        for (Handle<RenderPassLayout> handle : handles)
+        {
+            m_RenderPassLayoutPool.Remove(handle);
+        }
+    }
+}
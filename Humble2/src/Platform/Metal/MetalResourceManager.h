@@ -86,6 +86,15 @@ namespace HBL2
         virtual void DeleteRenderPassLayout(Handle<RenderPassLayout> handle) override;
         MetalRenderPassLayout* GetRenderPassLayout(Handle<RenderPassLayout> handle) const;
 
+    protected:
+        virtual void DestroyTextures(Span<const Handle<Texture>> handles) override;
+        virtual void DestroyBuffers(Span<const Handle<Buffer>> handles) override;
+        virtual void DestroyShaders(Span<const Handle<Shader>> handles) override;
+        virtual void DestroyBindGroups(Span<const Handle<BindGroup>> handles) override;
+        virtual void DestroyBindGroupLayouts(Span<const Handle<BindGroupLayout>> handles) override;
+        virtual void DestroyRenderPasses(Span<const Handle<RenderPass>> handles) override;
+        virtual void DestroyRenderPassLayouts(Span<const Handle<RenderPassLayout>> handles) override;
+
     private:
         Pool<MetalTexture, Texture> m_TexturePool;
         SplitPool<MetalBufferHot, MetalBufferCold, Buffer> m_BufferSplitPool;
@@ -193,6 +193,10 @@ namespace HBL2
 		delete TempUniformRingBuffer;
 		TempUniformRingBuffer = nullptr;
 
+		TempInstanceRingBuffer->Free();
+		delete TempInstanceRingBuffer;
+		TempInstanceRingBuffer = nullptr;
+
 		m_ResourceManager->DeleteBindGroupLayout(m_ShadowBindingsLayout);
 		m_ResourceManager->DeleteBindGroupLayout(m_GlobalBindingsLayout2D);
 		m_ResourceManager->DeleteBindGroupLayout(m_GlobalBindingsLayout3D);
@@ -46,19 +46,15 @@ namespace HBL2
 	// Textures
 	Handle<Texture> OpenGLResourceManager::CreateTexture(const TextureDescriptor&& desc)
 	{
-		return m_TexturePool.Insert(std::forward<const TextureDescriptor>(desc));
+		Handle<Texture> handle = m_TexturePool.Insert(std::forward<const TextureDescriptor>(desc));
+		TrackTexture(handle, desc);
+		return handle;
 	}
 	void OpenGLResourceManager::DeleteTexture(Handle<Texture> handle)
 	{
-		m_DeletionQueue.Push(Renderer::Instance->GetFrameNumber(), [=]()
-		{
-			OpenGLTexture* texture = GetTexture(handle);
-			if (texture != nullptr)
-			{
-				texture->Destroy();
-				m_TexturePool.Remove(handle);
-			}
-		});
+		UntrackTexture(handle);
+
+		m_DeletionQueue.Push(Renderer::Instance->GetFrameNumber(), handle);
 	}
 	void OpenGLResourceManager::UpdateTexture(Handle<Texture> handle, const Span<const std::byte>& bytes)
 	{
@@ -107,24 +103,21 @@ namespace HBL2
 	// Buffers
 	Handle<Buffer> OpenGLResourceManager::CreateBuffer(const BufferDescriptor&& desc)
 	{
-		return m_BufferPool.Insert(std::forward<const BufferDescriptor>(desc));
+		Handle<Buffer> handle = m_BufferPool.Insert(std::forward<const BufferDescriptor>(desc));
+		TrackBuffer(handle, desc);
+		return handle;
 	}
 	void OpenGLResourceManager::DeleteBuffer(Handle<Buffer> handle)
 	{
-		m_DeletionQueue.Push(Renderer::Instance->GetFrameNumber(), [=]()
-		{
-			OpenGLBuffer* buffer = GetBuffer(handle);
-			if (buffer != nullptr)
-			{
-				buffer->Destroy();
-				m_BufferPool.Remove(handle);
-			}
-		});
+		UntrackBuffer(handle);
+
+		m_DeletionQueue.Push(Renderer::Instance->GetFrameNumber(), handle);
 	}
 	void OpenGLResourceManager::ReAllocateBuffer(Handle<Buffer> handle, uint32_t currentOffset)
 	{
 		OpenGLBuffer* buffer = GetBuffer(handle);
 		buffer->ReAllocate(currentOffset);
+		RetrackBuffer(handle, buffer->ByteSize);
 	}
 	void* OpenGLResourceManager::GetBufferData(Handle<Buffer> handle)
 	{
@@ -194,10 +187,15 @@ namespace HBL2
 	// Shaders
 	Handle<Shader> OpenGLResourceManager::CreateShader(const ShaderDescriptor&& desc)
 	{
-		return m_ShaderPool.Insert(std::forward<const ShaderDescriptor>(desc));
+		Handle<Shader> handle = m_ShaderPool.Insert(std::forward<const ShaderDescriptor>(desc));
+		TrackShader(handle, desc);
+		return handle;
 	}
 	void OpenGLResourceManager::RecompileShader(Handle<Shader> handle, const ShaderDescriptor&& desc)
 	{
+		UntrackShader(handle);
+		TrackShader(handle, desc);
+
 		OpenGLShader* shader = GetShader(handle);
 		if (shader != nullptr)
 		{
@@ -207,15 +205,9 @@ namespace HBL2
 	}
 	void OpenGLResourceManager::DeleteShader(Handle<Shader> handle)
 	{
-		m_DeletionQueue.Push(Renderer::Instance->GetFrameNumber(), [=]()
-		{
-			OpenGLShader* shader = GetShader(handle);
-			if (shader != nullptr)
-			{
-				shader->Destroy();
-				m_ShaderPool.Remove(handle);
-			}
-		});
+		UntrackShader(handle);
+
+		m_DeletionQueue.Push(Renderer::Instance->GetFrameNumber(), handle);
 	}
 	uint64_t OpenGLResourceManager::GetOrAddShaderVariant(Handle<Shader> handle, const ShaderDescriptor::RenderPipeline::PackedVariant& variantDesc)
 	{
@@ -243,10 +235,10 @@ namespace HBL2
 		// FIXME: When shared between multiple bindgroups and we delete it once, the other references become invalid!
 #if 0
 		// Caching mechanism so that materials with the same resources, use the same bind group.
-		uint16_t index = 0;
 
-		for (const auto& bindGroup : m_BindGroupPool.GetDataPool())
+		for (uint32_t index = 0; index < m_BindGroupPool.Capacity(); ++index)
 		{
+			const auto& bindGroup = m_BindGroupPool.GetAt(index);
 			uint64_t descriptorHash = ResourceManager::Instance->GetBindGroupHash(desc);
 
 			uint64_t hash = CalculateBindGroupHash(&bindGroup);
@@ -255,23 +247,13 @@ namespace HBL2
 			{
 				return m_BindGroupPool.GetHandleFromIndex(index);
 			}
-
-			index++;
 		}
 #endif
 		return m_BindGroupPool.Insert(std::forward<const BindGroupDescriptor>(desc));
 	}
 	void OpenGLResourceManager::DeleteBindGroup(Handle<BindGroup> handle)
 	{
-		m_DeletionQueue.Push(Renderer::Instance->GetFrameNumber(), [=]()
-		{
-			OpenGLBindGroup* bindGroup = GetBindGroup(handle);
-			if (bindGroup != nullptr)
-			{
-				bindGroup->Destroy();
-				m_BindGroupPool.Remove(handle);
-			}
-		});
+		m_DeletionQueue.Push(Renderer::Instance->GetFrameNumber(), handle);
 	}
 	void OpenGLResourceManager::UpdateBindGroup(Handle<BindGroup> handle) {}
 	uint64_t OpenGLResourceManager::GetBindGroupHash(Handle<BindGroup> handle)
@@ -390,4 +372,75 @@ namespace HBL2
 	{
 		return m_RenderPassLayoutPool.Get(handle);
 	}
+
+	// Batched deleters
+	void OpenGLResourceManager::DestroyTextures(Span<const Handle<Texture>> handles)
+	{
+		for (Handle<Texture> handle : handles)
+		{
+			OpenGLTexture* texture = GetTexture(handle);
+			if (texture != nullptr)
+			{
+				texture->Destroy();
+				m_TexturePool.Remove(handle);
+			}
+		}
+	}
+	void OpenGLResourceManager::DestroyBuffers(Span<const Handle<Buffer>> handles)
+	{
+		for (Handle<Buffer> handle : handles)
+		{
+			OpenGLBuffer* buffer = GetBuffer(handle);
+			if (buffer != nullptr)
+			{
+				buffer->Destroy();
+				m_BufferPool.Remove(handle);
+			}
+		}
+	}
+	void OpenGLResourceManager::DestroyShaders(Span<const Handle<Shader>> handles)
+	{
+		for (Handle<Shader> handle : handles)
+		{
+			OpenGLShader* shader = GetShader(handle);
+			if (shader != nullptr)
+			{
+				shader->Destroy();
+				m_ShaderPool.Remove(handle);
+			}
+		}
+	}
+	void OpenGLResourceManager::DestroyBindGroups(Span<const Handle<BindGroup>> handles)
+	{
+		for (Handle<BindGroup> handle : handles)
+		{
+			OpenGLBindGroup* bindGroup = GetBindGroup(handle);
+			if (bindGroup != nullptr)
+			{
+				bindGroup->Destroy();
+				m_BindGroupPool.Remove(handle);
+			}
+		}
+	}
+	void OpenGLResourceManager::DestroyBindGroupLayouts(Span<const Handle<BindGroupLayout>> handles)
+	{
+		for (Handle<BindGroupLayout> handle : handles)
+		{
+			m_BindGroupLayoutPool.Remove(handle);
+		}
+	}
+	void OpenGLResourceManager::DestroyRenderPasses(Span<const Handle<RenderPass>> handles)
+	{
+		for (Handle<RenderPass> handle : handles)
+		{
+			m_RenderPassPool.Remove(handle);
+		}
+	}
+	void OpenGLResourceManager::DestroyRenderPassLayouts(Span<const Handle<RenderPassLayout>> handles)
+	{
+		for (Handle<RenderPassLayout> handle : handles)
+		{
+			m_RenderPassLayoutPool.Remove(handle);
+		}
+	}
 }
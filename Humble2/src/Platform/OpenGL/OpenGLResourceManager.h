@@ -79,6 +79,17 @@ namespace HBL2
 		virtual void DeleteRenderPassLayout(Handle<RenderPassLayout> handle) override;
 		OpenGLRenderPassLayout* GetRenderPassLayout(Handle<RenderPassLayout> handle) const;
 
+	protected:
+		// Layouts and render passes own no GL objects and are still removed right away in Delete*,
+		// their batched deleters only exist for handles pushed to the deletion queue explicitly.
+		virtual void DestroyTextures(Span<const Handle<Texture>> handles) override;
+		virtual void DestroyBuffers(Span<const Handle<Buffer>> handles) override;
+		virtual void DestroyShaders(Span<const Handle<Shader>> handles) override;
+		virtual void DestroyBindGroups(Span<const Handle<BindGroup>> handles) override;
+		virtual void DestroyBindGroupLayouts(Span<const Handle<BindGroupLayout>> handles) override;
+		virtual void DestroyRenderPasses(Span<const Handle<RenderPass>> handles) override;
+		virtual void DestroyRenderPassLayouts(Span<const Handle<RenderPassLayout>> handles) override;
+
 	private:
 		Pool<OpenGLTexture, Texture> m_TexturePool;
 		Pool<OpenGLBuffer, Buffer> m_BufferPool;
@@ -48,44 +48,20 @@ namespace HBL2
 		{
 			Hot->Data = desc.initialData;
 
-			VkBuffer stagingBuffer = VK_NULL_HANDLE;
-			VmaAllocation stagingBufferAllocation = VK_NULL_HANDLE;
+			VkBuffer destination = Hot->Buffer;
+			VkDeviceSize byteSize = Hot->ByteSize;
 
-			VkBufferCreateInfo stagingBufferCreateInfo =
-			{
-				.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
-				.size = Hot->ByteSize,
-				.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-				.sharingMode = VK_SHARING_MODE_EXCLUSIVE,
-				.queueFamilyIndexCount = 0,
-				.pQueueFamilyIndices = nullptr,
-			};
-
-			VmaAllocationCreateInfo vmaStagingAllocCreateInfo =
-			{
-				.usage = VMA_MEMORY_USAGE_CPU_ONLY,
-			};
-
-			VK_VALIDATE(vmaCreateBuffer(renderer->GetAllocator(), &stagingBufferCreateInfo, &vmaStagingAllocCreateInfo, &stagingBuffer, &stagingBufferAllocation, nullptr), "vmaCreateBuffer");
-
-			void* mappedData;
-			vmaMapMemory(renderer->GetAllocator(), stagingBufferAllocation, &mappedData);
-			memcpy(mappedData, Hot->Data, Hot->ByteSize);
-			vmaUnmapMemory(renderer->GetAllocator(), stagingBufferAllocation);
-
-			renderer->ImmediateSubmit([=, this](VkCommandBuffer cmd)
+			renderer->GetUploader().Upload(Hot->Data, Hot->ByteSize, [=](VkCommandBuffer cmd, VkBuffer stagingBuffer, VkDeviceSize stagingOffset)
 			{
 				VkBufferCopy copy =
 				{
-					.srcOffset = 0,
+					.srcOffset = stagingOffset,
 					.dstOffset = 0,
-					.size = Hot->ByteSize,
+					.size = byteSize,
 				};
 
-				vkCmdCopyBuffer(cmd, stagingBuffer, Hot->Buffer, 1, &copy);
+				vkCmdCopyBuffer(cmd, stagingBuffer, destination, 1, &copy);
 			});
-
-			vmaDestroyBuffer(renderer->GetAllocator(), stagingBuffer, stagingBufferAllocation);
 		}
 	}
 
@@ -125,23 +101,16 @@ namespace HBL2
 		// Check if there is existing data to copy from the old buffer
 		if (oldBuffer != VK_NULL_HANDLE && currentOffset > 0)
 		{
-			renderer->ImmediateSubmit([=, this](VkCommandBuffer cmd)
-			{
-				VkBufferCopy copyRegion =
-				{
-					.srcOffset = 0,
-					.dstOffset = 0,
-					.size = currentOffset,  // Copy up to currentOffset bytes
-				};
-
-				vkCmdCopyBuffer(cmd, oldBuffer, Hot->Buffer, 1, &copyRegion);
-			});
+			renderer->GetUploader().CopyBuffer(oldBuffer, Hot->Buffer, currentOffset); // Copy up to currentOffset bytes
 		}
 
 		Hot->ByteSize = Hot->ByteSize * 2;
 
-		// Destroy the old buffer
-		vmaDestroyBuffer(renderer->GetAllocator(), oldBuffer, oldAllocation);
+		// Destroy the old buffer once the copy out of it has completed.
+		if (oldBuffer != VK_NULL_HANDLE)
+		{
+			renderer->GetUploader().DestroyAfterUpload(oldBuffer, oldAllocation);
+		}
 	}
 
 	void VulkanBuffer::Destroy()
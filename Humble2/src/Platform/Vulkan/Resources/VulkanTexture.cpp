@@ -65,46 +65,19 @@ namespace HBL2
 
 		if (desc.initialData == nullptr && Extent.width == 1 && Extent.height == 1)
 		{
-			VkBuffer stagingBuffer = VK_NULL_HANDLE;
-			VmaAllocation stagingBufferAllocation = VK_NULL_HANDLE;
+			uint32_t whiteTexture[4] = { 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff };
 
-			CreateStagingBuffer(renderer, &stagingBuffer, &stagingBufferAllocation);
-
-			VkDeviceSize imageSize = Extent.width * Extent.height * m_PixelByteSize;
-
-			uint32_t whiteTexture = 0xffffffff;
-
-			// Transfer initiaData to staging buffer
-			void* mappedData;
-			vmaMapMemory(renderer->GetAllocator(), stagingBufferAllocation, &mappedData);
-			memcpy(mappedData, &whiteTexture, (size_t)imageSize);
-			vmaUnmapMemory(renderer->GetAllocator(), stagingBufferAllocation);
-
-			CopyBufferToTexture(renderer, stagingBuffer);
-
-			vmaDestroyBuffer(renderer->GetAllocator(), stagingBuffer, stagingBufferAllocation);
+			UploadToTexture(renderer, whiteTexture, Extent.width * Extent.height * m_PixelByteSize);
 		}
 		else if (desc.initialData != nullptr)
 		{
-			VkBuffer stagingBuffer = VK_NULL_HANDLE;
-			VmaAllocation stagingBufferAllocation = VK_NULL_HANDLE;
-
-			CreateStagingBuffer(renderer, &stagingBuffer, &stagingBufferAllocation);
-
 			VkDeviceSize faceSize = Extent.width * Extent.height * m_PixelByteSize;
 			VkDeviceSize imageSize = faceSize * (ImageType == TextureType::CUBE ? 6 : LayerCount);
 
-			// Transfer initiaData to staging buffer
-			void* mappedData;
-			vmaMapMemory(renderer->GetAllocator(), stagingBufferAllocation, &mappedData);
-			memcpy(mappedData, desc.initialData, (size_t)imageSize);
-			vmaUnmapMemory(renderer->GetAllocator(), stagingBufferAllocation);
+			// The bytes are copied into the staging ring right away, so the pixels can be freed before the upload runs.
+			UploadToTexture(renderer, desc.initialData, imageSize);
 
 			stbi_image_free(desc.initialData);
-
-			CopyBufferToTexture(renderer, stagingBuffer);
-
-			vmaDestroyBuffer(renderer->GetAllocator(), stagingBuffer, stagingBufferAllocation);
 		}
 
 		// Allocate ImageView
@@ -164,23 +137,10 @@ namespace HBL2
 	{
 		VulkanRenderer* renderer = (VulkanRenderer*)Renderer::Instance;
 
-		VkBuffer stagingBuffer = VK_NULL_HANDLE;
-		VmaAllocation stagingBufferAllocation = VK_NULL_HANDLE;
-
-		CreateStagingBuffer(renderer, &stagingBuffer, &stagingBufferAllocation);
-
 		VkDeviceSize faceSize = Extent.width * Extent.height * m_PixelByteSize;
 		VkDeviceSize imageSize = faceSize * (ImageType == TextureType::CUBE ? 6 : LayerCount);
 
-		// Transfer initiaData to staging buffer
-		void* mappedData;
-		vmaMapMemory(renderer->GetAllocator(), stagingBufferAllocation, &mappedData);
-		memcpy(mappedData, bytes.Data(), (size_t)imageSize);
-		vmaUnmapMemory(renderer->GetAllocator(), stagingBufferAllocation);
-
-		CopyBufferToTexture(renderer, stagingBuffer);
-
-		vmaDestroyBuffer(renderer->GetAllocator(), stagingBuffer, stagingBufferAllocation);
+		UploadToTexture(renderer, bytes.Data(), imageSize);
 	}
 
 	void VulkanTexture::ChangeTextureView(const TextureViewDescriptor&& desc)
@@ -235,37 +195,16 @@ namespace HBL2
 		vmaDestroyImage(renderer->GetAllocator(), Image, Allocation);
 	}
 
-	void VulkanTexture::CreateStagingBuffer(VulkanRenderer* renderer, VkBuffer* stagingBuffer, VmaAllocation* stagingBufferAllocation)
+	void VulkanTexture::UploadToTexture(VulkanRenderer* renderer, const void* data, VkDeviceSize size)
 	{
-		// Allocate staging buffer
+		// Copy the data through the staging ring to the GPU memory of Image, the copy is submitted with the next upload batch.
+		VkImage image = Image;
+		VkExtent3D extent = Extent;
+		uint32_t faceCount = (ImageType == TextureType::CUBE ? 6 : LayerCount);
 		VkDeviceSize faceSize = Extent.width * Extent.height * m_PixelByteSize;
-		VkDeviceSize imageSize = faceSize * (ImageType == TextureType::CUBE ? 6 : LayerCount);
-
-		VkBufferCreateInfo stagingBufferCreateInfo =
-		{
-			.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
-			.size = imageSize,
-			.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-			.sharingMode = VK_SHARING_MODE_EXCLUSIVE,
-			.queueFamilyIndexCount = 0,
-			.pQueueFamilyIndices = nullptr,
-		};
-
-		VmaAllocationCreateInfo vmaStagingAllocCreateInfo =
-		{
-			.usage = VMA_MEMORY_USAGE_CPU_ONLY,
-		};
-
-		VK_VALIDATE(vmaCreateBuffer(renderer->GetAllocator(), &stagingBufferCreateInfo, &vmaStagingAllocCreateInfo, stagingBuffer, stagingBufferAllocation, nullptr), "vmaCreateBuffer");
-	}
 
-	void VulkanTexture::CopyBufferToTexture(VulkanRenderer* renderer, VkBuffer stagingBuffer)
-	{
-		// Copy the data of the staging buffer to the GPU memory of Image
-		renderer->ImmediateSubmit([=, this](VkCommandBuffer cmd)
+		renderer->GetUploader().Upload(data, size, [=](VkCommandBuffer cmd, VkBuffer stagingBuffer, VkDeviceSize stagingOffset)
 		{
-			uint32_t faceCount = (ImageType == TextureType::CUBE ? 6 : LayerCount);
-
 			VkImageSubresourceRange range =
 			{
 				.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
@@ -282,20 +221,19 @@ namespace HBL2
 				.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT,
 				.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED,
 				.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-				.image = Image,
+				.image = image,
 				.subresourceRange = range,
 			};
 
 			vkCmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr, 1, &imageBarrierToTransfer);
 
-			VkDeviceSize faceSize = Extent.width * Extent.height * m_PixelByteSize;
 			StaticArray<VkBufferImageCopy, 6> copyRegions{};
 
 			for (uint32_t face = 0; face < faceCount; ++face)
 			{
 				copyRegions[face] =
 				{
-					.bufferOffset = faceSize * face,
+					.bufferOffset = stagingOffset + faceSize * face,
 					.bufferRowLength = 0,
 					.bufferImageHeight = 0,
 					.imageSubresource =
@@ -305,11 +243,11 @@ namespace HBL2
 						.baseArrayLayer = face,
 						.layerCount = 1,
 					},
-					.imageExtent = Extent,
+					.imageExtent = extent,
 				};
 			}
 
-			vkCmdCopyBufferToImage(cmd, stagingBuffer, Image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, faceCount, copyRegions.Data());
+			vkCmdCopyBufferToImage(cmd, stagingBuffer, image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, faceCount, copyRegions.Data());
 
 			VkImageMemoryBarrier imageBarrierToReadable =
 			{
@@ -318,7 +256,7 @@ namespace HBL2
 				.dstAccessMask = VK_ACCESS_SHADER_READ_BIT,
 				.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
 				.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
-				.image = Image,
+				.image = image,
 				.subresourceRange = range,
 			};
 
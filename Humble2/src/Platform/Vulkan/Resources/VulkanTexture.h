@@ -35,8 +35,7 @@ namespace HBL2
 		VkImageAspectFlags Aspect = 0;
 
 	private:
-		void CreateStagingBuffer(VulkanRenderer* renderer, VkBuffer* stagingBuffer, VmaAllocation* stagingBufferAllocation);
-		void CopyBufferToTexture(VulkanRenderer* renderer, VkBuffer stagingBuffer);
+		void UploadToTexture(VulkanRenderer* renderer, const void* data, VkDeviceSize size);
 
 		friend class Pool<VulkanTexture, Texture>; // This is required for a hack to create the swapchain images in the VulkanRenderer
 		VulkanTexture(const VulkanTexture&& other) noexcept;
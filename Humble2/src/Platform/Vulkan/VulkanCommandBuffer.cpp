@@ -134,6 +134,9 @@ namespace HBL2
     {
 		VulkanRenderer* renderer = (VulkanRenderer*)Renderer::Instance;
 
+		// Pending uploads go first, this command buffer may read resources created since the last submission.
+		renderer->GetUploader().Submit();
+
 		VkPipelineStageFlags waitStage = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
 
 		VkSubmitInfo submitInfo =
@@ -42,6 +42,12 @@ namespace HBL2
 			{
 				VulkanBufferHot* buffer = rm->GetBufferHot(bufferEntry.buffer);
 
+				// Nothing set this frame (e.g.: the light clusters when clustered lighting is off), keep the old contents.
+				if (buffer->Data == nullptr)
+				{
+					continue;
+				}
+
 				void* data;
 				vmaMapMemory(renderer->GetAllocator(), buffer->Allocation, &data);
 				memcpy(data, buffer->Data, buffer->ByteSize);
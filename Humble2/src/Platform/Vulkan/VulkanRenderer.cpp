@@ -3,6 +3,8 @@
 #include "VulkanDevice.h"
 #include "VulkanResourceManager.h"
 
+#include "Renderer/LightClusters.h"
+
 #include <imgui_impl_vulkan.h>
 
 #define GLFW_INCLUDE_NONE
@@ -13,8 +15,6 @@
 
 namespace HBL2
 {
-	thread_local UploadContext VulkanRenderer::s_UploadContext;
-
 	void VulkanRenderer::PreInitialize()
 	{
 		m_GraphicsAPI = GraphicsAPI::VULKAN;
@@ -27,6 +27,9 @@ namespace HBL2
 
 		CreateAllocator();
 
+		// Staging ring shared by all buffer and texture uploads, bigger uploads get a dedicated staging buffer.
+		m_Uploader.Initialize(this, 64 * 1024 * 1024);
+
 		CreateSwapchain();
 		CreateImageViews();
 		CreateSyncStructures();
@@ -59,6 +62,42 @@ namespace HBL2
 				.initialData = nullptr,
 			});
 
+			auto clusterGridBuffer = m_ResourceManager->CreateBuffer({
+				.debugName = "cluster-grid-uniform-buffer",
+				.usage = BufferUsage::UNIFORM,
+				.usageHint = BufferUsageHint::DYNAMIC,
+				.memoryUsage = MemoryUsage::GPU_CPU,
+				.byteSize = sizeof(ClusterGridData),
+				.initialData = nullptr,
+			});
+
+			auto clusterLightBuffer = m_ResourceManager->CreateBuffer({
+				.debugName = "cluster-light-storage-buffer",
+				.usage = BufferUsage::STORAGE,
+				.usageHint = BufferUsageHint::DYNAMIC,
+				.memoryUsage = MemoryUsage::GPU_CPU,
+				.byteSize = LightClusters::MaxLights * sizeof(ClusterLight),
+				.initialData = nullptr,
+			});
+
+			auto clusterRangeBuffer = m_ResourceManager->CreateBuffer({
+				.debugName = "cluster-range-storage-buffer",
+				.usage = BufferUsage::STORAGE,
+				.usageHint = BufferUsageHint::DYNAMIC,
+				.memoryUsage = MemoryUsage::GPU_CPU,
+				.byteSize = LightClusters::ClusterCount * sizeof(glm::uvec2),
+				.initialData = nullptr,
+			});
+
+			auto clusterIndexBuffer = m_ResourceManager->CreateBuffer({
+				.debugName = "cluster-index-storage-buffer",
+				.usage = BufferUsage::STORAGE,
+				.usageHint = BufferUsageHint::DYNAMIC,
+				.memoryUsage = MemoryUsage::GPU_CPU,
+				.byteSize = LightClusters::MaxLightIndices * sizeof(uint32_t),
+				.initialData = nullptr,
+			});
+
 			m_VkFrames[i].GlobalBindings3D = m_ResourceManager->CreateBindGroup({
 				.debugName = "global-bind-group",
 				.layout = m_GlobalBindingsLayout3D,
@@ -66,6 +105,10 @@ namespace HBL2
 				.buffers = {
 					{ .buffer = cameraBuffer3D },
 					{ .buffer = lightBuffer },
+					{ .buffer = clusterGridBuffer },
+					{ .buffer = clusterLightBuffer },
+					{ .buffer = clusterRangeBuffer },
+					{ .buffer = clusterIndexBuffer },
 				}
 			});
 		}
@@ -96,6 +139,9 @@ namespace HBL2
 		// Flush any pending deletions that occured in the frames before the current one.
 		m_ResourceManager->Flush(m_FrameNumber.load());
 
+		// Send uploads recorded since the last submission and recycle the staging space of the completed ones.
+		m_Uploader.Submit();
+
 		// Get the next swap chain image from the implementation.
 		// Note that the implementation is free to return the images in any order, so we must use the acquire function and can't just cycle through the images/imageIndex on our own.
 		VkResult result = vkAcquireNextImageKHR(m_Device->Get(), m_SwapChain, UINT64_MAX, GetCurrentFrame().ImageAvailableSemaphore, nullptr, &m_SwapchainImageIndex);
@@ -233,8 +279,14 @@ namespace HBL2
 		delete TempUniformRingBuffer;
 		TempUniformRingBuffer = nullptr;
 
+		TempInstanceRingBuffer->Free();
+		delete TempInstanceRingBuffer;
+		TempInstanceRingBuffer = nullptr;
+
 		m_ResourceManager->FlushAll();
 
+		m_Uploader.Clean();
+
 		vmaDestroyAllocator(m_Allocator);
 	}
 
@@ -285,58 +337,6 @@ namespace HBL2
 		return vkCmdObj;
 	}
 
-	void VulkanRenderer::ImmediateSubmit(std::function<void(VkCommandBuffer cmd)>&& function)
-	{
-		if (s_UploadContext.CommandBuffer == VK_NULL_HANDLE)
-		{
-			CreateUploadContextCommands();
-		}
-
-		VkCommandBuffer cmd = s_UploadContext.CommandBuffer;
-
-		// begin the command buffer recording. We will use this command buffer exactly once before resetting, so we tell vulkan that.
-		VkCommandBufferBeginInfo cmdBeginInfo =
-		{
-			.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
-			.pNext = nullptr,
-			.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT,
-			.pInheritanceInfo = nullptr,
-		};		
-
-		VK_VALIDATE(vkBeginCommandBuffer(cmd, &cmdBeginInfo), "vkBeginCommandBuffer");
-
-		// excecute function
-		function(cmd);
-
-		VK_VALIDATE(vkEndCommandBuffer(cmd), "vkEndCommandBuffer");
-
-		VkSubmitInfo submit =
-		{
-			.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO,
-			.pNext = nullptr,
-			.waitSemaphoreCount = 0,
-			.pWaitSemaphores = nullptr,
-			.pWaitDstStageMask = nullptr,
-			.commandBufferCount = 1,
-			.pCommandBuffers = &cmd,
-			.signalSemaphoreCount = 0,
-			.pSignalSemaphores = nullptr,
-		};
-
-		// Submit command buffer to the queue and execute it.
-		// UploadFence will now block until the graphic commands finish execution
-		{
-			std::lock_guard<std::mutex> lock(m_GraphicsQueueSubmitMutex);
-			VK_VALIDATE(vkQueueSubmit(m_GraphicsQueue, 1, &submit, s_UploadContext.UploadFence), "vkQueueSubmit");
-		}
-
-		vkWaitForFences(m_Device->Get(), 1, &s_UploadContext.UploadFence, true, UINT64_MAX);
-		vkResetFences(m_Device->Get(), 1, &s_UploadContext.UploadFence);
-
-		// Reset the command buffers inside the command pool
-		vkResetCommandPool(m_Device->Get(), s_UploadContext.CommandPool, 0);
-	}
-
 	void VulkanRenderer::Resize(uint32_t width, uint32_t height)
 	{
 		if (width == 0 || height == 0)
@@ -723,60 +723,6 @@ namespace HBL2
 				.signalSemaphore = VK_NULL_HANDLE, // Set at BeginFrame.
 			});
 		}
-
-		CreateUploadContextCommands();
-	}
-
-	void VulkanRenderer::CreateUploadContextCommands()
-	{
-		// Create the upload fence.
-		VkFenceCreateInfo uploadFenceCreateInfo =
-		{
-			.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO,
-			.pNext = nullptr,
-		};
-
-		VK_VALIDATE(vkCreateFence(m_Device->Get(), &uploadFenceCreateInfo, nullptr, &s_UploadContext.UploadFence), "vkCreateFence");
-		
-		const QueueFamilyIndices& indices = m_Device->GetQueueFamilyIndices();
-		
-		// Create command buffer pool.
-		VkCommandPoolCreateInfo uploadCommandPoolInfo =
-		{
-			.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO,
-			.pNext = nullptr,
-			.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT,
-			.queueFamilyIndex = indices.graphicsFamily.value(),
-		};		
-
-		VK_VALIDATE(vkCreateCommandPool(m_Device->Get(), &uploadCommandPoolInfo, nullptr, &s_UploadContext.CommandPool), "vkCreateCommandPool");
-
-
-		// Allocate the default command buffer that we will use for the instant commands
-		VkCommandBufferAllocateInfo cmdAllocInfo =
-		{
-			.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
-			.pNext = nullptr,
-			.commandPool = s_UploadContext.CommandPool,
-			.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY,
-			.commandBufferCount = 1,
-		};		
-
-		VK_VALIDATE(vkAllocateCommandBuffers(m_Device->Get(), &cmdAllocInfo, &s_UploadContext.CommandBuffer), "vkAllocateCommandBuffers");
-		
-		// Copy upload context to correctly capture it by value in the lambda.
-		auto ctx = s_UploadContext;
-		
-		// Queue resources for deletion.
-		{
-			std::lock_guard<std::mutex> lock(m_DeletionQueueMutex);
-
-			m_MainDeletionQueue.PushFunction([this, ctx]()
-			{
-				vkDestroyCommandPool(m_Device->Get(), ctx.CommandPool, nullptr);
-				vkDestroyFence(m_Device->Get(), ctx.UploadFence, nullptr);
-			});
-		}
 	}
 
 	void VulkanRenderer::CreateRenderPasses()
@@ -888,6 +834,7 @@ namespace HBL2
 		{
 			{ VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, poolSize },
 			{ VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC, poolSize },
+			{ VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, poolSize },
 			{ VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, poolSize },
 			{ VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, poolSize },
 		};
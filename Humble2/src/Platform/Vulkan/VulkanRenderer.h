@@ -7,6 +7,7 @@
 #include "Renderer/Renderer.h"
 
 #include "VulkanCommandBuffer.h"
+#include "VulkanUploader.h"
 
 #include "VulkanCommon.h"
 
@@ -35,13 +36,6 @@ namespace HBL2
 		Handle<BindGroup> GlobalPresentBindings;
 	};
 
-	struct UploadContext
-	{
-		VkFence UploadFence = VK_NULL_HANDLE;
-		VkCommandPool CommandPool = VK_NULL_HANDLE;
-		VkCommandBuffer CommandBuffer = VK_NULL_HANDLE;
-	};
-
 	class VulkanRenderer final : public Renderer
 	{
 	public:
@@ -80,7 +74,7 @@ namespace HBL2
 
 		const VkDescriptorPool& GetDescriptorPool() const { return m_DescriptorPool; }
 
-		void ImmediateSubmit(std::function<void(VkCommandBuffer cmd)>&& function);
+		VulkanUploader& GetUploader() { return m_Uploader; }
 
 		void Resize(uint32_t width, uint32_t height);
 
@@ -94,7 +88,6 @@ namespace HBL2
 		void CreateImageViews();
 		void CreateSyncStructures();
 		void CreateCommands();
-		void CreateUploadContextCommands();
 		void CreateRenderPasses();
 		void CreateDescriptorPool();
 		void CreateDescriptorSets();
@@ -109,6 +102,7 @@ namespace HBL2
 		VulkanDevice* m_Device;
 		VulkanResourceManager* m_ResourceManager;
 		VmaAllocator m_Allocator;
+		VulkanUploader m_Uploader;
 		DeletionQueue m_MainDeletionQueue;
 
 		VkFrameData m_VkFrames[FRAME_OVERLAP];
@@ -116,7 +110,6 @@ namespace HBL2
 		
 		VulkanCommandBuffer m_MainCommandBuffers[FRAME_OVERLAP];
 		VulkanCommandBuffer m_ImGuiCommandBuffers[FRAME_OVERLAP];
-		static thread_local UploadContext s_UploadContext;
 
 		uint32_t m_SwapchainImageIndex = 0;
 
@@ -44,19 +44,15 @@ namespace HBL2
 	// Textures
 	Handle<Texture> VulkanResourceManager::CreateTexture(const TextureDescriptor&& desc)
 	{
-		return m_TexturePool.Insert(std::forward<const TextureDescriptor>(desc));
+		Handle<Texture> handle = m_TexturePool.Insert(std::forward<const TextureDescriptor>(desc));
+		TrackTexture(handle, desc);
+		return handle;
 	}
 	void VulkanResourceManager::DeleteTexture(Handle<Texture> handle)
 	{
-		m_DeletionQueue.Push(Renderer::Instance->GetFrameNumber(), [=, this]()
-		{
-			VulkanTexture* texture = GetTexture(handle);
-			if (texture != nullptr)
-			{
-				texture->Destroy();
-				m_TexturePool.Remove(handle);
-			}
-		});
+		UntrackTexture(handle);
+
+		m_DeletionQueue.Push(Renderer::Instance->GetFrameNumber(), handle);
 	}
 	void VulkanResourceManager::UpdateTexture(Handle<Texture> handle, const Span<const std::byte>& bytes)
 	{
@@ -107,24 +103,24 @@ namespace HBL2
 		VulkanBuffer buffer;
 		Handle<Buffer> bufferHandle = m_BufferSplitPool.Insert(&buffer.Hot, &buffer.Cold);
 		buffer.Initialize(std::forward<const BufferDescriptor>(desc));
+		TrackBuffer(bufferHandle, desc);
 		return bufferHandle;
 	}
 	void VulkanResourceManager::DeleteBuffer(Handle<Buffer> handle)
 	{
-		m_DeletionQueue.Push(Renderer::Instance->GetFrameNumber(), [=, this]()
-		{
-			VulkanBuffer buffer = GetBuffer(handle);
-			if (buffer.IsValid())
-			{
-				buffer.Destroy();
-				m_BufferSplitPool.Remove(handle);
-			}
-		});
+		UntrackBuffer(handle);
+
+		m_DeletionQueue.Push(Renderer::Instance->GetFrameNumber(), handle);
 	}
 	void VulkanResourceManager::ReAllocateBuffer(Handle<Buffer> handle, uint32_t currentOffset)
 	{
 		VulkanBuffer buffer = GetBuffer(handle);
 		buffer.ReAllocate(currentOffset);
+
+		if (buffer.IsValid())
+		{
+			RetrackBuffer(handle, buffer.Hot->ByteSize);
+		}
 	}
 	void* VulkanResourceManager::GetBufferData(Handle<Buffer> handle)
 	{
@@ -203,10 +199,14 @@ namespace HBL2
 		VulkanShader shader;
 		Handle<Shader> shaderHandle = m_ShaderSplitPool.Insert(&shader.Hot, &shader.Cold);
 		shader.Initialize(std::forward<const ShaderDescriptor>(desc));
+		TrackShader(shaderHandle, desc);
 		return shaderHandle;
 	}
 	void VulkanResourceManager::RecompileShader(Handle<Shader> handle, const ShaderDescriptor&& desc)
 	{
+		UntrackShader(handle);
+		TrackShader(handle, desc);
+
 		VulkanShader shader = GetShader(handle);
 		shader.Recompile(std::forward<const ShaderDescriptor>(desc), true);
 
@@ -218,15 +218,9 @@ namespace HBL2
 	}
 	void VulkanResourceManager::DeleteShader(Handle<Shader> handle)
 	{
-		m_DeletionQueue.Push(Renderer::Instance->GetFrameNumber(), [=, this]()
-		{
-			VulkanShader shader = GetShader(handle);
-			if (shader.IsValid())
-			{
-				shader.Destroy();
-				m_ShaderSplitPool.Remove(handle);
-			}
-		});
+		UntrackShader(handle);
+
+		m_DeletionQueue.Push(Renderer::Instance->GetFrameNumber(), handle);
 	}
 	uint64_t VulkanResourceManager::GetOrAddShaderVariant(Handle<Shader> handle, const ShaderDescriptor::RenderPipeline::PackedVariant& variantDesc)
 	{
@@ -276,11 +270,11 @@ namespace HBL2
 	Handle<BindGroup> VulkanResourceManager::CreateBindGroup(const BindGroupDescriptor&& desc)
 	{
 		// Caching mechanism so that materials with the same resources, use the same bind group.
-		uint16_t index = 0;
 		uint64_t descriptorHash = ResourceManager::Instance->GetBindGroupHash(std::move(desc));
 
-		for (const auto& bindGroup : m_BindGroupSplitPool.GetDataColdPool())
+		for (uint32_t index = 0; index < m_BindGroupSplitPool.Capacity(); ++index)
 		{
+			const auto& bindGroup = m_BindGroupSplitPool.GetColdAt(index);
 			uint64_t hash = CalculateBindGroupHash(&bindGroup);
 
 			if (descriptorHash == hash && bindGroup.DebugName != nullptr)
@@ -293,8 +287,6 @@ namespace HBL2
 
 				break;
 			}
-
-			index++;
 		}
 
 		VulkanBindGroup bindgroup;
@@ -324,15 +316,7 @@ namespace HBL2
 
 		if (bindGroupCold->ReleaseRefAndMaybeDelete())
 		{
-			m_DeletionQueue.Push(Renderer::Instance->GetFrameNumber(), [=, this]()
-			{
-				VulkanBindGroupCold* bindGroupCold = GetBindGroupCold(handle);
-				if (bindGroupCold != nullptr)
-				{
-					bindGroupCold->Destroy();
-					m_BindGroupSplitPool.Remove(handle);
-				}
-			});
+			m_DeletionQueue.Push(Renderer::Instance->GetFrameNumber(), handle);
 		}
 	}
 	void VulkanResourceManager::UpdateBindGroup(Handle<BindGroup> handle)
@@ -398,11 +382,11 @@ namespace HBL2
 	Handle<BindGroupLayout> VulkanResourceManager::CreateBindGroupLayout(const BindGroupLayoutDescriptor&& desc)
 	{
 		// Caching mechanism so that bind groups and shaders with the same layout, use the same bind group layout object.
-		uint16_t index = 0;
 		uint64_t layoutHash = ResourceManager::Instance->GetBindGroupLayoutHash(std::move(desc));
 
-		for (const auto& bindGroupLayout : m_BindGroupLayoutPool.GetDataPool())
+		for (uint32_t index = 0; index < m_BindGroupLayoutPool.Capacity(); ++index)
 		{
+			const auto& bindGroupLayout = m_BindGroupLayoutPool.GetAt(index);
 			uint64_t hash = CalculateBindGroupLayoutHash(&bindGroupLayout);
 
 			if (layoutHash == hash && bindGroupLayout.DebugName != nullptr)
@@ -415,8 +399,6 @@ namespace HBL2
 
 				break;
 			}
-
-			index++;
 		}
 
 		Handle<BindGroupLayout> layoutHandle = m_BindGroupLayoutPool.Insert(std::move(desc));
@@ -439,15 +421,7 @@ namespace HBL2
 
 		if (bindGroupLayout->ReleaseRefAndMaybeDelete())
 		{
-			m_DeletionQueue.Push(Renderer::Instance->GetFrameNumber(), [=, this]()
-			{
-				VulkanBindGroupLayout* bindGroupLayout = GetBindGroupLayout(handle);
-				if (bindGroupLayout != nullptr)
-				{
-					bindGroupLayout->Destroy();
-					m_BindGroupLayoutPool.Remove(handle);
-				}
-			});
+			m_DeletionQueue.Push(Renderer::Instance->GetFrameNumber(), handle);
 		}
 	}
 	uint64_t VulkanResourceManager::GetBindGroupLayoutHash(Handle<BindGroupLayout> handle)
@@ -497,15 +471,7 @@ namespace HBL2
 	}
 	void VulkanResourceManager::DeleteRenderPass(Handle<RenderPass> handle)
 	{
-		m_DeletionQueue.Push(Renderer::Instance->GetFrameNumber(), [=, this]()
-		{
-			VulkanRenderPass* renderPass = GetRenderPass(handle);
-			if (renderPass != nullptr)
-			{
-				renderPass->Destroy();
-				m_RenderPassPool.Remove(handle);
-			}
-		});
+		m_DeletionQueue.Push(Renderer::Instance->GetFrameNumber(), handle);
 	}
     void VulkanResourceManager::RecreateRenderPassFrameBuffer(Handle<RenderPass> handle, const FrameBufferDescriptor&& desc)
     {
@@ -528,14 +494,122 @@ namespace HBL2
 	}
 	void VulkanResourceManager::DeleteRenderPassLayout(Handle<RenderPassLayout> handle)
 	{
-		m_DeletionQueue.Push(Renderer::Instance->GetFrameNumber(), [=, this]()
-		{
-			m_RenderPassLayoutPool.Remove(handle);
-		});
+		m_DeletionQueue.Push(Renderer::Instance->GetFrameNumber(), handle);
 	}
 	VulkanRenderPassLayout* VulkanResourceManager::GetRenderPassLayout(Handle<RenderPassLayout> handle) const
 	{
 		return m_RenderPassLayoutPool.Get(handle);
 	}
-}
 
+	bool VulkanResourceManager::QueryGPUMemoryBudget(uint64_t& usage, uint64_t& budget)
+	{
+		VulkanRenderer* renderer = (VulkanRenderer*)Renderer::Instance;
+
+		if (renderer == nullptr || renderer->GetAllocator() == VK_NULL_HANDLE)
+		{
+			return false;
+		}
+
+		const VkPhysicalDeviceMemoryProperties* memoryProperties = nullptr;
+		vmaGetMemoryProperties(renderer->GetAllocator(), &memoryProperties);
+
+		// Without VK_EXT_memory_budget VMA estimates these from its own blocks and a fraction of the heap size.
+		VmaBudget heapBudgets[VK_MAX_MEMORY_HEAPS] = {};
+		vmaGetBudget(renderer->GetAllocator(), heapBudgets);
+
+		usage = 0;
+		budget = 0;
+
+		for (uint32_t i = 0; i < memoryProperties->memoryHeapCount; ++i)
+		{
+			if (memoryProperties->memoryHeaps[i].flags & VK_MEMORY_HEAP_DEVICE_LOCAL_BIT)
+			{
+				usage += heapBudgets[i].usage;
+				budget += heapBudgets[i].budget;
+			}
+		}
+
+		return budget != 0;
+	}
+
+	// Batched deleters
+	void VulkanResourceManager::DestroyTextures(Span<const Handle<Texture>> handles)
+	{
+		for (Handle<Texture> handle : handles)
+		{
+			VulkanTexture* texture = GetTexture(handle);
+			if (texture != nullptr)
+			{
+				texture->Destroy();
+				m_TexturePool.Remove(handle);
+			}
+		}
+	}
+	void VulkanResourceManager::DestroyBuffers(Span<const Handle<Buffer>> handles)
+	{
+		for (Handle<Buffer> handle : handles)
+		{
+			VulkanBuffer buffer = GetBuffer(handle);
+			if (buffer.IsValid())
+			{
+				buffer.Destroy();
+				m_BufferSplitPool.Remove(handle);
+			}
+		}
+	}
+	void VulkanResourceManager::DestroyShaders(Span<const Handle<Shader>> handles)
+	{
+		for (Handle<Shader> handle : handles)
+		{
+			VulkanShader shader = GetShader(handle);
+			if (shader.IsValid())
+			{
+				shader.Destroy();
+				m_ShaderSplitPool.Remove(handle);
+			}
+		}
+	}
+	void VulkanResourceManager::DestroyBindGroups(Span<const Handle<BindGroup>> handles)
+	{
+		for (Handle<BindGroup> handle : handles)
+		{
+			VulkanBindGroupCold* bindGroupCold = GetBindGroupCold(handle);
+			if (bindGroupCold != nullptr)
+			{
+				bindGroupCold->Destroy();
+				m_BindGroupSplitPool.Remove(handle);
+			}
+		}
+	}
+	void VulkanResourceManager::DestroyBindGroupLayouts(Span<const Handle<BindGroupLayout>> handles)
+	{
+		for (Handle<BindGroupLayout> handle : handles)
+		{
+			VulkanBindGroupLayout* bindGroupLayout = GetBindGroupLayout(handle);
+			if (bindGroupLayout != nullptr)
+			{
+				bindGroupLayout->Destroy();
+				m_BindGroupLayoutPool.Remove(handle);
+			}
+		}
+	}
+	void VulkanResourceManager::DestroyRenderPasses(Span<const Handle<RenderPass>> handles)
+	{
+		for (Handle<RenderPass> handle : handles)
+		{
+			VulkanRenderPass* renderPass = GetRenderPass(handle);
+			if (renderPass != nullptr)
+			{
+				renderPass->Destroy();
+				m_RenderPassPool.Remove(handle);
+			}
+		}
+	}
+	void VulkanResourceManager::DestroyRenderPassLayouts(Span<const Handle<RenderPassLayout>> handles)
+	{
+		for (Handle<RenderPassLayout> handle : handles)
+		{
+			m_RenderPassLayoutPool.Remove(handle);
+		}
+	}
+}
@@ -86,6 +86,17 @@ namespace HBL2
 		virtual void DeleteRenderPassLayout(Handle<RenderPassLayout> handle) override;
 		VulkanRenderPassLayout* GetRenderPassLayout(Handle<RenderPassLayout> handle) const;
 
+	protected:
+		virtual bool QueryGPUMemoryBudget(uint64_t& usage, uint64_t& budget) override;
+
+		virtual void DestroyTextures(Span<const Handle<Texture>> handles) override;
+		virtual void DestroyBuffers(Span<const Handle<Buffer>> handles) override;
+		virtual void DestroyShaders(Span<const Handle<Shader>> handles) override;
+		virtual void DestroyBindGroups(Span<const Handle<BindGroup>> handles) override;
+		virtual void DestroyBindGroupLayouts(Span<const Handle<BindGroupLayout>> handles) override;
+		virtual void DestroyRenderPasses(Span<const Handle<RenderPass>> handles) override;
+		virtual void DestroyRenderPassLayouts(Span<const Handle<RenderPassLayout>> handles) override;
+
 	private:
 		Pool<VulkanTexture, Texture> m_TexturePool;
 		SplitPool<VulkanBufferHot, VulkanBufferCold, Buffer> m_BufferSplitPool;
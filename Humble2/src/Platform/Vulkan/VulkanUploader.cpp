@@ -0,0 +1,316 @@
+#include "VulkanUploader.h"
+
+#include "VulkanDevice.h"
+#include "VulkanRenderer.h"
+
+namespace HBL2
+{
+	void VulkanUploader::Initialize(VulkanRenderer* renderer, VkDeviceSize stagingSize)
+	{
+		VulkanDevice* device = (VulkanDevice*)Device::Instance;
+
+		m_Renderer = renderer;
+		m_Device = device->Get();
+		m_StagingSize = (stagingSize + Alignment - 1) & ~(Alignment - 1);
+
+		VkBufferCreateInfo stagingBufferCreateInfo =
+		{
+			.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
+			.size = m_StagingSize,
+			.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+			.sharingMode = VK_SHARING_MODE_EXCLUSIVE,
+			.queueFamilyIndexCount = 0,
+			.pQueueFamilyIndices = nullptr,
+		};
+
+		VmaAllocationCreateInfo vmaStagingAllocCreateInfo =
+		{
+			.flags = VMA_ALLOCATION_CREATE_MAPPED_BIT,
+			.usage = VMA_MEMORY_USAGE_CPU_ONLY,
+		};
+
+		VmaAllocationInfo allocationInfo{};
+		VK_VALIDATE(vmaCreateBuffer(m_Renderer->GetAllocator(), &stagingBufferCreateInfo, &vmaStagingAllocCreateInfo, &m_StagingBuffer, &m_StagingAllocation, &allocationInfo), "vmaCreateBuffer");
+		m_StagingData = (uint8_t*)allocationInfo.pMappedData;
+
+		VkCommandPoolCreateInfo commandPoolInfo =
+		{
+			.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO,
+			.pNext = nullptr,
+			.flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT,
+			.queueFamilyIndex = device->GetQueueFamilyIndices().graphicsFamily.value(),
+		};
+
+		VkFenceCreateInfo fenceCreateInfo =
+		{
+			.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO,
+			.pNext = nullptr,
+		};
+
+		for (UploadBatch& batch : m_Batches)
+		{
+			VK_VALIDATE(vkCreateCommandPool(m_Device, &commandPoolInfo, nullptr, &batch.CommandPool), "vkCreateCommandPool");
+
+			VkCommandBufferAllocateInfo cmdAllocInfo =
+			{
+				.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
+				.pNext = nullptr,
+				.commandPool = batch.CommandPool,
+				.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY,
+				.commandBufferCount = 1,
+			};
+
+			VK_VALIDATE(vkAllocateCommandBuffers(m_Device, &cmdAllocInfo, &batch.CommandBuffer), "vkAllocateCommandBuffers");
+			VK_VALIDATE(vkCreateFence(m_Device, &fenceCreateInfo, nullptr, &batch.Fence), "vkCreateFence");
+		}
+	}
+
+	void VulkanUploader::Clean()
+	{
+		WaitIdle();
+
+		for (UploadBatch& batch : m_Batches)
+		{
+			vkDestroyFence(m_Device, batch.Fence, nullptr);
+			vkDestroyCommandPool(m_Device, batch.CommandPool, nullptr);
+			batch = {};
+		}
+
+		vmaDestroyBuffer(m_Renderer->GetAllocator(), m_StagingBuffer, m_StagingAllocation);
+
+		m_StagingBuffer = VK_NULL_HANDLE;
+		m_StagingAllocation = VK_NULL_HANDLE;
+		m_StagingData = nullptr;
+	}
+
+	void VulkanUploader::CopyBuffer(VkBuffer source, VkBuffer destination, VkDeviceSize size)
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+
+		UploadBatch& batch = OpenBatch();
+
+		VkBufferCopy copyRegion =
+		{
+			.srcOffset = 0,
+			.dstOffset = 0,
+			.size = size,
+		};
+
+		vkCmdCopyBuffer(batch.CommandBuffer, source, destination, 1, &copyRegion);
+		batch.CopyCount++;
+	}
+
+	void VulkanUploader::DestroyAfterUpload(VkBuffer buffer, VmaAllocation allocation)
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+
+		OpenBatch().Garbage.push_back({ buffer, allocation });
+	}
+
+	void VulkanUploader::Submit()
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+
+		SubmitOpenBatch();
+
+		while (RetireOldest(false))
+		{
+		}
+	}
+
+	void VulkanUploader::WaitIdle()
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+
+		SubmitOpenBatch();
+
+		while (RetireOldest(true))
+		{
+		}
+	}
+
+	VulkanUploader::StagingRegion VulkanUploader::Reserve(VkDeviceSize size)
+	{
+		const VkDeviceSize alignedSize = (size + Alignment - 1) & ~(Alignment - 1);
+
+		m_UploadedBytes += size;
+
+		// Too big for the ring, give it its own staging buffer that lives until the batch retires.
+		if (alignedSize > m_StagingSize)
+		{
+			UploadBatch& batch = OpenBatch();
+
+			VkBufferCreateInfo stagingBufferCreateInfo =
+			{
+				.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
+				.size = size,
+				.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+				.sharingMode = VK_SHARING_MODE_EXCLUSIVE,
+				.queueFamilyIndexCount = 0,
+				.pQueueFamilyIndices = nullptr,
+			};
+
+			VmaAllocationCreateInfo vmaStagingAllocCreateInfo =
+			{
+				.flags = VMA_ALLOCATION_CREATE_MAPPED_BIT,
+				.usage = VMA_MEMORY_USAGE_CPU_ONLY,
+			};
+
+			DedicatedStaging staging;
+			VmaAllocationInfo allocationInfo{};
+			VK_VALIDATE(vmaCreateBuffer(m_Renderer->GetAllocator(), &stagingBufferCreateInfo, &vmaStagingAllocCreateInfo, &staging.Buffer, &staging.Allocation, &allocationInfo), "vmaCreateBuffer");
+
+			batch.Garbage.push_back(staging);
+			batch.CopyCount++;
+
+			return { batch.CommandBuffer, staging.Buffer, 0, allocationInfo.pMappedData };
+		}
+
+		VkDeviceSize padding = 0;
+
+		while (true)
+		{
+			// Allocations never straddle the end of the ring, skip to the start instead.
+			const VkDeviceSize offset = m_Head % m_StagingSize;
+			padding = (offset + alignedSize > m_StagingSize) ? m_StagingSize - offset : 0;
+
+			if (m_Head + padding + alignedSize - m_Tail <= m_StagingSize)
+			{
+				break;
+			}
+
+			// The ring is full, push out what is recorded and wait for the oldest batch to free its part.
+			SubmitOpenBatch();
+
+			if (!RetireOldest(true))
+			{
+				HBL2_CORE_ASSERT(false, "VulkanUploader: staging ring exhausted with no uploads in flight!");
+				break;
+			}
+		}
+
+		m_Head += padding;
+
+		const VkDeviceSize offset = m_Head % m_StagingSize;
+		m_Head += alignedSize;
+
+		UploadBatch& batch = OpenBatch();
+		batch.RingEnd = m_Head;
+		batch.CopyCount++;
+
+		return { batch.CommandBuffer, m_StagingBuffer, offset, m_StagingData + offset };
+	}
+
+	VulkanUploader::UploadBatch& VulkanUploader::OpenBatch()
+	{
+		if (m_InFlightCount == MaxBatches)
+		{
+			RetireOldest(true);
+		}
+
+		UploadBatch& batch = m_Batches[(m_OldestBatch + m_InFlightCount) % MaxBatches];
+
+		if (!batch.Recording)
+		{
+			VkCommandBufferBeginInfo cmdBeginInfo =
+			{
+				.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+				.pNext = nullptr,
+				.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT,
+				.pInheritanceInfo = nullptr,
+			};
+
+			VK_VALIDATE(vkBeginCommandBuffer(batch.CommandBuffer, &cmdBeginInfo), "vkBeginCommandBuffer");
+
+			batch.Recording = true;
+			batch.RingEnd = m_Head;
+		}
+
+		return batch;
+	}
+
+	void VulkanUploader::SubmitOpenBatch()
+	{
+		if (m_InFlightCount == MaxBatches)
+		{
+			return;
+		}
+
+		UploadBatch& batch = m_Batches[(m_OldestBatch + m_InFlightCount) % MaxBatches];
+
+		if (!batch.Recording || (batch.CopyCount == 0 && batch.Garbage.empty()))
+		{
+			return;
+		}
+
+		// Make the copies visible to everything submitted after this batch on the queue, barriers order across submissions.
+		VkMemoryBarrier barrier =
+		{
+			.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER,
+			.pNext = nullptr,
+			.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT,
+			.dstAccessMask = VK_ACCESS_MEMORY_READ_BIT,
+		};
+
+		vkCmdPipelineBarrier(batch.CommandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0, 1, &barrier, 0, nullptr, 0, nullptr);
+
+		VK_VALIDATE(vkEndCommandBuffer(batch.CommandBuffer), "vkEndCommandBuffer");
+
+		VkSubmitInfo submit =
+		{
+			.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO,
+			.pNext = nullptr,
+			.waitSemaphoreCount = 0,
+			.pWaitSemaphores = nullptr,
+			.pWaitDstStageMask = nullptr,
+			.commandBufferCount = 1,
+			.pCommandBuffers = &batch.CommandBuffer,
+			.signalSemaphoreCount = 0,
+			.pSignalSemaphores = nullptr,
+		};
+
+		{
+			std::lock_guard<std::mutex> lock(m_Renderer->GetGraphicsQueueMutex());
+			VK_VALIDATE(vkQueueSubmit(m_Renderer->GetGraphicsQueue(), 1, &submit, batch.Fence), "vkQueueSubmit");
+		}
+
+		batch.Recording = false;
+		m_InFlightCount++;
+	}
+
+	bool VulkanUploader::RetireOldest(bool wait)
+	{
+		if (m_InFlightCount == 0)
+		{
+			return false;
+		}
+
+		UploadBatch& batch = m_Batches[m_OldestBatch];
+
+		if (wait)
+		{
+			VK_VALIDATE(vkWaitForFences(m_Device, 1, &batch.Fence, VK_TRUE, UINT64_MAX), "vkWaitForFences");
+		}
+		else if (vkGetFenceStatus(m_Device, batch.Fence) != VK_SUCCESS)
+		{
+			return false;
+		}
+
+		VK_VALIDATE(vkResetFences(m_Device, 1, &batch.Fence), "vkResetFences");
+		VK_VALIDATE(vkResetCommandPool(m_Device, batch.CommandPool, 0), "vkResetCommandPool");
+
+		for (const DedicatedStaging& staging : batch.Garbage)
+		{
+			vmaDestroyBuffer(m_Renderer->GetAllocator(), staging.Buffer, staging.Allocation);
+		}
+
+		batch.Garbage.clear();
+		batch.CopyCount = 0;
+
+		m_Tail = batch.RingEnd;
+		m_OldestBatch = (m_OldestBatch + 1) % MaxBatches;
+		m_InFlightCount--;
+
+		return true;
+	}
+}
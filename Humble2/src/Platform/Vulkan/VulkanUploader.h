@@ -0,0 +1,121 @@
+#pragma once
+
+#include "Base.h"
+#include "VulkanCommon.h"
+
+#include <mutex>
+#include <vector>
+#include <cstring>
+
+namespace HBL2
+{
+	class VulkanRenderer;
+
+	/**
+	 * @brief Batches GPU uploads through one persistently mapped staging ring.
+	 *
+	 * Uploads from any thread copy their bytes into the ring and record the copy into the open batch, nothing is
+	 * submitted or waited on at that point. The render thread calls Submit before each queue submission, which
+	 * sends the open batch ahead of the frame commands (same queue, so the frame sees the data) and retires
+	 * batches whose fence has signalled, freeing their part of the ring. Producers only block when the ring or
+	 * every batch is in use, in which case they wait on the oldest batch.
+	 */
+	class VulkanUploader
+	{
+	public:
+		static constexpr uint32_t MaxBatches = 4;
+		static constexpr VkDeviceSize Alignment = 16;
+
+		void Initialize(VulkanRenderer* renderer, VkDeviceSize stagingSize);
+		void Clean();
+
+		/**
+		 * @brief Copies the data into the staging ring and records a copy from it into the open batch.
+		 *
+		 * @param record Called with the batch command buffer, the staging buffer and the offset of the data in it.
+		 */
+		template<typename F>
+		void Upload(const void* data, VkDeviceSize size, F&& record)
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+
+			StagingRegion region = Reserve(size);
+			std::memcpy(region.Mapped, data, (size_t)size);
+			record(region.CommandBuffer, region.Buffer, region.Offset);
+		}
+
+		/**
+		 * @brief Records a device side copy (no staging) into the open batch.
+		 */
+		void CopyBuffer(VkBuffer source, VkBuffer destination, VkDeviceSize size);
+
+		/**
+		 * @brief Destroys the buffer once every upload recorded so far has completed.
+		 */
+		void DestroyAfterUpload(VkBuffer buffer, VmaAllocation allocation);
+
+		/**
+		 * @brief Submits the open batch and retires the completed ones. Render thread, before every graphics queue submission.
+		 */
+		void Submit();
+
+		/**
+		 * @brief Submits the open batch and waits for every batch to complete.
+		 */
+		void WaitIdle();
+
+		uint64_t GetUploadedBytes() const { return m_UploadedBytes; }
+
+	private:
+		struct StagingRegion
+		{
+			VkCommandBuffer CommandBuffer = VK_NULL_HANDLE;
+			VkBuffer Buffer = VK_NULL_HANDLE;
+			VkDeviceSize Offset = 0;
+			void* Mapped = nullptr;
+		};
+
+		struct DedicatedStaging
+		{
+			VkBuffer Buffer = VK_NULL_HANDLE;
+			VmaAllocation Allocation = VK_NULL_HANDLE;
+		};
+
+		struct UploadBatch
+		{
+			VkCommandPool CommandPool = VK_NULL_HANDLE;
+			VkCommandBuffer CommandBuffer = VK_NULL_HANDLE;
+			VkFence Fence = VK_NULL_HANDLE;
+			uint64_t RingEnd = 0;
+			uint32_t CopyCount = 0;
+			bool Recording = false;
+			std::vector<DedicatedStaging> Garbage;
+		};
+
+		// All of these expect m_Mutex to be held.
+		StagingRegion Reserve(VkDeviceSize size);
+		UploadBatch& OpenBatch();
+		void SubmitOpenBatch();
+		bool RetireOldest(bool wait);
+
+		VulkanRenderer* m_Renderer = nullptr;
+		VkDevice m_Device = VK_NULL_HANDLE;
+
+		VkBuffer m_StagingBuffer = VK_NULL_HANDLE;
+		VmaAllocation m_StagingAllocation = VK_NULL_HANDLE;
+		uint8_t* m_StagingData = nullptr;
+		VkDeviceSize m_StagingSize = 0;
+
+		// Monotonic byte positions, the ring offset is the position modulo the staging size.
+		uint64_t m_Head = 0;
+		uint64_t m_Tail = 0;
+
+		UploadBatch m_Batches[MaxBatches];
+		uint32_t m_OldestBatch = 0;
+		uint32_t m_InFlightCount = 0; // The open batch is the one right after the in flight ones.
+
+		uint64_t m_UploadedBytes = 0;
+
+		std::mutex m_Mutex;
+	};
+}
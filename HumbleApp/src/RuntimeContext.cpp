@@ -82,6 +82,7 @@ namespace HBL2
 			{
 				if (system->GetState() == HBL2::SystemState::Play)
 				{
+					HBL2_TRACE_ZONE(system->Name.c_str());
 					system->OnUpdate(ts);
 				}
 			}
@@ -68,6 +68,7 @@ namespace HBL2
 		{
 			for (HBL2::ISystem* system : m_EditorScene->GetSystems())
 			{
+				HBL2_TRACE_ZONE(system->Name.c_str());
 				system->OnUpdate(ts);
 			}
 
@@ -81,6 +82,7 @@ namespace HBL2
 			{
 				if (system->GetState() == SystemState::Play)
 				{
+					HBL2_TRACE_ZONE(system->Name.c_str());
 					system->OnUpdate(ts);
 				}
 			}
@@ -91,6 +93,7 @@ namespace HBL2
 				{
 					if (system->GetState() == SystemState::Play)
 					{
+						HBL2_TRACE_ZONE(system->Name.c_str());
 						system->OnUpdate(ts);
 					}
 				}
@@ -281,10 +281,22 @@ namespace HBL2::Editor
 			ImGui::SameLine();
 			ImGui::TextColored({ 1.0f, 1.0f, 0.f, 1.0f }, "*Requires restart to take effect");
 
+			ImGui::InputInt("Max Frame Slot Arena Memory (in MB)", (int*)&spec.Settings.MaxFrameSlotArenaMemory);
+			ImGui::SameLine();
+			ImGui::TextColored({ 1.0f, 1.0f, 0.f, 1.0f }, "*Requires restart to take effect");
+
 			ImGui::InputInt("Max UniformBuffer Memory (in MB)", (int*)&spec.Settings.MaxUniformBufferMemory);
 			ImGui::SameLine();
 			ImGui::TextColored({ 1.0f, 1.0f, 0.f, 1.0f }, "*Requires restart to take effect");
 
+			ImGui::InputInt("Max Scene Buffer Memory (in MB)", (int*)&spec.Settings.MaxSceneBufferMemory);
+			ImGui::SameLine();
+			ImGui::TextColored({ 1.0f, 1.0f, 0.f, 1.0f }, "*Requires restart to take effect");
+
+			ImGui::InputInt("Max Instanced Draws", (int*)&spec.Settings.MaxInstancedDraws);
+			ImGui::SameLine();
+			ImGui::TextColored({ 1.0f, 1.0f, 0.f, 1.0f }, "*Requires restart to take effect");
+
 			ImGui::Separator();
 
 			ImGui::PushStyleVar(ImGuiStyleVar_FramePadding, ImVec2{ 4, 4 });
@@ -308,6 +320,17 @@ namespace HBL2::Editor
 				ImGui::InputInt("Sounds Pool Size", (int*)&spec.Settings.ResourceManagerSpec.Sounds);
 				ImGui::InputInt("Prefabs Pool Size", (int*)&spec.Settings.ResourceManagerSpec.Prefabs);
 
+				ImGui::Separator();
+				ImGui::TextUnformatted("Memory Budgets (MB, 0 = unlimited)");
+				ImGui::InputInt("Textures GPU Budget", (int*)&spec.Settings.ResourceManagerSpec.TextureBudget.GPU);
+				ImGui::InputInt("Meshes GPU Budget", (int*)&spec.Settings.ResourceManagerSpec.MeshBudget.GPU);
+				ImGui::InputInt("Buffers GPU Budget", (int*)&spec.Settings.ResourceManagerSpec.BufferBudget.GPU);
+				ImGui::InputInt("Buffers CPU Budget", (int*)&spec.Settings.ResourceManagerSpec.BufferBudget.CPU);
+
+				ImGui::Separator();
+				ImGui::Checkbox("GPU Residency Management", &spec.Settings.ResourceManagerSpec.ResidencyManagement);
+				ImGui::InputInt("Residency GPU Budget (0 = driver budget)", (int*)&spec.Settings.ResourceManagerSpec.ResidencyBudget);
+
 				ImGui::TreePop();
 			}
 
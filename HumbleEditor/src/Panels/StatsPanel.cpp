@@ -167,6 +167,62 @@ namespace HBL2::Editor
 		ImGui::Text("Frame Arena RT: %f %%", (frameArenaRTUsedBytes / frameArenaRTTotalBytes) * 100.f);
 		ImGui::Text("Frame Arena RT HW: %f %%", (frameArenaRTHighWater / frameArenaRTTotalBytes) * 100.f);
 
+		if (ImGui::TreeNode("Reservations"))
+		{
+			for (const ReservationStats& r : MemoryTelemetry::GetReservationStats())
+			{
+				ImGui::Text("%s: %.2f / %.2f MB (peak %.2f MB), %u chunks, %.0f allocs/s", r.Name,
+					(float)r.BytesUsed / 1_MB, (float)r.Size / 1_MB, (float)r.PeakBytesUsed / 1_MB, r.ChunkCount, r.AllocationsPerSecond);
+			}
+
+			ImGui::TreePop();
+		}
+
+		if (ImGui::TreeNode("Frame Arena Peaks"))
+		{
+			for (const ArenaPeakStats& a : MemoryTelemetry::GetFrameArenaStats())
+			{
+				ImGui::Text("%s: %.2f / %.2f MB (last %.2f MB)", a.Name, (float)a.PeakBytes / 1_MB, (float)a.TotalBytes / 1_MB, (float)a.LastUsedBytes / 1_MB);
+			}
+
+			if (ImGui::Button("Reset Peaks"))
+			{
+				MemoryTelemetry::ResetPeaks();
+			}
+
+			ImGui::TreePop();
+		}
+
+		if (ImGui::Button("Dump Memory Report"))
+		{
+			MemoryTelemetry::DumpJson(Project::GetProjectDirectory() / "memory-report.json");
+		}
+
+		ImGui::Separator();
+
+		ImGui::Text("Tracer");
+		ImGui::NewLine();
+
+		bool tracing = Tracer::IsEnabled();
+		if (ImGui::Checkbox("Record", &tracing))
+		{
+			Tracer::SetEnabled(tracing);
+		}
+
+		ImGui::SameLine();
+
+		if (ImGui::Button("Export"))
+		{
+			Tracer::Get().ExportChromeTrace(Project::GetProjectDirectory() / "trace.json");
+		}
+
+		ImGui::SameLine();
+
+		if (ImGui::Button("Clear"))
+		{
+			Tracer::Get().Clear();
+		}
+
 		ImGui::End();
 	}
 